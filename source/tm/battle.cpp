@@ -172,6 +172,14 @@ struct Battle {
 		}
 	}
 
+	// Resumes a battle from a state it was in before, so nothing switches in
+	explicit Battle(VisibleState<generation> const & state):
+		m_ai(state.ai),
+		m_foe(state.foe),
+		m_environment(state.environment)
+	{
+	}
+
 	auto ai() const -> KnownTeam<generation> const & {
 		return m_ai;
 	}
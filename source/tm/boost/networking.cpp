@@ -10,6 +10,10 @@ import std_module;
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/connect.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/asio/ssl.hpp>
 
 #include <boost/beast/core/error.hpp>
@@ -43,6 +47,10 @@ namespace boost::asio {
 
 export using ::boost::asio::buffer;
 export using ::boost::asio::io_context;
+export using ::boost::asio::make_strand;
+export using ::boost::asio::post;
+export using ::boost::asio::steady_timer;
+export using ::boost::asio::thread_pool;
 
 } // namespace boost::asio
 
@@ -56,6 +64,7 @@ export using ::boost::beast::http::field;
 export using ::boost::beast::http::read;
 export using ::boost::beast::http::request;
 export using ::boost::beast::http::response;
+export using ::boost::beast::http::span_body;
 export using ::boost::beast::http::status;
 export using ::boost::beast::http::string_body;
 export using ::boost::beast::http::verb;
@@ -96,6 +105,16 @@ export auto connect_ssl_socket(
 	socket.handshake(boost::asio::ssl::stream_base::client);
 }
 
+export auto connect_socket(
+	boost::asio::io_context & context,
+	tcp::socket & socket,
+	std::string_view const host,
+	std::string_view const port
+) -> void {
+	auto resolver = tcp::resolver(context);
+	boost::asio::connect(socket, resolver.resolve(host, port));
+}
+
 export auto create_http_post(std::string_view const host, std::string_view const target, std::string_view const data) -> http::request<http::string_body> {
 	constexpr auto version = 11U;
 	auto request = http::request<http::string_body>(http::verb::post, target, version, data);
@@ -117,6 +136,14 @@ export auto websocket_read(Websocket & websocket, boost::beast::flat_buffer & bu
 export auto websocket_write(Websocket & websocket, std::string_view const str) -> void {
 	websocket.write(boost::asio::buffer(str));
 }
+// Work around boost headers declaring some functions `static`
+export auto websocket_read(InsecureWebsocket & websocket, boost::beast::flat_buffer & buffer) -> void {
+	websocket.read(buffer);
+}
+// Work around boost headers declaring some functions `static`
+export auto websocket_write(InsecureWebsocket & websocket, std::string_view const str) -> void {
+	websocket.write(boost::asio::buffer(str));
+}
 
 using Continuation = auto(boost::beast::error_code, std::size_t) const -> void;
 
@@ -137,6 +164,14 @@ export auto websocket_async_write(
 	websocket.async_write(buffer, continuation);
 }
 
+// Negotiates permessage-deflate with clients that ask for it. Must be called
+// before the handshake is accepted.
+export auto websocket_enable_compression(InsecureWebsocket & websocket) -> void {
+	auto options = boost::beast::websocket::permessage_deflate();
+	options.server_enable = true;
+	websocket.set_option(options);
+}
+
 export auto websocket_close(InsecureWebsocket & socket) -> void {
 	socket.close(boost::beast::websocket::close_reason());
 }
@@ -18,9 +18,7 @@ import tm.string_conversions.selection;
 import tm.string_conversions.species;
 import tm.string_conversions.team;
 
-import tm.team_predictor.all_usage_stats;
 import tm.team_predictor.team_predictor;
-import tm.team_predictor.usage_stats;
 
 import tm.generation;
 import tm.generation_generic;
@@ -57,11 +55,11 @@ auto log_move_probabilities(
 template<Generation generation>
 auto predicted_state(
 	VisibleState<generation> const & state,
-	UsageStats const & usage_stats
+	IncrementalTeamPredictor & team_predictor
 ) -> State<generation> {
 	return State<generation>(
 		Team<generation>(state.ai),
-		most_likely_team(usage_stats, state.foe),
+		team_predictor.most_likely_team(state.foe),
 		state.environment
 	);
 }
@@ -90,14 +88,14 @@ template<Generation generation>
 auto determine_selection(
 	VisibleState<generation> const & visible,
 	std::ostream & stream,
-	UsageStats const & usage_stats,
+	IncrementalTeamPredictor & team_predictor,
 	Strategy const & strategy,
 	std::mt19937 & random_engine
 ) -> Selection {
 	if (team_is_empty(visible.ai) or team_is_empty(visible.foe)) {
 		throw std::runtime_error("Tried to determine a selection with an empty team.");
 	}
-	auto const state = predicted_state(visible, usage_stats);
+	auto const state = predicted_state(visible, team_predictor);
 
 	auto log_team = [&](containers::string_view const label, Team<generation> const & team) {
 		constexpr auto include_active_marker = true;
@@ -140,18 +138,17 @@ auto determine_selection(
 export auto determine_selection(
 	GenerationGeneric<VisibleState> const & generic_state,
 	std::ostream & stream,
-	AllUsageStats const & all_usage_stats,
+	IncrementalTeamPredictor & team_predictor,
 	Strategy const & strategy,
 	std::mt19937 & random_engine
 ) -> Selection {
-	auto const & usage_stats = all_usage_stats[get_generation(generic_state)];
 	return tv::visit(
 		generic_state,
 		[&]<Generation generation>(VisibleState<generation> const & state) -> Selection {
 			return determine_selection(
 				state,
 				stream,
-				usage_stats,
+				team_predictor,
 				strategy,
 				random_engine
 			);
@@ -30,10 +30,10 @@ auto get_team(Generation const generation, SettingsFile::Team const & source, Al
 	return tv::visit(source, tv::overload(
 		[&](SettingsFile::NoTeam) -> tv::optional<GenerationGeneric<KnownTeam>> { return tv::none; },
 		[&](SettingsFile::GenerateTeam) -> tv::optional<GenerationGeneric<KnownTeam>> {
-			auto & usage_stats = all_usage_stats[generation];
+			auto const usage_stats = all_usage_stats[generation];
 			return constant_generation(generation, [&]<Generation g>(constant_gen_t<g>) {
 				return GenerationGeneric<KnownTeam>(
-					KnownTeam<g>(random_team<g>(usage_stats, random_engine))
+					KnownTeam<g>(random_team<g>(*usage_stats, random_engine))
 				);
 			});
 		},
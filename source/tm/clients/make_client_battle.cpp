@@ -9,11 +9,13 @@ import tm.clients.client_battle;
 import tm.clients.teams;
 
 import tm.generation_generic;
+import tm.state;
 
 import std_module;
 
 namespace technicalmachine {
 
 export auto make_client_battle(GenerationGeneric<Teams> teams) -> std::unique_ptr<ClientBattle>;
+export auto make_client_battle(GenerationGeneric<VisibleState> const & state) -> std::unique_ptr<ClientBattle>;
 
 } // namespace technicalmachine
@@ -70,6 +70,10 @@ struct ClientBattleImpl final : ClientBattle {
 		)
 	{
 	}
+	explicit ClientBattleImpl(VisibleState<generation_> const & state):
+		m_battle(state)
+	{
+	}
 
 	auto generation() const -> Generation final {
 		return generation_;
@@ -205,4 +209,12 @@ auto make_client_battle(GenerationGeneric<Teams> generic_teams) -> std::unique_p
 	});
 }
 
+auto make_client_battle(GenerationGeneric<VisibleState> const & generic_state) -> std::unique_ptr<ClientBattle> {
+	return tv::visit(
+		generic_state,
+		[]<Generation generation>(VisibleState<generation> const & state) -> std::unique_ptr<ClientBattle> {
+		return std::make_unique<ClientBattleImpl<generation>>(state);
+	});
+}
+
 } // namespace technicalmachine
@@ -0,0 +1,237 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.clients.ps.battle_logger;
+
+import tm.clients.ps.room;
+import tm.clients.ps.room_message_block;
+
+import tm.open_file;
+
+import bounded;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine::ps {
+using namespace containers::string_literals;
+
+export enum class BattleLogFile {
+	server_messages,
+	analysis,
+};
+
+constexpr auto file_name(BattleLogFile const file) -> std::string_view {
+	switch (file) {
+		case BattleLogFile::server_messages: return "server_messages.txt";
+		case BattleLogFile::analysis: return "analysis.txt";
+	}
+}
+
+enum class LogOperation {
+	server_messages,
+	analysis,
+	close,
+};
+
+// Accepts any contiguous range of char
+constexpr auto to_std_string_view(auto const & text) -> std::string_view {
+	if constexpr (std::convertible_to<decltype(text), std::string_view>) {
+		return text;
+	} else {
+		return std::string_view(containers::data(text), static_cast<std::size_t>(containers::size(text)));
+	}
+}
+
+struct LogEntry {
+	LogOperation operation;
+	std::size_t room_size;
+	// The room followed by the text to write
+	std::string data;
+};
+
+// Each file is opened the first time something is written to it and stays
+// open until the room is closed
+struct RoomFiles {
+	explicit RoomFiles(std::filesystem::path directory_):
+		directory(std::move(directory_))
+	{
+	}
+
+	auto get(BattleLogFile const file) -> std::ofstream & {
+		auto & stream = file == BattleLogFile::server_messages ? server_messages : analysis;
+		if (!stream) {
+			stream.emplace([&] { return open_text_file_for_appending(directory / file_name(file)); });
+		}
+		return *stream;
+	}
+
+	auto flush() -> void {
+		if (server_messages) {
+			server_messages->flush();
+		}
+		if (analysis) {
+			analysis->flush();
+		}
+	}
+
+	std::filesystem::path directory;
+	tv::optional<std::ofstream> server_messages;
+	tv::optional<std::ofstream> analysis;
+};
+
+// Writes the logs for every battle room on a background thread, so the thread
+// that reads from the server never waits on the disk. Writes are batched and
+// flushed once per batch.
+//
+// The text of each write is copied into one of `buffer_count` buffers that are
+// allocated when the logger is constructed, and the background thread hands
+// each buffer back once it has been written. When every buffer is waiting to
+// be written, `write` blocks until the background thread catches up. A write
+// longer than `buffer_capacity` grows its buffer, which then keeps that
+// capacity, so writing never allocates otherwise.
+export struct BattleLogger {
+	explicit BattleLogger(std::filesystem::path directory):
+		m_directory(std::move(directory)),
+		m_free(containers::generate_n(buffer_count, [] {
+			auto buffer = std::string();
+			buffer.reserve(buffer_capacity);
+			return buffer;
+		})),
+		m_pending(containers::reserve_space_for(buffer_count)),
+		m_thread([&](std::stop_token token) {
+			auto batch = containers::vector<LogEntry>(containers::reserve_space_for(buffer_count));
+			while (take_pending(token, batch)) {
+				write_all(batch);
+				hand_back(batch);
+			}
+		})
+	{
+	}
+	BattleLogger(BattleLogger &&) = delete;
+	BattleLogger(BattleLogger const &) = delete;
+	auto operator=(BattleLogger &&) -> BattleLogger & = delete;
+	auto operator=(BattleLogger const &) -> BattleLogger & = delete;
+
+	auto write(Room const room, BattleLogFile const file, auto const & ... text) -> void {
+		push(
+			file == BattleLogFile::server_messages ? LogOperation::server_messages : LogOperation::analysis,
+			room,
+			text...
+		);
+	}
+
+	// Anything written to the room after this opens the files again
+	auto close(Room const room) -> void {
+		push(LogOperation::close, room);
+	}
+
+private:
+	static constexpr auto buffer_count = bounded::constant<1'000>;
+	static constexpr auto buffer_capacity = std::size_t(4'096);
+
+	auto push(LogOperation const operation, Room const room, auto const & ... text) -> void {
+		auto data = take_buffer();
+		auto const room_view = to_std_string_view(room);
+		data.append(room_view);
+		(..., data.append(to_std_string_view(text)));
+		{
+			auto const lock = std::scoped_lock(m_mutex);
+			containers::push_back(m_pending, LogEntry(operation, room_view.size(), std::move(data)));
+		}
+		m_pending_changed.notify_one();
+	}
+
+	auto take_buffer() -> std::string {
+		auto lock = std::unique_lock(m_mutex);
+		m_free_changed.wait(lock, [&] { return !containers::is_empty(m_free); });
+		auto result = std::move(containers::back(m_free));
+		containers::pop_back(m_free);
+		return result;
+	}
+
+	// Only called by the background thread. Returns false once stop is
+	// requested and everything pushed before that has been taken.
+	auto take_pending(std::stop_token const & token, containers::vector<LogEntry> & batch) -> bool {
+		auto lock = std::unique_lock(m_mutex);
+		m_pending_changed.wait(lock, token, [&] { return !containers::is_empty(m_pending); });
+		if (containers::is_empty(m_pending)) {
+			return false;
+		}
+		std::swap(batch, m_pending);
+		return true;
+	}
+
+	// Only called by the background thread
+	auto hand_back(containers::vector<LogEntry> & batch) -> void {
+		{
+			auto const lock = std::scoped_lock(m_mutex);
+			for (auto & entry : batch) {
+				entry.data.clear();
+				containers::push_back(m_free, std::move(entry.data));
+			}
+		}
+		batch.clear();
+		m_free_changed.notify_all();
+	}
+
+	// Only called by the background thread
+	auto write_one(LogEntry const & entry) -> void {
+		auto const room = containers::string_view(
+			entry.data.data(),
+			bounded::assume_in_range<containers::array_size_type<char>>(entry.room_size)
+		);
+		if (entry.operation == LogOperation::close) {
+			containers::keyed_erase(m_rooms, room);
+			return;
+		}
+		auto files = containers::lookup(m_rooms, room);
+		if (!files) {
+			files = std::addressof(containers::get_mapped(*m_rooms.lazy_insert(
+				containers::string(room),
+				[&] { return RoomFiles(m_directory / std::filesystem::path(room)); }
+			).iterator));
+		}
+		auto const file = entry.operation == LogOperation::server_messages ? BattleLogFile::server_messages : BattleLogFile::analysis;
+		files->get(file) << std::string_view(entry.data).substr(entry.room_size);
+	}
+
+	// Only called by the background thread
+	auto write_all(containers::vector<LogEntry> const & entries) -> void {
+		for (auto const & entry : entries) {
+			try {
+				write_one(entry);
+			} catch (std::exception const & ex) {
+				std::cerr << "Unable to write battle log: " << ex.what() << '\n';
+			}
+		}
+		for (auto & room : m_rooms) {
+			try {
+				room.mapped.flush();
+			} catch (std::exception const & ex) {
+				std::cerr << "Unable to flush battle log: " << ex.what() << '\n';
+			}
+		}
+	}
+
+	std::filesystem::path m_directory;
+	containers::linear_map<containers::string, RoomFiles> m_rooms;
+	std::mutex m_mutex;
+	std::condition_variable m_free_changed;
+	std::condition_variable_any m_pending_changed;
+	// Both have room for every buffer, so moving a buffer between them never
+	// allocates
+	containers::vector<std::string> m_free;
+	containers::vector<LogEntry> m_pending;
+	// Declared last so the thread is joined before anything it uses is
+	// destroyed
+	std::jthread m_thread;
+};
+
+export auto log_battle_messages(BattleLogger & logger, RoomMessageBlock const block) -> void {
+	logger.write(block.room(), BattleLogFile::server_messages, ">"_s, block.room(), "\n"_s, block.str(), "\n"_s);
+}
+
+} // namespace technicalmachine::ps
@@ -8,6 +8,7 @@ export module tm.clients.ps.battle_manager;
 import tm.clients.ps.action_required;
 import tm.clients.ps.battle_init_message;
 import tm.clients.ps.battle_message_handler;
+import tm.clients.ps.battle_snapshot;
 import tm.clients.ps.battle_started;
 import tm.clients.ps.parsed_message;
 import tm.clients.ps.parsed_request;
@@ -19,6 +20,8 @@ import tm.clients.battle_finished;
 import tm.clients.party;
 import tm.clients.turn_count;
 
+import tm.generation_generic;
+
 import bounded;
 import containers;
 import tv;
@@ -31,6 +34,10 @@ export struct BattleManager {
 		m_battle(message)
 	{
 	}
+	explicit constexpr BattleManager(GenerationGeneric<BattleSnapshot> const & snapshot):
+		m_battle(BattleMessageHandler(snapshot))
+	{
+	}
 
 	constexpr auto handle_request(ParsedRequest const & message) -> ActionRequired {
 		auto & handler = tv::visit(m_battle, tv::overload(
@@ -64,6 +71,17 @@ export struct BattleManager {
 			}
 		));
 	}
+
+	constexpr auto snapshot(TurnCount const turn_count) const -> GenerationGeneric<BattleSnapshot> {
+		return tv::visit(m_battle, tv::overload(
+			[](BattleInitMessage const &) -> GenerationGeneric<BattleSnapshot> {
+				throw std::runtime_error("Cannot snapshot a battle before the first action");
+			},
+			[&](BattleMessageHandler const & handler) -> GenerationGeneric<BattleSnapshot> {
+				return handler.snapshot(turn_count);
+			}
+		));
+	}
 private:
 	using State = tv::variant<
 		BattleInitMessage,
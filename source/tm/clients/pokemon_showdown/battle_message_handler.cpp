@@ -6,6 +6,7 @@
 export module tm.clients.ps.battle_message_handler;
 
 import tm.clients.ps.battle_init_message;
+import tm.clients.ps.battle_snapshot;
 import tm.clients.ps.end_of_turn_state;
 import tm.clients.ps.move_state;
 import tm.clients.ps.parsed_message;
@@ -26,6 +27,7 @@ import tm.pokemon.max_pokemon_per_team;
 
 import tm.status.status_name;
 
+import tm.generation;
 import tm.generation_generic;
 import tm.state;
 import tm.visible_hp;
@@ -51,6 +53,7 @@ struct HitSelf {
 
 export struct BattleMessageHandler {
 	BattleMessageHandler(Party, ParsedTeam const &, BattleInitMessage const &);
+	explicit BattleMessageHandler(GenerationGeneric<BattleSnapshot> const &);
 
 	using Result = tv::variant<
 		StartOfTurn,
@@ -65,6 +68,11 @@ export struct BattleMessageHandler {
 	auto slot_memory() const -> SlotMemory {
 		return m_slot_memory;
 	}
+	auto snapshot(TurnCount const turn_count) const -> GenerationGeneric<BattleSnapshot> {
+		return tv::visit(state(), [&]<Generation generation>(VisibleState<generation> const & value) -> GenerationGeneric<BattleSnapshot> {
+			return BattleSnapshot<generation>(m_party, m_slot_memory, turn_count, value);
+		});
+	}
 private:
 	auto use_move(MoveState) -> void;
 	auto use_switch(SwitchState) -> void;
@@ -10,6 +10,7 @@ module;
 
 module tm.clients.ps.battle_message_handler;
 
+import tm.clients.ps.battle_snapshot;
 import tm.clients.ps.end_of_turn_state;
 import tm.clients.ps.end_of_turn_state_builder;
 import tm.clients.ps.move_state;
@@ -38,6 +39,7 @@ import tm.any_team;
 import tm.constant_generation;
 import tm.generation;
 import tm.generation_generic;
+import tm.state;
 import tm.team;
 import tm.team_is_empty;
 import tm.visible_hp;
@@ -78,6 +80,15 @@ BattleMessageHandler::BattleMessageHandler(Party const party, ParsedTeam const &
 {
 }
 
+BattleMessageHandler::BattleMessageHandler(GenerationGeneric<BattleSnapshot> const & snapshot):
+	m_slot_memory(tv::visit(snapshot, [](auto const & value) { return value.slot_memory; })),
+	m_client_battle(make_client_battle(
+		tv::visit(snapshot, [](auto const & value) -> GenerationGeneric<VisibleState> { return value.state; })
+	)),
+	m_party(tv::visit(snapshot, [](auto const & value) { return value.party; }))
+{
+}
+
 struct Nothing {
 };
 
@@ -6,6 +6,7 @@
 export module tm.clients.ps.battle_message_kind;
 
 import tm.clients.ps.in_message;
+import tm.clients.ps.message_type;
 
 import containers;
 import std_module;
@@ -25,41 +26,43 @@ export enum class BattleMessageKind {
 
 // https://github.com/smogon/pokemon-showdown/blob/master/sim/SIM-PROTOCOL.md
 export constexpr auto get_battle_message_kind(InMessage const first_message, bool const has_more_data) -> BattleMessageKind {
-	auto matches = [&](auto const... strs) {
-		return (... or (first_message.type() == strs));
-	};
 	using enum BattleMessageKind;
-	if (matches("init"_s, "raw"_s, "t:"_s, "inactive"_s, "inactiveoff"_s)) {
-		return junk;
-	} else if (matches("teamsize"_s)) {
-		// "teamsize" never starts a block in the real stream. However, we have
-		// to filter out all the "player" messages when parsing PS logs due to
-		// bugs on the PS side. That makes "teamsize" the beginning of the block
-		// when parsing those files.
-		return init;
-	} else if (matches("player"_s)) {
-		return has_more_data ? init	: junk;
-	} else if (matches("-message"_s)) {
-		return regular;
-	} else if (matches(""_s)) {
-		return first_message.remainder() == ladder_timeout ? junk : regular;
-	} else if (matches("request"_s)) {
-		if (has_more_data) {
-			throw std::runtime_error("Request message contains too much data");
-		}
-		return request;
-	} else if (matches("error"_s)) {
-		if (has_more_data) {
-			throw std::runtime_error("Error message contains too much data");
-		}
-		return error;
-	} else {
-		throw std::runtime_error(containers::concatenate<std::string>(
-			"Unknown battle message kind: |"_s,
-			first_message.type(),
-			"|"_s,
-			first_message.remainder()
-		));
+	switch (parse_message_type(first_message.type())) {
+		case MessageType::init:
+		case MessageType::raw:
+		case MessageType::battle_timestamp:
+		case MessageType::inactive:
+		case MessageType::inactiveoff:
+			return junk;
+		case MessageType::teamsize:
+			// "teamsize" never starts a block in the real stream. However, we
+			// have to filter out all the "player" messages when parsing PS logs
+			// due to bugs on the PS side. That makes "teamsize" the beginning
+			// of the block when parsing those files.
+			return init;
+		case MessageType::player:
+			return has_more_data ? init	: junk;
+		case MessageType::minor_message:
+			return regular;
+		case MessageType::empty:
+			return first_message.remainder() == ladder_timeout ? junk : regular;
+		case MessageType::request:
+			if (has_more_data) {
+				throw std::runtime_error("Request message contains too much data");
+			}
+			return request;
+		case MessageType::error:
+			if (has_more_data) {
+				throw std::runtime_error("Error message contains too much data");
+			}
+			return error;
+		default:
+			throw std::runtime_error(containers::concatenate<std::string>(
+				"Unknown battle message kind: |"_s,
+				first_message.type(),
+				"|"_s,
+				first_message.remainder()
+			));
 	}
 }
 
@@ -0,0 +1,28 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.clients.ps.battle_snapshot;
+
+import tm.clients.ps.slot_memory;
+
+import tm.clients.party;
+import tm.clients.turn_count;
+
+import tm.generation;
+import tm.state;
+
+namespace technicalmachine::ps {
+
+// Everything the client needs to keep playing a battle, as of the start of a
+// turn
+export template<Generation generation>
+struct BattleSnapshot {
+	Party party;
+	SlotMemory slot_memory;
+	TurnCount turn_count;
+	VisibleState<generation> state;
+};
+
+} // namespace technicalmachine::ps
@@ -0,0 +1,252 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.clients.ps.battle_snapshot_file;
+
+import tm.clients.ps.battle_snapshot;
+import tm.clients.ps.room;
+
+import tm.binary_file_reader;
+import tm.constant_generation;
+import tm.generation;
+import tm.generation_generic;
+import tm.open_file;
+import tm.write_bytes;
+
+import bounded;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine::ps {
+using namespace bounded::literal;
+
+// The tmbs format is a header followed by one `BattleSnapshot`, stored exactly
+// as it is laid out in memory. There is one file per room, named after the
+// room. As with the tmdp format, only a build with the same layout can read it,
+// so the version must be changed whenever the layout changes in a way that
+// keeps the same size.
+
+constexpr auto magic_string = containers::array{
+	std::byte('t'),
+	std::byte('m'),
+	std::byte(' '),
+	std::byte('s'),
+	std::byte('n'),
+	std::byte('a'),
+	std::byte('p'),
+	std::byte('s'),
+	std::byte('h'),
+	std::byte('o'),
+	std::byte('t'),
+	std::byte('s')
+};
+
+using Version = bounded::integer<0, 65535>;
+constexpr auto version = Version(1_bi);
+
+using RecordSize = bounded::integer<0, bounded::builtin_max_value<std::uint32_t>>;
+
+constexpr auto header_size = bounded::size_of<decltype(magic_string)> + bounded::size_of<Version> + 1_bi + bounded::size_of<RecordSize>;
+
+template<Generation generation>
+constexpr auto record_size = bounded::size_of<BattleSnapshot<generation>>;
+
+constexpr auto extension = std::string_view(".tmbs");
+
+template<Generation generation>
+auto write_header(std::ostream & stream) -> void {
+	write_bytes(stream, magic_string, 12_bi);
+	write_bytes(stream, version, 2_bi);
+	write_bytes(stream, generation, 1_bi);
+	write_bytes(stream, RecordSize(record_size<generation>), 4_bi);
+}
+
+auto snapshot_path(std::filesystem::path const & directory, std::string_view const room) -> std::filesystem::path {
+	auto path = directory / room;
+	path += extension;
+	return path;
+}
+
+auto read_snapshot(std::filesystem::path const & path) -> GenerationGeneric<BattleSnapshot> {
+	auto const file_size = std::filesystem::file_size(path);
+	if (file_size < static_cast<std::uintmax_t>(header_size)) {
+		throw std::runtime_error("File is too small to be a tmbs file");
+	}
+	auto file = open_binary_file_for_reading(path);
+	if (read_bytes(file, containers::size(magic_string)) != magic_string) {
+		throw std::runtime_error("Invalid magic string, this is not a tmbs file");
+	}
+	if (read<Version>(file) != version) {
+		throw std::runtime_error("Invalid version");
+	}
+	auto const generation = read<Generation>(file);
+	return constant_generation(generation, [&]<Generation g>(constant_gen_t<g>) -> GenerationGeneric<BattleSnapshot> {
+		if (read<RecordSize>(file) != record_size<g> or file_size != static_cast<std::uintmax_t>(header_size + record_size<g>)) {
+			throw std::runtime_error("File was created by a build with a different layout");
+		}
+		return std::bit_cast<BattleSnapshot<g>>(read_bytes(file, record_size<g>));
+	});
+}
+
+export struct LoadedSnapshot {
+	containers::string room;
+	GenerationGeneric<BattleSnapshot> snapshot;
+};
+
+// Snapshots that cannot be read are deleted so that they are reported only
+// once
+export auto load_battle_snapshots(std::filesystem::path const & directory) -> containers::vector<LoadedSnapshot> {
+	auto result = containers::vector<LoadedSnapshot>();
+	if (!std::filesystem::exists(directory)) {
+		return result;
+	}
+	for (auto const & entry : std::filesystem::directory_iterator(directory)) {
+		auto const & path = entry.path();
+		if (!entry.is_regular_file() or path.extension() != extension) {
+			continue;
+		}
+		try {
+			containers::push_back(result, LoadedSnapshot(
+				containers::string(path.stem().string()),
+				read_snapshot(path)
+			));
+		} catch (std::exception const & ex) {
+			std::cerr << "Unable to load battle snapshot " << path.string() << ": " << ex.what() << '\n';
+			std::filesystem::remove(path);
+		}
+	}
+	return result;
+}
+
+// Room names from the server are much shorter than this. Storing the name
+// inline means queueing a snapshot does not allocate.
+constexpr auto max_room_size = 128_bi;
+using RoomName = containers::static_vector<char, max_room_size>;
+
+struct SnapshotEntry {
+	RoomName room;
+	// Empty to delete the room's snapshot
+	tv::optional<GenerationGeneric<BattleSnapshot>> snapshot;
+};
+
+// Writes the snapshot of each battle room on a background thread, so the
+// thread that reads from the server never waits on the disk. When a room has
+// several snapshots waiting, only the newest is written.
+//
+// The queue and the batch the background thread writes from both have room
+// for `max_queued_entries` snapshots when the writer is constructed, and the
+// two are swapped rather than reallocated, so queueing a snapshot never
+// allocates. When the queue is full, queueing blocks until the background
+// thread takes it.
+//
+// Each snapshot is written to a temporary file that then replaces the old
+// snapshot, so a crash while writing leaves the previous snapshot intact.
+export struct BattleSnapshotWriter {
+	explicit BattleSnapshotWriter(std::filesystem::path directory):
+		m_directory(std::move(directory)),
+		m_pending(containers::reserve_space_for(max_queued_entries)),
+		m_thread([&](std::stop_token token) {
+			auto batch = containers::vector<SnapshotEntry>(containers::reserve_space_for(max_queued_entries));
+			while (take_pending(token, batch)) {
+				write_all(batch);
+				batch.clear();
+			}
+		})
+	{
+	}
+	BattleSnapshotWriter(BattleSnapshotWriter &&) = delete;
+	BattleSnapshotWriter(BattleSnapshotWriter const &) = delete;
+	auto operator=(BattleSnapshotWriter &&) -> BattleSnapshotWriter & = delete;
+	auto operator=(BattleSnapshotWriter const &) -> BattleSnapshotWriter & = delete;
+
+	auto write(Room const room, GenerationGeneric<BattleSnapshot> const & snapshot) -> void {
+		push(room, snapshot);
+	}
+
+	auto remove(Room const room) -> void {
+		push(room, tv::none);
+	}
+
+private:
+	static constexpr auto max_queued_entries = bounded::constant<1'000>;
+
+	// A room with a name that does not fit is never saved
+	auto push(Room const room, tv::optional<GenerationGeneric<BattleSnapshot>> snapshot) -> void {
+		if (containers::size(room) > max_room_size) {
+			return;
+		}
+		{
+			auto lock = std::unique_lock(m_mutex);
+			m_space_available.wait(lock, [&] { return containers::size(m_pending) < max_queued_entries; });
+			containers::push_back(m_pending, SnapshotEntry(RoomName(room), std::move(snapshot)));
+		}
+		m_pending_changed.notify_one();
+	}
+
+	// Only called by the background thread. Returns false once stop is
+	// requested and everything pushed before that has been taken.
+	auto take_pending(std::stop_token const & token, containers::vector<SnapshotEntry> & batch) -> bool {
+		{
+			auto lock = std::unique_lock(m_mutex);
+			m_pending_changed.wait(lock, token, [&] { return !containers::is_empty(m_pending); });
+			if (containers::is_empty(m_pending)) {
+				return false;
+			}
+			std::swap(batch, m_pending);
+		}
+		m_space_available.notify_all();
+		return true;
+	}
+
+	// Only called by the background thread
+	auto write_one(std::string_view const room, tv::optional<GenerationGeneric<BattleSnapshot>> const & snapshot) const -> void {
+		auto const path = snapshot_path(m_directory, room);
+		if (!snapshot) {
+			std::filesystem::remove(path);
+			return;
+		}
+		auto temporary = path;
+		temporary += ".tmp";
+		{
+			auto stream = open_binary_file_for_writing(temporary);
+			tv::visit(*snapshot, [&]<Generation generation>(BattleSnapshot<generation> const & value) {
+				write_header<generation>(stream);
+				write_bytes(stream, value, record_size<generation>);
+			});
+		}
+		std::filesystem::rename(temporary, path);
+	}
+
+	// Only called by the background thread
+	auto write_all(auto const & entries) const -> void {
+		auto written = containers::vector<std::string_view>();
+		for (auto it = containers::end(entries); it != containers::begin(entries); ) {
+			--it;
+			auto const room = std::string_view(containers::data(it->room), static_cast<std::size_t>(containers::size(it->room)));
+			if (containers::any_equal(written, room)) {
+				continue;
+			}
+			containers::push_back(written, room);
+			try {
+				write_one(room, it->snapshot);
+			} catch (std::exception const & ex) {
+				std::cerr << "Unable to write battle snapshot: " << ex.what() << '\n';
+			}
+		}
+	}
+
+	std::filesystem::path m_directory;
+	std::mutex m_mutex;
+	std::condition_variable m_space_available;
+	std::condition_variable_any m_pending_changed;
+	// Swapped with the background thread's batch, which has the same capacity
+	containers::vector<SnapshotEntry> m_pending;
+	// Declared last so the thread is joined before anything it uses is
+	// destroyed
+	std::jthread m_thread;
+};
+
+} // namespace technicalmachine::ps
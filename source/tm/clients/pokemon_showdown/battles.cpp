@@ -8,6 +8,7 @@ export module tm.clients.ps.battles;
 import tm.clients.ps.action_required;
 import tm.clients.ps.battle_init_message;
 import tm.clients.ps.battle_manager;
+import tm.clients.ps.battle_snapshot;
 import tm.clients.ps.battle_started;
 import tm.clients.ps.parsed_message;
 import tm.clients.ps.parsed_request;
@@ -17,6 +18,9 @@ import tm.clients.ps.start_of_turn;
 import tm.clients.battle_already_finished;
 import tm.clients.battle_continues;
 import tm.clients.battle_finished;
+import tm.clients.turn_count;
+
+import tm.generation_generic;
 
 import bounded;
 import containers;
@@ -41,6 +45,25 @@ export struct Battles {
 		}
 	}
 
+	// Picks up a battle where a snapshot left off, before the server has sent
+	// anything
+	constexpr auto restore_battle(
+		Room const room,
+		GenerationGeneric<BattleSnapshot> const & snapshot
+	) -> void {
+		auto const inserted = m_container.lazy_insert(
+			containers::string(room),
+			[&] { return BattleManager(snapshot); }
+		).inserted;
+		if (!inserted) {
+			throw std::runtime_error("Tried to restore an existing battle");
+		}
+	}
+
+	constexpr auto erase(Room const room) -> void {
+		containers::keyed_erase(m_container, room);
+	}
+
 	constexpr auto handle_request(
 		Room const room,
 		ParsedRequest const & message
@@ -78,6 +101,14 @@ export struct Battles {
 		);
 	}
 
+	constexpr auto snapshot(Room const room, TurnCount const turn_count) const -> GenerationGeneric<BattleSnapshot> {
+		auto const battle = containers::lookup(m_container, room);
+		if (!battle) {
+			throw std::runtime_error("Tried to snapshot a battle that does not exist");
+		}
+		return battle->snapshot(turn_count);
+	}
+
 private:
 	containers::linear_map<containers::string, BattleManager> m_container;
 };
@@ -21,7 +21,7 @@ namespace technicalmachine::ps {
 
 export struct Client {
 	Client(SettingsFile settings, Strategy strategy):
-		m_sockets(settings.host, settings.port, settings.resource),
+		m_sockets(settings.host, settings.port, settings.resource, settings.secure),
 		m_impl(
 			std::move(settings),
 			get_battles_directory(),
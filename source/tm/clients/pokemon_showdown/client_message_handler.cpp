@@ -7,16 +7,18 @@ export module tm.clients.ps.client_message_handler;
 
 import tm.clients.ps.action_required;
 import tm.clients.ps.battle_init_message;
+import tm.clients.ps.battle_logger;
 import tm.clients.ps.battle_message_kind;
 import tm.clients.ps.battle_response_switch;
+import tm.clients.ps.battle_snapshot_file;
 import tm.clients.ps.battle_started;
 import tm.clients.ps.battles;
 import tm.clients.ps.event_block;
-import tm.clients.ps.log_battle_messages;
 import tm.clients.ps.is_chat_message_block;
 import tm.clients.ps.in_message;
 import tm.clients.ps.make_battle_init_message;
 import tm.clients.ps.message_block;
+import tm.clients.ps.message_type;
 import tm.clients.ps.parse_generation_from_format;
 import tm.clients.ps.parse_request;
 import tm.clients.ps.parsed_message;
@@ -46,7 +48,6 @@ import tm.constant_generation;
 import tm.generation;
 import tm.generation_generic;
 import tm.nlohmann_json;
-import tm.open_file;
 import tm.settings_file;
 
 import bounded;
@@ -100,8 +101,31 @@ constexpr auto is_battle_message(Room const room) -> bool {
 	return containers::starts_with(room, "battle-"_s);
 }
 
-auto print_begin_turn(std::ostream & stream, TurnCount const turn_count) -> void {
-	stream << containers::string(containers::repeat_n(20_bi, '=')) << "\nBegin turn " << turn_count << '\n';
+// The predictor refers to the usage stats, so they are kept alive together
+struct BattlePredictor {
+	explicit BattlePredictor(LoadedUsageStats usage_stats_):
+		usage_stats(std::move(usage_stats_)),
+		team_predictor(*usage_stats)
+	{
+	}
+	LoadedUsageStats usage_stats;
+	IncrementalTeamPredictor team_predictor;
+};
+
+auto log_begin_turn(BattleLogger & logger, Room const room, TurnCount const turn_count) -> void {
+	auto buffer = std::array<char, 20>();
+	auto const result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), static_cast<std::uint64_t>(turn_count));
+	logger.write(
+		room,
+		BattleLogFile::analysis,
+		"====================\nBegin turn "_s,
+		std::string_view(buffer.data(), result.ptr),
+		"\n"_s
+	);
+}
+
+auto snapshot_directory(std::filesystem::path const & battles_directory) -> std::filesystem::path {
+	return battles_directory / "snapshots";
 }
 
 export struct ClientMessageHandler {
@@ -115,11 +139,14 @@ export struct ClientMessageHandler {
 		m_random_engine(std::random_device()()),
 		m_strategy(std::move(strategy)),
 		m_settings(std::move(settings)),
-		m_battles_directory(std::move(battles_directory)),
+		m_logger(std::make_unique<BattleLogger>(battles_directory)),
+		m_snapshots(std::make_unique<BattleSnapshotWriter>(snapshot_directory(battles_directory))),
 		m_send_message(std::move(send_message)),
 		m_authenticate(std::move(authenticate)),
 		m_should_start_timer(m_settings.style.index() == bounded::type<SettingsFile::Ladder>)
 	{
+		prefetch_usage_stats();
+		restore_battles(snapshot_directory(battles_directory));
 	}
 	ClientMessageHandler(ClientMessageHandler &&) = default;
 	ClientMessageHandler(ClientMessageHandler const &) = delete;
@@ -131,7 +158,13 @@ export struct ClientMessageHandler {
 		auto const messages = message_block(block.str());
 		if (is_chat_message_block(messages)) {
 		} else if (is_battle_message(block.room())) {
-			log_battle_messages(m_battles_directory, block);
+			// The resync block repeats the battle so far, which is already in
+			// the log
+			if (auto const turn_count = containers::lookup(m_restored_rooms, block.room())) {
+				resume_battle(block.room(), *turn_count, messages);
+				return;
+			}
+			log_battle_messages(*m_logger, block);
 			auto const first = containers::begin(messages);
 			auto const first_message = *first;
 			auto const has_more_data = containers::next(first) != containers::end(messages);
@@ -168,6 +201,43 @@ export struct ClientMessageHandler {
 	}
 
 private:
+	auto restore_battles(std::filesystem::path const & directory) -> void {
+		for (auto const & loaded : load_battle_snapshots(directory)) {
+			m_battles.restore_battle(loaded.room, loaded.snapshot);
+			auto const turn_count = tv::visit(loaded.snapshot, [](auto const & value) { return value.turn_count; });
+			m_restored_rooms.lazy_insert(loaded.room, [=] { return turn_count; });
+		}
+	}
+
+	auto rejoin_battles() -> void {
+		for (auto const & room : m_restored_rooms) {
+			m_send_message(containers::concatenate<containers::string>("|/join "_s, room.key));
+		}
+	}
+
+	// After rejoining a room, the first thing the server sends is the entire
+	// battle so far as one block. The snapshot is used only if it was taken at
+	// the start of the last turn in that block. Otherwise the client missed
+	// part of the battle and cannot continue it.
+	auto resume_battle(Room const room, TurnCount const snapshot_turn, auto const messages) -> void {
+		auto last_turn = tv::optional<TurnCount>();
+		for (auto message : messages) {
+			if (parse_message_type(message.type()) == MessageType::turn) {
+				last_turn = bounded::to_integer<TurnCount>(message.pop());
+			}
+		}
+		containers::keyed_erase(m_restored_rooms, room);
+		if (last_turn and *last_turn == snapshot_turn) {
+			std::cout << "Resumed " << room << " on turn " << containers::to_string(snapshot_turn) << '\n';
+			return;
+		}
+		std::cerr << "Unable to resume " << room << ": snapshot is from turn " << containers::to_string(snapshot_turn) << '\n';
+		m_battles.erase(room);
+		m_snapshots->remove(room);
+		m_logger->close(room);
+		send_message("|/leave "_s, room);
+	}
+
 	auto send_team(Generation const generation) -> void {
 		auto const team = get_team(generation, m_settings.team, m_all_usage_stats, m_random_engine);
 		auto const team_str = team ? to_packed_format(*team) : "null"_s;
@@ -179,6 +249,19 @@ private:
 		m_send_message(containers::concatenate<containers::string>(strings...));
 	}
 
+	// Accepting challenges can be in any format, so those load on demand
+	auto prefetch_usage_stats() const -> void {
+		tv::visit(m_settings.style, tv::overload(
+			[&](SettingsFile::Ladder const & ladder) {
+				m_all_usage_stats.prefetch(parse_generation_from_format(ladder.format, "gen"_s));
+			},
+			[&](SettingsFile::Challenge const & challenge) {
+				m_all_usage_stats.prefetch(parse_generation_from_format(challenge.format, "gen"_s));
+			},
+			[](SettingsFile::Accept const &) {}
+		));
+	}
+
 	auto send_challenge() -> void {
 		tv::visit(m_settings.style, tv::overload(
 			[&](SettingsFile::Ladder const & ladder) {
@@ -198,13 +281,16 @@ private:
 		auto const result = m_battles.handle_message(room, message);
 		tv::visit(result, tv::overload(
 			[&](StartOfTurn const value) {
-				auto file = analysis_log_file(room);
-				print_begin_turn(file, value.turn_count);
+				log_begin_turn(*m_logger, room, value.turn_count);
+				m_snapshots->write(room, m_battles.snapshot(room, value.turn_count));
 			},
 			[](BattleContinues) {
 			},
 			[&](BattleFinished) {
-				m_send_message(containers::concatenate<containers::string>("|/leave "_s, room));
+				containers::keyed_erase(m_predictors, room);
+				m_logger->close(room);
+				m_snapshots->remove(room);
+				send_message("|/leave "_s, room);
 				send_challenge();
 			},
 			[](BattleAlreadyFinished) {
@@ -214,22 +300,34 @@ private:
 
 	auto handle_battle_request(Room const room, ParsedRequest const & message) -> void {
 		auto const value = m_battles.handle_request(room, message);
-		auto file = analysis_log_file(room);
+		auto analysis = std::stringstream();
+		auto & predictor = containers::get_mapped(*m_predictors.lazy_insert(
+			containers::string(room),
+			[&] { return BattlePredictor(m_all_usage_stats[get_generation(value.state)]); }
+		).iterator);
 		auto const selection = determine_selection(
 			value.state,
-			file,
-			m_all_usage_stats,
+			analysis,
+			predictor.team_predictor,
 			m_strategy,
 			m_random_engine
 		);
-		send_selection(selection, m_send_message, room, value.slot_memory);
+		send_selection(selection, m_send_message, m_send_buffer, room, value.slot_memory);
 		// Theoretically we could turn off the timer before thinking and
 		// then turn it back on after sending a response, but that seems
 		// like it would be annoying for the human opponent.
 		if (m_should_start_timer) {
-			m_send_message(containers::concatenate<containers::string>(room, "|/timer on"_s));
+			send_message(room, "|/timer on"_s);
 			m_should_start_timer = false;
 		}
+		m_logger->write(room, BattleLogFile::analysis, analysis.view());
+	}
+
+	// Builds the message in `m_send_buffer`, which keeps its capacity
+	auto send_message(auto const & ... parts) -> void {
+		m_send_buffer.clear();
+		(..., containers::append(m_send_buffer, parts));
+		m_send_message(m_send_buffer);
 	}
 
 	auto handle_error_message(Room const room, containers::string_view const error) const -> void {
@@ -243,61 +341,80 @@ private:
 	}
 
 	auto handle_message(Room const room, InMessage message) -> void {
-		auto const type = message.type();
-		if (type == "b"_s or type == "B"_s or type == "battle"_s) {
-			// message.remainder() == ROOMID|username|username
-		} else if (type == "challstr"_s) {
-			authenticate(message.remainder());
-			// After logging in, send "|/search FORMAT_NAME" to begin laddering
-			send_challenge();
-		} else if (type == "formats"_s) {
-			// message.remainder() == | separated list of formats with special rules
-		} else if (type == "html"_s) {
-			// message.remainder() == HTML
-		} else if (type == "init"_s) {
-		} else if (type == "nametaken"_s) {
-			auto const username = message.pop();
-			std::cerr << "Could not change username to " << username << " because: " << message.remainder() << '\n';
-		} else if (type == "popup"_s) {
-			std::cout << "popup message: " << message.remainder() << '\n';
-		} else if (type == "pm"_s) {
-			auto const from = message.pop();
-			if (no_spaces_string_view(from) == no_spaces_string_view(m_settings.username)) {
-				return;
+		switch (parse_message_type(message.type())) {
+			case MessageType::battle:
+				// message.remainder() == ROOMID|username|username
+				break;
+			case MessageType::challstr:
+				authenticate(message.remainder());
+				rejoin_battles();
+				// After logging in, send "|/search FORMAT_NAME" to begin laddering
+				send_challenge();
+				break;
+			case MessageType::formats:
+				// message.remainder() == | separated list of formats with special rules
+				break;
+			case MessageType::html:
+				// message.remainder() == HTML
+				break;
+			case MessageType::init:
+				break;
+			case MessageType::nametaken: {
+				auto const username = message.pop();
+				std::cerr << "Could not change username to " << username << " because: " << message.remainder() << '\n';
+				break;
 			}
-			auto const to = message.pop();
-			auto const initial_message = message.pop();
-			if (containers::starts_with(initial_message, "/challenge"_s)) {
-				auto const format = message.pop();
-				if (containers::is_empty(format)) {
+			case MessageType::popup:
+				std::cout << "popup message: " << message.remainder() << '\n';
+				break;
+			case MessageType::pm: {
+				auto const from = message.pop();
+				if (no_spaces_string_view(from) == no_spaces_string_view(m_settings.username)) {
 					return;
 				}
-				if (should_accept_challenge(m_settings.style, no_spaces_string_view(from))) {
-					send_request_battle_start(format, "|/accept "_s, from);
+				auto const to = message.pop();
+				auto const initial_message = message.pop();
+				if (containers::starts_with(initial_message, "/challenge"_s)) {
+					auto const format = message.pop();
+					if (containers::is_empty(format)) {
+						return;
+					}
+					if (should_accept_challenge(m_settings.style, no_spaces_string_view(from))) {
+						send_request_battle_start(format, "|/accept "_s, from);
+					} else {
+						m_send_message(containers::concatenate<containers::string>("|/reject "_s, from));
+					}
 				} else {
-					m_send_message(containers::concatenate<containers::string>("|/reject "_s, from));
+					std::cout << "PM from " << from << " to " << to << ": " << initial_message;
+					if (!containers::is_empty(message.remainder())) {
+						std::cout << '|' << message.remainder();
+					}
+					std::cout << '\n';
 				}
-			} else {
-				std::cout << "PM from " << from << " to " << to << ": " << initial_message;
-				if (!containers::is_empty(message.remainder())) {
-					std::cout << '|' << message.remainder();
-				}
-				std::cout << '\n';
+				break;
 			}
-		} else if (type == "queryresponse"_s) {
-			// message.remainder() == QUERYTYPE|JSON
-		} else if (type == "uhtml"_s or type == "uhtmlchange"_s) {
-			// message.remainder() == NAME|HTML
-		} else if (type == "updateuser"_s) {
-			// message.remainder() == username|guest ? 0 : 1|AVATAR
-		} else if (type == "updatesearch"_s) {
-			// message.remainder() == JSON: battles you are searching for
-		} else if (type == "usercount"_s) {
-			// message.remainder() == number of users on server
-		} else if (type == "users"_s) {
-			// message.remainder() == comma separated list of users
-		} else {
-			std::cerr << "Received unknown message in room: " << room << " |" << type << '|' << message.remainder() << '\n';
+			case MessageType::queryresponse:
+				// message.remainder() == QUERYTYPE|JSON
+				break;
+			case MessageType::uhtml:
+			case MessageType::uhtmlchange:
+				// message.remainder() == NAME|HTML
+				break;
+			case MessageType::updateuser:
+				// message.remainder() == username|guest ? 0 : 1|AVATAR
+				break;
+			case MessageType::updatesearch:
+				// message.remainder() == JSON: battles you are searching for
+				break;
+			case MessageType::usercount:
+				// message.remainder() == number of users on server
+				break;
+			case MessageType::users:
+				// message.remainder() == comma separated list of users
+				break;
+			default:
+				std::cerr << "Received unknown message in room: " << room << " |" << message.type() << '|' << message.remainder() << '\n';
+				break;
 		}
 	}
 
@@ -319,21 +436,26 @@ private:
 		m_send_message(containers::concatenate<containers::string>("|/trn "_s, m_settings.username, ",0,"_s, json.at("assertion").get<std::string_view>()));
 	}
 
-	auto analysis_log_file(Room const room) -> std::fstream {
-		return open_text_file(m_battles_directory / std::filesystem::path(room) / "analysis.txt");
-	}
-
 	std::mt19937 m_random_engine;
 
 	AllUsageStats m_all_usage_stats;
+	containers::linear_map<containers::string, BattlePredictor> m_predictors;
 	Strategy m_strategy;
 
 	SettingsFile m_settings;
 
-	std::filesystem::path m_battles_directory;
+	// The logger and the snapshot writer each own a thread that refers to
+	// them, so they cannot move
+	std::unique_ptr<BattleLogger> m_logger;
+	std::unique_ptr<BattleSnapshotWriter> m_snapshots;
 	Battles m_battles;
+	// Battles restored from a snapshot that the server has not yet resent
+	containers::linear_map<containers::string, TurnCount> m_restored_rooms;
 
 	SendMessageFunction m_send_message;
+	// Reused for every outgoing battle message so that sending does not
+	// allocate
+	containers::string m_send_buffer;
 	AuthenticationFunction m_authenticate;
 
 	bool m_should_start_timer;
@@ -7,6 +7,7 @@ export module tm.clients.ps.event_block;
 
 import tm.clients.ps.in_message;
 import tm.clients.ps.make_party;
+import tm.clients.ps.message_type;
 import tm.clients.ps.party_from_player_id;
 import tm.clients.ps.parse_effect_source;
 import tm.clients.ps.parse_set_hp_message;
@@ -77,509 +78,530 @@ constexpr auto party_from_side_id(containers::string_view const str) -> Party {
 }
 
 constexpr auto parse_message(InMessage message) -> tv::optional<ParsedMessage> {
-	auto const type = message.type();
-	if (type == ""_s) {
-		return SeparatorMessage();
-	} else if (type == "-ability"_s) {
-		auto const party = party_from_player_id(message.pop());
-		auto const ability = from_string<Ability>(message.pop());
-		auto const source = parse_from_source(message.pop());
-		return tv::visit(source, tv::overload(
-			[&](MainEffect) -> AbilityMessage {
-				return AbilityMessage(party, ability);
-			},
-			[&](Ability const source_ability) -> AbilityMessage {
-				switch (source_ability) {
-					case Ability::Trace:
-						return AbilityMessage(party, source_ability, ability);
-					default:
-						throw std::runtime_error("Invalid ability to get another ability");
+	switch (parse_message_type(message.type())) {
+		case MessageType::empty:
+			return SeparatorMessage();
+		case MessageType::minor_ability: {
+			auto const party = party_from_player_id(message.pop());
+			auto const ability = from_string<Ability>(message.pop());
+			auto const source = parse_from_source(message.pop());
+			return tv::visit(source, tv::overload(
+				[&](MainEffect) -> AbilityMessage {
+					return AbilityMessage(party, ability);
+				},
+				[&](Ability const source_ability) -> AbilityMessage {
+					switch (source_ability) {
+						case Ability::Trace:
+							return AbilityMessage(party, source_ability, ability);
+						default:
+							throw std::runtime_error("Invalid ability to get another ability");
+					}
+				},
+				[](auto) -> AbilityMessage {
+					throw std::runtime_error("Invalid ability source");
 				}
-			},
-			[](auto) -> AbilityMessage {
-				throw std::runtime_error("Invalid ability source");
-			}
-		));
-	} else if (type == "-activate"_s) {
-		// We can intentionally get a blank player ID when Splash "activates"
-		auto const player_id = message.pop();
-		auto const [category, source] = split_view(message.pop(), ": "_s);
-		auto const details = message.pop();
-		return tv::visit(parse_effect_source(category, source), tv::overload(
-			[](MainEffect) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Unexpected -activate source MainEffect");
-			},
-			[&](FromBide) -> tv::optional<ParsedMessage> {
+			));
+		}
+		case MessageType::minor_activate: {
+			// We can intentionally get a blank player ID when Splash "activates"
+			auto const player_id = message.pop();
+			auto const [category, source] = split_view(message.pop(), ": "_s);
+			auto const details = message.pop();
+			return tv::visit(parse_effect_source(category, source), tv::overload(
+				[](MainEffect) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Unexpected -activate source MainEffect");
+				},
+				[&](FromBide) -> tv::optional<ParsedMessage> {
+					return MoveMessage(
+						party_from_player_id(player_id),
+						MoveName::Bide,
+						false,
+						false
+					);
+				},
+				[](FromConfusion) -> tv::optional<ParsedMessage> {
+					// This means that I did not snap out of confusion
+					// TODO: Should I send this as a message?
+					return tv::none;
+				},
+				[](FromDisable) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Unexpected -activate source FromDisable");
+				},
+				[](FromEntryHazards) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Unexpected -activate source FromEntryHazards");
+				},
+				[](FromMiscellaneous) -> tv::optional<ParsedMessage> {
+					return tv::none;
+				},
+				[](FromMove) -> tv::optional<ParsedMessage> {
+					return tv::none;
+				},
+				[](FromRecoil) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Unexpected -activate source FromRecoil");
+				},
+				[&](FromSubstitute) -> tv::optional<ParsedMessage> {
+					return DamageSubstituteMessage(party_from_player_id(player_id));
+				},
+				[&](Ability const ability) -> tv::optional<ParsedMessage> {
+					switch (ability) {
+						case Ability::Forewarn:
+							return ForewarnMessage(
+								party_from_player_id(player_id),
+								from_string<MoveName>(details)
+							);
+						case Ability::Shed_Skin:
+							return ShedSkinMessage(party_from_player_id(player_id));
+						default:
+							return AbilityMessage(party_from_player_id(player_id), ability);
+					}
+				},
+				[&](Item const item) -> tv::optional<ParsedMessage> {
+					return ItemMessage(party_from_player_id(player_id), item);
+				}
+			));
+		}
+		case MessageType::minor_anim:
+			return tv::none;
+		case MessageType::minor_boost:
+			// TODO: Acupressure?
+			return tv::none;
+		case MessageType::cant: {
+			auto const party = party_from_player_id(message.pop());
+			auto const reason = message.pop();
+			if (reason == "Disable"_s) {
+				auto const move_str = message.pop();
 				return MoveMessage(
-					party_from_player_id(player_id),
-					MoveName::Bide,
-					false,
+					party,
+					from_string<MoveName>(move_str),
 					false
 				);
-			},
-			[](FromConfusion) -> tv::optional<ParsedMessage> {
-				// This means that I did not snap out of confusion
-				// TODO: Should I send this as a message?
-				return tv::none;
-			},
-			[](FromDisable) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Unexpected -activate source FromDisable");
-			},
-			[](FromEntryHazards) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Unexpected -activate source FromEntryHazards");
-			},
-			[](FromMiscellaneous) -> tv::optional<ParsedMessage> {
-				return tv::none;
-			},
-			[](FromMove) -> tv::optional<ParsedMessage> {
-				return tv::none;
-			},
-			[](FromRecoil) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Unexpected -activate source FromRecoil");
-			},
-			[&](FromSubstitute) -> tv::optional<ParsedMessage> {
-				return DamageSubstituteMessage(party_from_player_id(player_id));
-			},
-			[&](Ability const ability) -> tv::optional<ParsedMessage> {
-				switch (ability) {
-					case Ability::Forewarn:
-						return ForewarnMessage(
-							party_from_player_id(player_id),
-							from_string<MoveName>(details)
-						);
-					case Ability::Shed_Skin:
-						return ShedSkinMessage(party_from_player_id(player_id));
-					default:
-						return AbilityMessage(party_from_player_id(player_id), ability);
-				}
-			},
-			[&](Item const item) -> tv::optional<ParsedMessage> {
-				return ItemMessage(party_from_player_id(player_id), item);
+			} else if (reason == "flinch"_s) {
+				return FlinchMessage(party);
+			} else if (reason == "Focus Punch"_s) {
+				return FocusPunchMessage(party);
+			} else if (reason == "frz"_s) {
+				return FrozenSolidMessage(party);
+			} else if (reason == "par"_s) {
+				return FullyParalyzedMessage(party);
+			} else if (reason == "partiallytrapped"_s) {
+				return ImmobilizedMessage(party);
+			} else if (reason == "slp"_s) {
+				return StillAsleepMessage(party);
+			} else if (reason == "recharge"_s) {
+				return RechargingMessage(party);
+			} else {
+				throw std::runtime_error(containers::concatenate<std::string>(
+					"Received unknown \"cant\" reason: "_s,
+					reason
+				));
 			}
-		));
-	} else if (type == "-anim"_s) {
-		return tv::none;
-	} else if (type == "-boost"_s) {
-		// TODO: Acupressure?
-		return tv::none;
-	} else if (type == "cant"_s) {
-		auto const party = party_from_player_id(message.pop());
-		auto const reason = message.pop();
-		if (reason == "Disable"_s) {
+		}
+		case MessageType::minor_center:
+			return tv::none;
+		case MessageType::minor_clearallboost:
+			return tv::none;
+		case MessageType::minor_crit: {
+			auto const party = other(party_from_player_id(message.pop()));
+			return CriticalHitMessage(party);
+		}
+		case MessageType::minor_curestatus: {
+			auto const party = party_from_player_id(message.pop());
+			auto const status = parse_status(message.pop());
+			auto const source = parse_from_source(message.pop());
+			return tv::visit(source, tv::overload(
+				[&](MainEffect) -> tv::optional<ParsedMessage> {
+					return StatusClearMessage(party, status);
+				},
+				[&](Ability const ability) -> tv::optional<ParsedMessage> {
+					switch (ability) {
+						case Ability::Natural_Cure:
+							return AbilityMessage(party, ability);
+						default:
+							throw std::runtime_error("Unexpected ability cured status");
+					}
+				},
+				[](auto) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Unexpected -curestatus source");
+				}
+			));
+		}
+		case MessageType::minor_cureteam:
+			return tv::none;
+		case MessageType::minor_damage: {
+			auto const parsed = parse_set_hp_message(message);
+			return tv::visit(parsed.source, tv::overload(
+				[&](MainEffect) -> tv::optional<ParsedMessage> {
+					return DamageMessage(parsed.party, parsed.status, parsed.hp);
+				},
+				[](FromBide) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Damage should come in separately from Bide message");
+				},
+				[&](FromConfusion) -> tv::optional<ParsedMessage> {
+					return HitSelfMessage(parsed.party, parsed.status, parsed.hp);
+				},
+				[](FromDisable) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Invalid -damage source of FromDisable");
+				},
+				[&](FromEntryHazards) -> tv::optional<ParsedMessage> {
+					return HPMessage(parsed.party, parsed.status, parsed.hp);
+				},
+				[&](FromMiscellaneous) -> tv::optional<ParsedMessage> {
+					return HPMessage(parsed.party, parsed.status, parsed.hp);
+				},
+				[&](FromRecoil) -> tv::optional<ParsedMessage> {
+					return RecoilMessage(parsed.party, parsed.status, parsed.hp);
+				},
+				[&](Item const value) -> tv::optional<ParsedMessage> {
+					return ItemMessage(parsed.party, value);
+				},
+				[&](Ability const value) -> tv::optional<ParsedMessage> {
+					// TODO: Do we need get the actual source from the remainder?
+					return AbilityMessage(other(parsed.party), value);
+				},
+				[](FromMove) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Invalid -damage source");
+				},
+				[](FromSubstitute) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Invalid -damage source");
+				}
+			));
+		}
+		case MessageType::detailschange:
+		case MessageType::minor_formechange:
+			// TODO
+			return tv::none;
+		case MessageType::minor_end: {
+			auto const party = party_from_player_id(message.pop());
+			// https://github.com/llvm/llvm-project/issues/72828
+			auto const temp = split_view(message.pop(), ": "_s);
+			auto const effect_type = temp.first;
+			auto const other = temp.second;
+			return tv::visit(parse_effect_source(effect_type, ""_s), tv::overload(
+				[&](FromSubstitute) -> tv::optional<ParsedMessage> {
+					return DestroySubstituteMessage(party);
+				},
+				[&](FromConfusion) -> tv::optional<ParsedMessage> {
+					return ConfusionEndedMessage(party);
+				},
+				[&](FromDisable) -> tv::optional<ParsedMessage> {
+					return DisableEndedMessage(party);
+				},
+				[&](FromBide) -> tv::optional<ParsedMessage> {
+					return MoveMessage(
+						party,
+						MoveName::Bide,
+						false,
+						true
+					);
+				},
+				[](FromMiscellaneous) -> tv::optional<ParsedMessage> {
+					return tv::none;
+				},
+				[&](FromMove) -> tv::optional<ParsedMessage> {
+					auto const move = from_string<MoveName>(other);
+					switch (move) {
+						case MoveName::Taunt:
+							return TauntEndedMessage(party);
+						default:
+							return tv::none;
+					}
+				},
+				[](auto) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Unexpected -end source");
+				}
+			));
+		}
+		case MessageType::minor_endability:
+			return tv::none;
+		case MessageType::minor_enditem: {
+			auto const party = party_from_player_id(message.pop());
+			auto const item = from_string<Item>(message.pop());
+			return ItemMessage(party, item);
+		}
+		case MessageType::minor_fail:
+			return tv::none;
+		case MessageType::faint:
+			return tv::none;
+		case MessageType::minor_fieldactivate:
+			return tv::none;
+		case MessageType::minor_fieldend:
+			return tv::none;
+		case MessageType::minor_fieldstart:
+			return tv::none;
+		case MessageType::minor_heal: {
+			auto const parsed = parse_set_hp_message(message);
+			auto const party = parsed.party;
+			return tv::visit(parsed.source, tv::overload(
+				[&](MainEffect) -> tv::optional<ParsedMessage> {
+					return HPMessage(party, parsed.status, parsed.hp);
+				},
+				[&](FromMiscellaneous) -> tv::optional<ParsedMessage> {
+					return HPMessage(party, parsed.status, parsed.hp);
+				},
+				[&](FromMove) -> tv::optional<ParsedMessage> {
+					return HPMessage(party, parsed.status, parsed.hp);
+				},
+				[&](Ability const value) -> tv::optional<ParsedMessage> {
+					return HPMessage(party, parsed.status, parsed.hp, value);
+				},
+				[&](Item const value) -> tv::optional<ParsedMessage> {
+					return HPMessage(party, parsed.status, parsed.hp, value);
+				},
+				[](auto) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Invalid heal source");
+				}
+			));
+		}
+		case MessageType::minor_hint:
+			return tv::none;
+		case MessageType::minor_hitcount:
+			return tv::none;
+		case MessageType::minor_immune: {
+			auto const party = party_from_player_id(message.pop());
+			auto const source = parse_from_source(message.pop());
+			return tv::visit(source, tv::overload(
+				[&](MainEffect) -> tv::optional<ParsedMessage> {
+					return EffectivenessMessage(
+						party,
+						EffectivenessMessage::immune
+					);
+				},
+				[&](Item const value) -> tv::optional<ParsedMessage> {
+					return ItemMessage(party, value);
+				},
+				[&](Ability const value) -> tv::optional<ParsedMessage> {
+					return AbilityMessage(party, value);
+				},
+				[](auto) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Invalid immunity source");
+				}
+			));
+		}
+		case MessageType::inactiveoff:
+			// message.remainder() == MESSAGE
+			// Timer is off
+			return tv::none;
+		case MessageType::minor_item: {
+			auto const party = party_from_player_id(message.pop());
+			auto const item = from_string<Item>(message.pop());
+			return ItemMessage(party, item);
+		}
+		case MessageType::minor_mega:
+			return tv::none;
+		case MessageType::minor_message:
+			return tv::none;
+		case MessageType::minor_miss:
+			// miss information is always sent with a move as well
+			return tv::none;
+		case MessageType::move: {
+			auto const party = party_from_player_id(message.pop());
 			auto const move_str = message.pop();
+			auto const move = from_string<MoveName>(move_str);
+			[[maybe_unused]] auto const target = message.pop();
+			constexpr auto miss_str = "[miss]"_s;
+			auto const first_part = message.pop();
+			auto const first_part_is_missed = first_part == miss_str;
+			auto const second_part = message.pop();
+			auto const second_part_is_missed = second_part == miss_str;
+			auto const immobilize_continued =
+				is_immobilize(move) and
+				first_part == containers::concatenate<containers::string>("[from] "_s, move_str);
 			return MoveMessage(
 				party,
-				from_string<MoveName>(move_str),
-				false
+				move,
+				first_part_is_missed or second_part_is_missed,
+				!immobilize_continued
 			);
-		} else if (reason == "flinch"_s) {
-			return FlinchMessage(party);
-		} else if (reason == "Focus Punch"_s) {
-			return FocusPunchMessage(party);
-		} else if (reason == "frz"_s) {
-			return FrozenSolidMessage(party);
-		} else if (reason == "par"_s) {
-			return FullyParalyzedMessage(party);
-		} else if (reason == "partiallytrapped"_s) {
-			return ImmobilizedMessage(party);
-		} else if (reason == "slp"_s) {
-			return StillAsleepMessage(party);
-		} else if (reason == "recharge"_s) {
-			return RechargingMessage(party);
-		} else {
-			throw std::runtime_error(containers::concatenate<std::string>(
-				"Received unknown \"cant\" reason: "_s,
-				reason
-			));
 		}
-	} else if (type == "-center"_s) {
-		return tv::none;
-	} else if (type == "-clearallboost"_s) {
-		return tv::none;
-	} else if (type == "-crit"_s) {
-		auto const party = other(party_from_player_id(message.pop()));
-		return CriticalHitMessage(party);
-	} else if (type == "-curestatus"_s) {
-		auto const party = party_from_player_id(message.pop());
-		auto const status = parse_status(message.pop());
-		auto const source = parse_from_source(message.pop());
-		return tv::visit(source, tv::overload(
-			[&](MainEffect) -> tv::optional<ParsedMessage> {
-				return StatusClearMessage(party, status);
-			},
-			[&](Ability const ability) -> tv::optional<ParsedMessage> {
-				switch (ability) {
-					case Ability::Natural_Cure:
-						return AbilityMessage(party, ability);
-					default:
-						throw std::runtime_error("Unexpected ability cured status");
-				}
-			},
-			[](auto) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Unexpected -curestatus source");
-			}
-		));
-	} else if (type == "-cureteam"_s) {
-		return tv::none;
-	} else if (type == "-damage"_s) {
-		auto const parsed = parse_set_hp_message(message);
-		return tv::visit(parsed.source, tv::overload(
-			[&](MainEffect) -> tv::optional<ParsedMessage> {
-				return DamageMessage(parsed.party, parsed.status, parsed.hp);
-			},
-			[](FromBide) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Damage should come in separately from Bide message");
-			},
-			[&](FromConfusion) -> tv::optional<ParsedMessage> {
-				return HitSelfMessage(parsed.party, parsed.status, parsed.hp);
-			},
-			[](FromDisable) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Invalid -damage source of FromDisable");
-			},
-			[&](FromEntryHazards) -> tv::optional<ParsedMessage> {
-				return HPMessage(parsed.party, parsed.status, parsed.hp);
-			},
-			[&](FromMiscellaneous) -> tv::optional<ParsedMessage> {
-				return HPMessage(parsed.party, parsed.status, parsed.hp);
-			},
-			[&](FromRecoil) -> tv::optional<ParsedMessage> {
-				return RecoilMessage(parsed.party, parsed.status, parsed.hp);
-			},
-			[&](Item const value) -> tv::optional<ParsedMessage> {
-				return ItemMessage(parsed.party, value);
-			},
-			[&](Ability const value) -> tv::optional<ParsedMessage> {
-				// TODO: Do we need get the actual source from the remainder?
-				return AbilityMessage(other(parsed.party), value);
-			},
-			[](FromMove) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Invalid -damage source");
-			},
-			[](FromSubstitute) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Invalid -damage source");
-			}
-		));
-	} else if (type == "detailschange"_s or type == "-formechange"_s) {
-		// TODO
-		return tv::none;
-	} else if (type == "-end"_s) {
-		auto const party = party_from_player_id(message.pop());
-		// https://github.com/llvm/llvm-project/issues/72828
-		auto const temp = split_view(message.pop(), ": "_s);
-		auto const effect_type = temp.first;
-		auto const other = temp.second;
-		return tv::visit(parse_effect_source(effect_type, ""_s), tv::overload(
-			[&](FromSubstitute) -> tv::optional<ParsedMessage> {
-				return DestroySubstituteMessage(party);
-			},
-			[&](FromConfusion) -> tv::optional<ParsedMessage> {
-				return ConfusionEndedMessage(party);
-			},
-			[&](FromDisable) -> tv::optional<ParsedMessage> {
-				return DisableEndedMessage(party);
-			},
-			[&](FromBide) -> tv::optional<ParsedMessage> {
-				return MoveMessage(
+		case MessageType::minor_mustrecharge:
+			// After moves like Hyper Beam
+			return tv::none;
+		case MessageType::minor_notarget:
+			// When you use a move, but there is no one to target
+			return tv::none;
+		case MessageType::minor_nothing:
+			return tv::none;
+		case MessageType::minor_ohko:
+			return tv::none;
+		case MessageType::minor_prepare:
+			// From moves like SolarBeam on the charge turn. We already get this
+			// information from the move message.
+			return tv::none;
+		case MessageType::raw:
+			return tv::none;
+		case MessageType::minor_resisted: {
+			auto const party = party_from_player_id(message.pop());
+			return EffectivenessMessage(
+				party,
+				EffectivenessMessage::not_very
+			);
+		}
+		case MessageType::minor_setboost:
+			// Belly Drum
+			return tv::none;
+		case MessageType::minor_sethp: {
+			auto const parsed = parse_set_hp_message(message);
+			// TODO: verify the source isn't anything meaningful
+			return HPMessage(parsed.party, parsed.status, parsed.hp);
+		}
+		case MessageType::minor_sideend: {
+			auto const party = party_from_side_id(message.pop());
+			auto const condition = parse_condition(message.pop());
+			if (condition) {
+				return ScreenEndMessage(
 					party,
-					MoveName::Bide,
-					false,
-					true
+					*condition
 				);
-			},
-			[](FromMiscellaneous) -> tv::optional<ParsedMessage> {
+			} else {
 				return tv::none;
-			},
-			[&](FromMove) -> tv::optional<ParsedMessage> {
-				auto const move = from_string<MoveName>(other);
-				switch (move) {
-					case MoveName::Taunt:
-						return TauntEndedMessage(party);
-					default:
-						return tv::none;
-				}
-			},
-			[](auto) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Unexpected -end source");
-			}
-		));
-	} else if (type == "-endability"_s) {
-		return tv::none;
-	} else if (type == "-enditem"_s) {
-		auto const party = party_from_player_id(message.pop());
-		auto const item = from_string<Item>(message.pop());
-		return ItemMessage(party, item);
-	} else if (type == "-fail"_s) {
-		return tv::none;
-	} else if (type == "faint"_s) {
-		return tv::none;
-	} else if (type == "-fieldactivate"_s) {
-		return tv::none;
-	} else if (type == "-fieldend"_s) {
-		return tv::none;
-	} else if (type == "-fieldstart"_s) {
-		return tv::none;
-	} else if (type == "-heal"_s) {
-		auto const parsed = parse_set_hp_message(message);
-		auto const party = parsed.party;
-		return tv::visit(parsed.source, tv::overload(
-			[&](MainEffect) -> tv::optional<ParsedMessage> {
-				return HPMessage(party, parsed.status, parsed.hp);
-			},
-			[&](FromMiscellaneous) -> tv::optional<ParsedMessage> {
-				return HPMessage(party, parsed.status, parsed.hp);
-			},
-			[&](FromMove) -> tv::optional<ParsedMessage> {
-				return HPMessage(party, parsed.status, parsed.hp);
-			},
-			[&](Ability const value) -> tv::optional<ParsedMessage> {
-				return HPMessage(party, parsed.status, parsed.hp, value);
-			},
-			[&](Item const value) -> tv::optional<ParsedMessage> {
-				return HPMessage(party, parsed.status, parsed.hp, value);
-			},
-			[](auto) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Invalid heal source");
-			}
-		));
-	} else if (type == "-hint"_s) {
-		return tv::none;
-	} else if (type == "-hitcount"_s) {
-		return tv::none;
-	} else if (type == "-immune"_s) {
-		auto const party = party_from_player_id(message.pop());
-		auto const source = parse_from_source(message.pop());
-		return tv::visit(source, tv::overload(
-			[&](MainEffect) -> tv::optional<ParsedMessage> {
-				return EffectivenessMessage(
-					party,
-					EffectivenessMessage::immune
-				);
-			},
-			[&](Item const value) -> tv::optional<ParsedMessage> {
-				return ItemMessage(party, value);
-			},
-			[&](Ability const value) -> tv::optional<ParsedMessage> {
-				return AbilityMessage(party, value);
-			},
-			[](auto) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Invalid immunity source");
 			}
-		));
-	} else if (type == "inactiveoff"_s) {
-		// message.remainder() == MESSAGE
-		// Timer is off
-		return tv::none;
-	} else if (type == "-item"_s) {
-		auto const party = party_from_player_id(message.pop());
-		auto const item = from_string<Item>(message.pop());
-		return ItemMessage(party, item);
-	} else if (type == "-mega"_s) {
-		return tv::none;
-	} else if (type == "-message"_s) {
-		return tv::none;
-	} else if (type == "-miss"_s) {
-		// miss information is always sent with a move as well
-		return tv::none;
-	} else if (type == "move"_s) {
-		auto const party = party_from_player_id(message.pop());
-		auto const move_str = message.pop();
-		auto const move = from_string<MoveName>(move_str);
-		[[maybe_unused]] auto const target = message.pop();
-		constexpr auto miss_str = "[miss]"_s;
-		auto const first_part = message.pop();
-		auto const first_part_is_missed = first_part == miss_str;
-		auto const second_part = message.pop();
-		auto const second_part_is_missed = second_part == miss_str;
-		auto const immobilize_continued =
-			is_immobilize(move) and
-			first_part == containers::concatenate<containers::string>("[from] "_s, move_str);
-		return MoveMessage(
-			party,
-			move,
-			first_part_is_missed or second_part_is_missed,
-			!immobilize_continued
-		);
-	} else if (type == "-mustrecharge"_s) {
-		// After moves like Hyper Beam
-		return tv::none;
-	} else if (type == "-notarget"_s) {
-		// When you use a move, but there is no one to target
-		return tv::none;
-	} else if (type == "-nothing"_s) {
-		return tv::none;
-	} else if (type == "-ohko"_s) {
-		return tv::none;
-	} else if (type == "-prepare"_s) {
-		// From moves like SolarBeam on the charge turn. We already get this
-		// information from the move message.
-		return tv::none;
-	} else if (type == "raw"_s) {
-		return tv::none;
-	} else if (type == "-resisted"_s) {
-		auto const party = party_from_player_id(message.pop());
-		return EffectivenessMessage(
-			party,
-			EffectivenessMessage::not_very
-		);
-	} else if (type == "-setboost"_s) {
-		// Belly Drum
-		return tv::none;
-	} else if (type == "-sethp"_s) {
-		auto const parsed = parse_set_hp_message(message);
-		// TODO: verify the source isn't anything meaningful
-		return HPMessage(parsed.party, parsed.status, parsed.hp);
-	} else if (type == "-sideend"_s) {
-		auto const party = party_from_side_id(message.pop());
-		auto const condition = parse_condition(message.pop());
-		if (condition) {
-			return ScreenEndMessage(
+		}
+		case MessageType::minor_sidestart:
+			return tv::none;
+		case MessageType::minor_supereffective: {
+			auto const party = party_from_player_id(message.pop());
+			return EffectivenessMessage(
 				party,
-				*condition
+				EffectivenessMessage::super
 			);
-		} else {
-			return tv::none;
 		}
-	} else if (type == "-sidestart"_s) {
-		return tv::none;
-	} else if (type == "-supereffective"_s) {
-		auto const party = party_from_player_id(message.pop());
-		return EffectivenessMessage(
-			party,
-			EffectivenessMessage::super
-		);
-	} else if (type == "switch"_s) {
-		return parse_switch(message);
-	} else if (type == "drag"_s) {
-		return PhazeMessage(parse_switch(message));
-	} else if (type == "replace"_s) {
-		// Illusion ended
-		return tv::none;
-	} else if (type == "-singleturn"_s) {
-		// Received for things like Protect that last the rest of the turn
-		return tv::none;
-	} else if (type == "-start"_s) {
-		auto const party = party_from_player_id(message.pop());
-		auto const first_part_of_source = message.pop();
-		auto const source = [&] {
-			if (first_part_of_source == "typechange"_s) {
-				// TODO: return this information for Hidden Power
-				[[maybe_unused]] auto const changed_type = message.pop();
-				return parse_from_source(message.pop());
-			} else {
-				auto const [source_type, string_source] = split_view(first_part_of_source, ": "_s);
-				return parse_effect_source(source_type, string_source);
-			}
-		}();
-		return tv::visit(source, tv::overload(
-			[&](FromConfusion) -> tv::optional<ParsedMessage> {
-				auto const how = message.pop();
-				if (how == "[fatigue]"_s) {
-					return RampageEndMessage(party);
+		case MessageType::switch_pokemon:
+			return parse_switch(message);
+		case MessageType::drag:
+			return PhazeMessage(parse_switch(message));
+		case MessageType::replace:
+			// Illusion ended
+			return tv::none;
+		case MessageType::minor_singleturn:
+			// Received for things like Protect that last the rest of the turn
+			return tv::none;
+		case MessageType::minor_start: {
+			auto const party = party_from_player_id(message.pop());
+			auto const first_part_of_source = message.pop();
+			auto const source = [&] {
+				if (first_part_of_source == "typechange"_s) {
+					// TODO: return this information for Hidden Power
+					[[maybe_unused]] auto const changed_type = message.pop();
+					return parse_from_source(message.pop());
 				} else {
-					return StartConfusionMessage(party);
+					auto const [source_type, string_source] = split_view(first_part_of_source, ": "_s);
+					return parse_effect_source(source_type, string_source);
 				}
-			},
-			[&](Item const value) -> tv::optional<ParsedMessage> {
-				return ItemMessage(party, value);
-			},
-			[&](Ability const value) -> tv::optional<ParsedMessage> {
-				return AbilityMessage(party, value);
-			},
-			[](MainEffect) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Unexpected -start source MainEffect");
-			},
-			[&](FromDisable) -> tv::optional<ParsedMessage> {
-				auto const move_str = message.pop();
-				return DisableMessage(party, from_string<MoveName>(move_str));
-			},
-			[](FromRecoil) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Unexpected -start source FromRecoil");
-			},
-			[](auto) -> tv::optional<ParsedMessage> {
-				return tv::none;
-			}
-		));
-	} else if (type == "-status"_s) {
-		auto const party = party_from_player_id(message.pop());
-		auto const status = parse_status(message.pop());
-		auto const source = parse_from_source(message.pop());
-		return tv::visit(source, tv::overload(
-			[&](FromMove) -> tv::optional<ParsedMessage> {
-				return MoveStatus(party, status);
-			},
-			[&](Ability const ability) -> tv::optional<ParsedMessage> {
-				check_ability_can_status(ability, status);
-				return AbilityStatusMessage(other(party), ability, status);
-			},
-			[&](Item const item) -> tv::optional<ParsedMessage> {
-				return ItemMessage(party, item);
-			},
-			[&](MainEffect) -> tv::optional<ParsedMessage> {
-				return MoveStatus(party, status);
-			},
-			[](FromBide) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Bide cannot cause a status");
-			},
-			[](FromDisable) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Disable cannot cause a status");
-			},
-			[](FromEntryHazards) -> tv::optional<ParsedMessage> {
-				return tv::none;
-			},
-			[](FromRecoil) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Recoil cannot cause another status");
-			},
-			[](FromConfusion) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Confusion cannot cause another status");
-			},
-			[](FromSubstitute) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Substitute cannot cause another status");
-			},
-			[](FromMiscellaneous) -> tv::optional<ParsedMessage> {
-				throw std::runtime_error("Invalid status source");
-			}
-		));
-	} else if (type == "swap"_s) {
-		return tv::none;
-	} else if (type == "t:"_s) {
-		return tv::none;
-	} else if (type == "-transform"_s) {
-		return tv::none;
-	} else if (type == "turn"_s) {
-		return TurnMessage(bounded::to_integer<TurnCount>(message.pop()));
-	} else if (type == "-unboost"_s) {
-		return tv::none;
-	} else if (type == "upkeep"_s) {
-		return tv::none;
-	} else if (type == "-weather"_s) {
-		auto const weather = from_string<Weather>(message.pop());
-		auto const source = parse_from_source(message.pop());
-		return tv::visit(source, tv::overload(
-			[&](Ability const ability) -> tv::optional<ParsedMessage> {
-				[[maybe_unused]] auto const of = message.pop(' ');
-				auto const party = party_from_player_id(message.pop());
-				return AbilityMessage(party, ability);
-			},
-			[&](auto) -> tv::optional<ParsedMessage> {
-				if (weather == Weather::clear) {
-					return WeatherMessage(weather);
+			}();
+			return tv::visit(source, tv::overload(
+				[&](FromConfusion) -> tv::optional<ParsedMessage> {
+					auto const how = message.pop();
+					if (how == "[fatigue]"_s) {
+						return RampageEndMessage(party);
+					} else {
+						return StartConfusionMessage(party);
+					}
+				},
+				[&](Item const value) -> tv::optional<ParsedMessage> {
+					return ItemMessage(party, value);
+				},
+				[&](Ability const value) -> tv::optional<ParsedMessage> {
+					return AbilityMessage(party, value);
+				},
+				[](MainEffect) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Unexpected -start source MainEffect");
+				},
+				[&](FromDisable) -> tv::optional<ParsedMessage> {
+					auto const move_str = message.pop();
+					return DisableMessage(party, from_string<MoveName>(move_str));
+				},
+				[](FromRecoil) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Unexpected -start source FromRecoil");
+				},
+				[](auto) -> tv::optional<ParsedMessage> {
+					return tv::none;
+				}
+			));
+		}
+		case MessageType::minor_status: {
+			auto const party = party_from_player_id(message.pop());
+			auto const status = parse_status(message.pop());
+			auto const source = parse_from_source(message.pop());
+			return tv::visit(source, tv::overload(
+				[&](FromMove) -> tv::optional<ParsedMessage> {
+					return MoveStatus(party, status);
+				},
+				[&](Ability const ability) -> tv::optional<ParsedMessage> {
+					check_ability_can_status(ability, status);
+					return AbilityStatusMessage(other(party), ability, status);
+				},
+				[&](Item const item) -> tv::optional<ParsedMessage> {
+					return ItemMessage(party, item);
+				},
+				[&](MainEffect) -> tv::optional<ParsedMessage> {
+					return MoveStatus(party, status);
+				},
+				[](FromBide) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Bide cannot cause a status");
+				},
+				[](FromDisable) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Disable cannot cause a status");
+				},
+				[](FromEntryHazards) -> tv::optional<ParsedMessage> {
+					return tv::none;
+				},
+				[](FromRecoil) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Recoil cannot cause another status");
+				},
+				[](FromConfusion) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Confusion cannot cause another status");
+				},
+				[](FromSubstitute) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Substitute cannot cause another status");
+				},
+				[](FromMiscellaneous) -> tv::optional<ParsedMessage> {
+					throw std::runtime_error("Invalid status source");
 				}
-				auto const maybe_upkeep = message.pop();
-				if (maybe_upkeep == "[upkeep]"_s) {
-					return WeatherMessage(weather);
+			));
+		}
+		case MessageType::swap:
+			return tv::none;
+		case MessageType::battle_timestamp:
+			return tv::none;
+		case MessageType::minor_transform:
+			return tv::none;
+		case MessageType::turn:
+			return TurnMessage(bounded::to_integer<TurnCount>(message.pop()));
+		case MessageType::minor_unboost:
+			return tv::none;
+		case MessageType::upkeep:
+			return tv::none;
+		case MessageType::minor_weather: {
+			auto const weather = from_string<Weather>(message.pop());
+			auto const source = parse_from_source(message.pop());
+			return tv::visit(source, tv::overload(
+				[&](Ability const ability) -> tv::optional<ParsedMessage> {
+					[[maybe_unused]] auto const of = message.pop(' ');
+					auto const party = party_from_player_id(message.pop());
+					return AbilityMessage(party, ability);
+				},
+				[&](auto) -> tv::optional<ParsedMessage> {
+					if (weather == Weather::clear) {
+						return WeatherMessage(weather);
+					}
+					auto const maybe_upkeep = message.pop();
+					if (maybe_upkeep == "[upkeep]"_s) {
+						return WeatherMessage(weather);
+					}
+					return tv::none;
 				}
-				return tv::none;
-			}
-		));
-	} else if (type == "tie"_s or type == "win"_s) {
-		return BattleFinishedMessage();
-	} else {
-		throw std::runtime_error(containers::concatenate<std::string>(
-			"Received battle progress message of unknown type: "_s,
-			type,
-			": "_s,
-			message.remainder()
-		));
+			));
+		}
+		case MessageType::tie:
+		case MessageType::win:
+			return BattleFinishedMessage();
+		default:
+			throw std::runtime_error(containers::concatenate<std::string>(
+				"Received battle progress message of unknown type: "_s,
+				message.type(),
+				": "_s,
+				message.remainder()
+			));
 	}
 }
 
@@ -6,33 +6,27 @@
 export module tm.clients.ps.is_chat_message;
 
 import tm.clients.ps.in_message;
+import tm.clients.ps.message_type;
 
 import containers;
 import std_module;
 
 namespace technicalmachine::ps {
-using namespace containers::string_literals;
-
-constexpr auto chat_message_types = containers::array{
-	":"_s,
-	"c"_s,
-	"chat"_s,
-	"c:"_s,
-	"deinit"_s,
-	"expire"_s,
-	"j"_s,
-	"J"_s,
-	"join"_s,
-	"l"_s,
-	"L"_s,
-	"leave"_s,
-	"n"_s,
-	"N"_s,
-	"name"_s
-};
 
 export constexpr auto is_chat_message(InMessage const message) -> bool {
-	return containers::any_equal(chat_message_types, message.type());
+	switch (parse_message_type(message.type())) {
+		case MessageType::chat:
+		case MessageType::chat_timestamped:
+		case MessageType::deinit:
+		case MessageType::expire:
+		case MessageType::join:
+		case MessageType::leave:
+		case MessageType::name:
+		case MessageType::server_timestamp:
+			return true;
+		default:
+			return false;
+	}
 }
 
 } // namespace technicalmachine::ps
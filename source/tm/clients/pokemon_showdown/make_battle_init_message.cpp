@@ -8,6 +8,7 @@ export module tm.clients.ps.make_battle_init_message;
 import tm.clients.ps.battle_init_message;
 import tm.clients.ps.in_message;
 import tm.clients.ps.make_party;
+import tm.clients.ps.message_type;
 import tm.clients.ps.parse_switch;
 import tm.clients.ps.switch_message;
 
@@ -38,44 +39,56 @@ export constexpr auto make_battle_init_message(auto const messages) -> BattleIni
 	auto generation = tv::optional<Generation>();
 	auto teams = containers::array<PerTeam, 2_bi>();
 	for (InMessage message : messages) {
-		auto const type = message.type();
-		auto matches = [&](auto... strs) {
-			return (... or (strs == type));
-		};
-		if (matches("gen"_s)) {
-			if (generation) {
-				throw std::runtime_error("Received gen multiple times");
+		switch (parse_message_type(message.type())) {
+			case MessageType::gen:
+				if (generation) {
+					throw std::runtime_error("Received gen multiple times");
+				}
+				generation = from_string<Generation>(message.pop());
+				break;
+			case MessageType::switch_pokemon: {
+				auto parsed = parse_switch(message);
+				auto & target = teams[parsed.party.value()].starter;
+				if (target) {
+					throw std::runtime_error("Same party switched in twice");
+				}
+				target = parsed;
+				break;
 			}
-			generation = from_string<Generation>(message.pop());
-		} else if (matches("switch"_s)) {
-			auto parsed = parse_switch(message);
-			auto & target = teams[parsed.party.value()].starter;
-			if (target) {
-				throw std::runtime_error("Same party switched in twice");
+			case MessageType::teamsize: {
+				auto const party = make_party(message.pop());
+				auto const team_size = bounded::to_integer<TeamSize>(message.pop());
+				auto & target = teams[party.value()].size;
+				if (target) {
+					throw std::runtime_error("Same party gave a team size twice");
+				}
+				target = team_size;
+				break;
 			}
-			target = parsed;
-		} else if (matches("teamsize"_s)) {
-			auto const party = make_party(message.pop());
-			auto const team_size = bounded::to_integer<TeamSize>(message.pop());
-			auto & target = teams[party.value()].size;
-			if (target) {
-				throw std::runtime_error("Same party gave a team size twice");
+			case MessageType::turn: {
+				auto const turn = bounded::to_integer<TurnCount>(message.pop());
+				if (turn != 1_bi) {
+					throw std::runtime_error("Got a turn after turn 1 during battle set-up");
+				}
+				break;
 			}
-			target = team_size;
-		} else if (matches("turn"_s)) {
-			auto const turn = bounded::to_integer<TurnCount>(message.pop());
-			if (turn != 1_bi) {
-				throw std::runtime_error("Got a turn after turn 1 during battle set-up");
-			}
-		} else if (matches(""_s, "player"_s, "rated"_s, "rule"_s, "start"_s, "t:"_s, "teampreview"_s, "tier"_s)) {
-			// Do nothing, junk
-		} else {
-			throw std::runtime_error(containers::concatenate<std::string>(
-				"Received battle setup message of unknown type: "_s,
-				type,
-				": "_s,
-				message.remainder()
-			));
+			case MessageType::empty:
+			case MessageType::player:
+			case MessageType::rated:
+			case MessageType::rule:
+			case MessageType::start:
+			case MessageType::battle_timestamp:
+			case MessageType::teampreview:
+			case MessageType::tier:
+				// Do nothing, junk
+				break;
+			default:
+				throw std::runtime_error(containers::concatenate<std::string>(
+					"Received battle setup message of unknown type: "_s,
+					message.type(),
+					": "_s,
+					message.remainder()
+				));
 		}
 	}
 
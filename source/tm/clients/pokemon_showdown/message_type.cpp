@@ -0,0 +1,243 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.clients.ps.message_type;
+
+import tm.perfect_hash_map;
+
+import containers;
+import std_module;
+
+// https://github.com/smogon/pokemon-showdown/blob/master/sim/SIM-PROTOCOL.md
+// https://github.com/smogon/pokemon-showdown/blob/master/PROTOCOL.md
+namespace technicalmachine::ps {
+using namespace containers::string_literals;
+
+// Types that PS spells several ways share an enumerator. Types that begin with
+// '-' ("minor actions") are prefixed with `minor_`.
+export enum class MessageType {
+	unknown,
+
+	// Room and chat
+	empty,
+	battle,
+	challstr,
+	chat,
+	chat_timestamped,
+	deinit,
+	expire,
+	formats,
+	html,
+	init,
+	join,
+	leave,
+	name,
+	nametaken,
+	pm,
+	popup,
+	queryresponse,
+	server_timestamp,
+	uhtml,
+	uhtmlchange,
+	updatesearch,
+	updateuser,
+	usercount,
+	users,
+
+	// Battle setup
+	gametype,
+	gen,
+	player,
+	rated,
+	rule,
+	start,
+	teampreview,
+	teamsize,
+	tier,
+
+	// Battle progress
+	battle_timestamp,
+	error,
+	inactive,
+	inactiveoff,
+	raw,
+	request,
+	upkeep,
+
+	// Major actions
+	cant,
+	detailschange,
+	drag,
+	faint,
+	move,
+	replace,
+	swap,
+	switch_pokemon,
+	tie,
+	turn,
+	win,
+
+	// Minor actions
+	minor_ability,
+	minor_activate,
+	minor_anim,
+	minor_boost,
+	minor_center,
+	minor_clearallboost,
+	minor_crit,
+	minor_curestatus,
+	minor_cureteam,
+	minor_damage,
+	minor_end,
+	minor_endability,
+	minor_enditem,
+	minor_fail,
+	minor_fieldactivate,
+	minor_fieldend,
+	minor_fieldstart,
+	minor_formechange,
+	minor_heal,
+	minor_hint,
+	minor_hitcount,
+	minor_immune,
+	minor_item,
+	minor_mega,
+	minor_message,
+	minor_miss,
+	minor_mustrecharge,
+	minor_notarget,
+	minor_nothing,
+	minor_ohko,
+	minor_prepare,
+	minor_resisted,
+	minor_setboost,
+	minor_sethp,
+	minor_sideend,
+	minor_sidestart,
+	minor_singleturn,
+	minor_start,
+	minor_status,
+	minor_supereffective,
+	minor_transform,
+	minor_unboost,
+	minor_weather,
+};
+
+constexpr auto message_types = make_perfect_hash_map<MessageType>({
+	{""_s, MessageType::empty},
+	{"b"_s, MessageType::battle},
+	{"B"_s, MessageType::battle},
+	{"battle"_s, MessageType::battle},
+	{"challstr"_s, MessageType::challstr},
+	{"c"_s, MessageType::chat},
+	{"chat"_s, MessageType::chat},
+	{"c:"_s, MessageType::chat_timestamped},
+	{"deinit"_s, MessageType::deinit},
+	{"expire"_s, MessageType::expire},
+	{"formats"_s, MessageType::formats},
+	{"html"_s, MessageType::html},
+	{"init"_s, MessageType::init},
+	{"j"_s, MessageType::join},
+	{"J"_s, MessageType::join},
+	{"join"_s, MessageType::join},
+	{"l"_s, MessageType::leave},
+	{"L"_s, MessageType::leave},
+	{"leave"_s, MessageType::leave},
+	{"n"_s, MessageType::name},
+	{"N"_s, MessageType::name},
+	{"name"_s, MessageType::name},
+	{"nametaken"_s, MessageType::nametaken},
+	{"pm"_s, MessageType::pm},
+	{"popup"_s, MessageType::popup},
+	{"queryresponse"_s, MessageType::queryresponse},
+	{":"_s, MessageType::server_timestamp},
+	{"uhtml"_s, MessageType::uhtml},
+	{"uhtmlchange"_s, MessageType::uhtmlchange},
+	{"updatesearch"_s, MessageType::updatesearch},
+	{"updateuser"_s, MessageType::updateuser},
+	{"usercount"_s, MessageType::usercount},
+	{"users"_s, MessageType::users},
+
+	{"gametype"_s, MessageType::gametype},
+	{"gen"_s, MessageType::gen},
+	{"player"_s, MessageType::player},
+	{"rated"_s, MessageType::rated},
+	{"rule"_s, MessageType::rule},
+	{"start"_s, MessageType::start},
+	{"teampreview"_s, MessageType::teampreview},
+	{"teamsize"_s, MessageType::teamsize},
+	{"tier"_s, MessageType::tier},
+
+	{"t:"_s, MessageType::battle_timestamp},
+	{"error"_s, MessageType::error},
+	{"inactive"_s, MessageType::inactive},
+	{"inactiveoff"_s, MessageType::inactiveoff},
+	{"raw"_s, MessageType::raw},
+	{"request"_s, MessageType::request},
+	{"upkeep"_s, MessageType::upkeep},
+
+	{"cant"_s, MessageType::cant},
+	{"detailschange"_s, MessageType::detailschange},
+	{"drag"_s, MessageType::drag},
+	{"faint"_s, MessageType::faint},
+	{"move"_s, MessageType::move},
+	{"replace"_s, MessageType::replace},
+	{"swap"_s, MessageType::swap},
+	{"switch"_s, MessageType::switch_pokemon},
+	{"tie"_s, MessageType::tie},
+	{"turn"_s, MessageType::turn},
+	{"win"_s, MessageType::win},
+
+	{"-ability"_s, MessageType::minor_ability},
+	{"-activate"_s, MessageType::minor_activate},
+	{"-anim"_s, MessageType::minor_anim},
+	{"-boost"_s, MessageType::minor_boost},
+	{"-center"_s, MessageType::minor_center},
+	{"-clearallboost"_s, MessageType::minor_clearallboost},
+	{"-crit"_s, MessageType::minor_crit},
+	{"-curestatus"_s, MessageType::minor_curestatus},
+	{"-cureteam"_s, MessageType::minor_cureteam},
+	{"-damage"_s, MessageType::minor_damage},
+	{"-end"_s, MessageType::minor_end},
+	{"-endability"_s, MessageType::minor_endability},
+	{"-enditem"_s, MessageType::minor_enditem},
+	{"-fail"_s, MessageType::minor_fail},
+	{"-fieldactivate"_s, MessageType::minor_fieldactivate},
+	{"-fieldend"_s, MessageType::minor_fieldend},
+	{"-fieldstart"_s, MessageType::minor_fieldstart},
+	{"-formechange"_s, MessageType::minor_formechange},
+	{"-heal"_s, MessageType::minor_heal},
+	{"-hint"_s, MessageType::minor_hint},
+	{"-hitcount"_s, MessageType::minor_hitcount},
+	{"-immune"_s, MessageType::minor_immune},
+	{"-item"_s, MessageType::minor_item},
+	{"-mega"_s, MessageType::minor_mega},
+	{"-message"_s, MessageType::minor_message},
+	{"-miss"_s, MessageType::minor_miss},
+	{"-mustrecharge"_s, MessageType::minor_mustrecharge},
+	{"-notarget"_s, MessageType::minor_notarget},
+	{"-nothing"_s, MessageType::minor_nothing},
+	{"-ohko"_s, MessageType::minor_ohko},
+	{"-prepare"_s, MessageType::minor_prepare},
+	{"-resisted"_s, MessageType::minor_resisted},
+	{"-setboost"_s, MessageType::minor_setboost},
+	{"-sethp"_s, MessageType::minor_sethp},
+	{"-sideend"_s, MessageType::minor_sideend},
+	{"-sidestart"_s, MessageType::minor_sidestart},
+	{"-singleturn"_s, MessageType::minor_singleturn},
+	{"-start"_s, MessageType::minor_start},
+	{"-status"_s, MessageType::minor_status},
+	{"-supereffective"_s, MessageType::minor_supereffective},
+	{"-transform"_s, MessageType::minor_transform},
+	{"-unboost"_s, MessageType::minor_unboost},
+	{"-weather"_s, MessageType::minor_weather},
+});
+
+export constexpr auto parse_message_type(containers::string_view const str) -> MessageType {
+	auto const result = message_types.lookup(str);
+	return result ? *result : MessageType::unknown;
+}
+
+} // namespace technicalmachine::ps
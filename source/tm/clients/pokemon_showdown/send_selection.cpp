@@ -25,38 +25,44 @@ import tv;
 namespace technicalmachine::ps {
 using namespace containers::string_literals;
 
+// Builds each message in `m_buffer`, which keeps its capacity between
+// selections
 struct SendSelection {
 	constexpr auto operator()(Switch const switch_) const -> void {
-		m_send_message(containers::concatenate<containers::string>(
-			m_room,
-			"|/choose switch "_s,
-			containers::to_string(m_slot_memory[switch_.value()])
-		));
+		auto const index = m_slot_memory[switch_.value()];
+		send("|/choose switch "_s, containers::array({static_cast<char>('0' + static_cast<int>(index))}));
 	}
 	constexpr auto operator()(MoveName const move) const -> void {
-		m_send_message(containers::concatenate<containers::string>(
-			m_room,
-			"|/choose move "_s,
-			to_string(move)
-		));
+		send("|/choose move "_s, to_string(move));
 	}
 	static constexpr auto operator()(Pass) -> void {
 	}
 
 	SendMessageFunction m_send_message;
+	containers::string & m_buffer;
 	Room m_room;
 	SlotMemory m_slot_memory;
+
+private:
+	constexpr auto send(containers::string_view const command, auto const & argument) const -> void {
+		m_buffer.clear();
+		containers::append(m_buffer, m_room);
+		containers::append(m_buffer, command);
+		containers::append(m_buffer, argument);
+		m_send_message(m_buffer);
+	}
 };
 
 export constexpr auto send_selection(
 	Selection const selection,
 	SendMessageFunction const send_message,
+	containers::string & buffer,
 	Room const room,
 	SlotMemory const slot_memory
 ) -> void {
 	tv::visit(
 		selection,
-		SendSelection(send_message, room, slot_memory)
+		SendSelection(send_message, buffer, room, slot_memory)
 	);
 }
 
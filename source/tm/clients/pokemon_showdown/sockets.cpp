@@ -10,6 +10,7 @@ import tm.boost_networking;
 import bounded;
 import containers;
 import std_module;
+import tv;
 
 namespace technicalmachine::ps {
 using namespace containers::string_literals;
@@ -22,23 +23,36 @@ auto make_ssl_context() -> ssl::context {
 	return context;
 }
 
+// Without TLS, the connection is only for a local test server
 export struct Sockets {
-	Sockets(containers::string_view const host, containers::string_view const port, std::string_view const resource):
-		m_ssl(make_ssl_context()),
-		m_websocket(m_io, m_ssl)
+	Sockets(containers::string_view const host, containers::string_view const port, std::string_view const resource, bool const secure):
+		m_ssl(make_ssl_context())
 	{
-		connect_ssl_socket(m_io, m_websocket.next_layer(), host, port);
-		m_websocket.handshake(
-			std::string_view(containers::concatenate<containers::string>(host, ":"_s, port)),
-			resource
-		);
+		m_buffer.reserve(initial_buffer_size);
+		auto const host_and_port = containers::concatenate<containers::string>(host, ":"_s, port);
+		if (secure) {
+			auto & websocket = m_websocket.emplace([&] { return Websocket(m_io, m_ssl); });
+			connect_ssl_socket(m_io, websocket.next_layer(), host, port);
+			websocket.handshake(std::string_view(host_and_port), resource);
+		} else {
+			auto & websocket = m_insecure_websocket.emplace([&] { return InsecureWebsocket(m_io); });
+			connect_socket(m_io, websocket.next_layer(), host, port);
+			websocket.handshake(std::string_view(host_and_port), resource);
+		}
 	}
 
 	Sockets(Sockets &&) = delete;
 
+	// The view is valid until the next call. Consuming the previous message
+	// keeps the buffer's capacity, so reading does not allocate unless a
+	// message is larger than any before it.
 	auto read_message() -> containers::string_view {
 		m_buffer.consume(static_cast<std::size_t>(-1));
-		websocket_read(m_websocket, m_buffer);
+		if (m_websocket) {
+			websocket_read(*m_websocket, m_buffer);
+		} else {
+			websocket_read(*m_insecure_websocket, m_buffer);
+		}
 
 		auto const asio_buffer = m_buffer.data();
 		return containers::string_view(
@@ -48,7 +62,11 @@ export struct Sockets {
 	}
 
 	auto write_message(std::string_view const message) -> void {
-		websocket_write(m_websocket, message);
+		if (m_websocket) {
+			websocket_write(*m_websocket, message);
+		} else {
+			websocket_write(*m_insecure_websocket, message);
+		}
 	}
 
 	auto authenticate(
@@ -68,10 +86,15 @@ export struct Sockets {
 	}
 
 private:
+	// Large enough for the team preview and request messages
+	static constexpr auto initial_buffer_size = std::size_t(64 * 1024);
+
 	boost::beast::flat_buffer m_buffer;
 	boost::asio::io_context m_io;
     ssl::context m_ssl;
-	Websocket m_websocket;
+	// Exactly one of these is set
+	tv::optional<Websocket> m_websocket;
+	tv::optional<InsecureWebsocket> m_insecure_websocket;
 };
 
 } // namespace technicalmachine::ps
@@ -0,0 +1,64 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This is its own executable because it replaces the global operator new
+
+#include <doctest/doctest.h>
+
+import tm.clients.ps.test.replay_client;
+
+import tm.clients.ps.battle_message_kind;
+import tm.clients.ps.message_block;
+import tm.clients.ps.room_message_block;
+
+import tm.get_directory;
+import tm.split_view;
+
+import bounded;
+import containers;
+import std_module;
+
+namespace technicalmachine {
+namespace {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+
+auto is_regular(ps::RoomMessageBlock const block) -> bool {
+	auto const messages = ps::message_block(block.str());
+	auto const first = containers::begin(messages);
+	auto const has_more_data = containers::next(first) != containers::end(messages);
+	return ps::get_battle_message_kind(*first, has_more_data) == ps::BattleMessageKind::regular;
+}
+
+TEST_CASE("Pokemon Showdown: regular turns do not allocate") {
+	auto const test_directory = get_test_directory();
+	auto const battle_output_directory = test_directory / "temp-allocations";
+	auto const remove_temporary_files = [&] {
+		std::filesystem::remove_all(battle_output_directory);
+	};
+	remove_temporary_files();
+	{
+		auto client = ps::make_replay_client(battle_output_directory);
+
+		auto const data = ps::load_server_messages(test_directory / "battles/1/battle-gen1ou-1998816971/server_messages.txt");
+		// The logger allocates its buffers when the client is constructed, so
+		// this holds from the first turn
+		for (containers::string_view const message : containers::split_range(containers::drop_exactly(data, 1_bi), "\n>"_s)) {
+			auto const block = ps::RoomMessageBlock(message, ps::RoomMessageBlock::FirstLineIsRoom());
+			if (!is_regular(block)) {
+				client.handle_messages(block);
+				continue;
+			}
+			INFO(message);
+			auto const allocations_before = ps::thread_allocations();
+			client.handle_messages(block);
+			CHECK(ps::thread_allocations() == allocations_before);
+		}
+	}
+	remove_temporary_files();
+}
+
+} // namespace
+} // namespace technicalmachine
@@ -14,6 +14,7 @@ import tm.clients.ps.action_required;
 import tm.clients.ps.battle_init_message;
 import tm.clients.ps.battle_message_handler;
 import tm.clients.ps.battle_response_switch;
+import tm.clients.ps.battle_snapshot_file;
 import tm.clients.ps.event_block;
 import tm.clients.ps.parsed_message;
 import tm.clients.ps.parsed_stats;
@@ -227,6 +228,41 @@ TEST_CASE("Pokemon Showdown: BattleMessageHandler constructor has correct initia
 	check_switch_options(handler, {1_bi});
 }
 
+TEST_CASE("Pokemon Showdown: BattleMessageHandler can be restored from a snapshot") {
+	constexpr auto generation = Generation::one;
+	auto [expected, handler] = make_init<generation>(
+		{
+			{.species = Species::Pikachu, .moves = {{MoveName::Tackle}}},
+			{.species = Species::Eevee, .moves = {{MoveName::Tackle}}},
+		},
+		{
+			.team_size = 1_bi,
+			.species = Species::Bulbasaur,
+		}
+	);
+
+	auto const snapshot = handler.snapshot(TurnCount(1_bi));
+	auto const restored = ps::BattleMessageHandler(snapshot);
+	CHECK(restored.state() == handler.state());
+	check_switch_options(restored, {1_bi});
+
+	auto const directory = std::filesystem::temp_directory_path() / "tm_battle_snapshot_test";
+	auto remove_temp_directory = [&] { std::filesystem::remove_all(directory); };
+	remove_temp_directory();
+	auto const guard = bounded::scope_guard(remove_temp_directory);
+	{
+		auto writer = ps::BattleSnapshotWriter(directory);
+		writer.write("battle-gen1ou-1"_sv, snapshot);
+	}
+	auto const loaded = ps::load_battle_snapshots(directory);
+	REQUIRE(containers::size(loaded) == 1_bi);
+	auto const & value = containers::front(loaded);
+	CHECK(value.room == "battle-gen1ou-1"_sv);
+	auto const reloaded = ps::BattleMessageHandler(value.snapshot);
+	CHECK(reloaded.state() == handler.state());
+	check_switch_options(reloaded, {1_bi});
+}
+
 TEST_CASE("Pokemon Showdown: BattleMessageHandler partial turn") {
 	constexpr auto generation = Generation::one;
 	auto [expected, handler] = make_init<generation>(
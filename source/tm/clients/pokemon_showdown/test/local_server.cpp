@@ -0,0 +1,463 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A stand-in for a Pokemon Showdown server, for load testing the client
+// without a network. It replays recorded server_messages.txt files as battle
+// rooms. Each connection is challenged to `rooms` battles at once; whenever a
+// battle ends, another challenge is sent. Battle blocks are sent at a fixed
+// rate per room, and a room does not send its next request until the client
+// has answered the previous one with /choose.
+//
+// There is no login. The client must be configured with `"secure": false` and
+// to accept challenges from `localserver`:
+//
+//	"style": {"mode": "accept", "users": ["localserver"]}
+//
+// The time from sending a request to receiving the /choose for it is reported
+// as the client's latency.
+
+import tm.web_server.web_server;
+
+import tm.boost_networking;
+import tm.open_file;
+import tm.split_view;
+
+import bounded;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine::ps {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+
+constexpr auto server_user = "localserver"_s;
+constexpr auto report_interval = std::chrono::seconds(10);
+
+struct ParsedArgs {
+	unsigned short port;
+	std::filesystem::path input_directory;
+	std::size_t rooms;
+	std::chrono::nanoseconds block_interval;
+};
+
+auto parse_args(int argc, char const * const * argv) -> ParsedArgs {
+	if (argc != 5) {
+		throw std::runtime_error("Usage is ps_local_server port input_directory rooms_per_connection blocks_per_second_per_room");
+	}
+	auto const port = bounded::to_integer<bounded::integer<1, 65535>>(argv[1]);
+	auto input_directory = std::filesystem::path(argv[2]);
+	if (!std::filesystem::exists(input_directory)) {
+		throw std::runtime_error(containers::concatenate<std::string>(input_directory.string(), " does not exist"_s));
+	}
+	auto const rooms = bounded::to_integer<bounded::integer<1, 10'000>>(argv[3]);
+	auto const blocks_per_second = bounded::to_integer<bounded::integer<1, 1'000'000>>(argv[4]);
+	return ParsedArgs{
+		static_cast<unsigned short>(port),
+		std::move(input_directory),
+		static_cast<std::size_t>(rooms),
+		std::chrono::nanoseconds(std::chrono::seconds(1)) / static_cast<std::int64_t>(blocks_per_second)
+	};
+}
+
+// The blocks of one recorded battle, without the line naming the room
+struct RecordedBattle {
+	containers::string format;
+	containers::vector<containers::string> blocks;
+};
+
+auto load_file(std::filesystem::path const & path) -> containers::string {
+	auto file = open_text_file_for_reading(path);
+	return containers::string(containers::subrange(
+		std::istreambuf_iterator<char>(file),
+		std::default_sentinel
+	));
+}
+
+// battle-gen1ou-1234 has a format of gen1ou
+auto format_from_room(std::string_view const room) -> std::string_view {
+	auto const without_prefix = room.substr(std::string_view("battle-").size());
+	return without_prefix.substr(0U, without_prefix.find('-'));
+}
+
+auto load_recorded_battle(std::filesystem::path const & path) -> tv::optional<RecordedBattle> {
+	auto const data = load_file(path);
+	if (containers::is_empty(data)) {
+		return tv::none;
+	}
+	auto result = RecordedBattle();
+	for (containers::string_view const block : containers::split_range(containers::drop_exactly(data, 1_bi), "\n>"_s)) {
+		auto const str = std::string_view(block);
+		auto const newline = str.find('\n');
+		if (newline == std::string_view::npos) {
+			continue;
+		}
+		auto const room = str.substr(0U, newline);
+		if (!room.starts_with("battle-")) {
+			continue;
+		}
+		if (containers::is_empty(result.format)) {
+			result.format = containers::string(format_from_room(room));
+		}
+		containers::push_back(result.blocks, containers::string(str.substr(newline + 1U)));
+	}
+	if (containers::is_empty(result.blocks)) {
+		return tv::none;
+	}
+	return result;
+}
+
+auto load_recorded_battles(std::filesystem::path const & directory) -> containers::vector<RecordedBattle> {
+	auto result = containers::vector<RecordedBattle>();
+	for (auto const & entry : std::filesystem::recursive_directory_iterator(directory)) {
+		if (!entry.is_regular_file() or entry.path().filename() != "server_messages.txt") {
+			continue;
+		}
+		if (auto battle = load_recorded_battle(entry.path())) {
+			containers::push_back(result, std::move(*battle));
+		}
+	}
+	if (containers::is_empty(result)) {
+		throw std::runtime_error(containers::concatenate<std::string>("No battles found in "_s, directory.string()));
+	}
+	return result;
+}
+
+// The client has to answer these with /choose
+auto is_choice_request(containers::string const & block) -> bool {
+	auto const str = std::string_view(block);
+	return str.starts_with("|request|{") and str.find("\"wait\":true") == std::string_view::npos;
+}
+
+// Everything runs on one thread, so this is not synchronized
+struct Statistics {
+	std::uint64_t connections = 0U;
+	std::uint64_t rooms_started = 0U;
+	std::uint64_t rooms_finished = 0U;
+	std::uint64_t blocks_sent = 0U;
+	std::uint64_t unexpected_choices = 0U;
+	std::vector<std::chrono::nanoseconds> latencies;
+};
+
+auto microseconds(std::chrono::nanoseconds const value) -> double {
+	return std::chrono::duration<double, std::micro>(value).count();
+}
+
+auto report(Statistics & statistics, std::chrono::nanoseconds const elapsed) -> void {
+	auto const seconds = std::chrono::duration<double>(elapsed).count();
+	std::cout <<
+		"Connections: " << statistics.connections <<
+		", rooms started: " << statistics.rooms_started <<
+		", rooms finished: " << statistics.rooms_finished <<
+		", blocks per second: " << static_cast<double>(statistics.blocks_sent) / seconds <<
+		", choices per second: " << static_cast<double>(statistics.latencies.size()) / seconds;
+	if (statistics.unexpected_choices != 0U) {
+		std::cout << ", unexpected choices: " << statistics.unexpected_choices;
+	}
+	auto & latencies = statistics.latencies;
+	if (!latencies.empty()) {
+		std::ranges::sort(latencies);
+		auto percentile = [&](double const fraction) {
+			return microseconds(latencies[static_cast<std::size_t>(fraction * static_cast<double>(latencies.size() - 1U))]);
+		};
+		std::cout <<
+			"\nLatency in microseconds: p50 " << percentile(0.5) <<
+			", p99 " << percentile(0.99) <<
+			", max " << microseconds(latencies.back());
+	}
+	std::cout << '\n' << std::flush;
+	statistics.blocks_sent = 0U;
+	statistics.unexpected_choices = 0U;
+	latencies.clear();
+}
+
+struct Room {
+	Room(boost::asio::io_context & context, RecordedBattle const & battle_):
+		battle(battle_),
+		timer(context)
+	{
+	}
+
+	std::reference_wrapper<RecordedBattle const> battle;
+	std::size_t next_block = 0U;
+	boost::asio::steady_timer timer;
+	// Set while a request has been sent and not answered
+	tv::optional<std::chrono::steady_clock::time_point> request_sent;
+	bool waiting_for_choice = false;
+};
+
+struct Connection {
+	Connection(
+		tcp::socket socket,
+		boost::asio::io_context & context,
+		containers::vector<RecordedBattle> const & battles,
+		ParsedArgs const & args,
+		Statistics & statistics
+	):
+		m_socket(std::move(socket)),
+		m_context(context),
+		m_battles(battles),
+		m_args(args),
+		m_statistics(statistics)
+	{
+		++m_statistics.get().connections;
+		++m_pending_operations;
+		m_socket.async_accept([&](boost::beast::error_code const ec) {
+			--m_pending_operations;
+			if (ec) {
+				std::cerr << "Websocket accept error: " << ec.message() << '\n';
+				close();
+				return;
+			}
+			read();
+			send(containers::string("|updateuser| tm|1|1|"_s));
+			for (std::size_t index = 0U; index != m_args.get().rooms; ++index) {
+				challenge();
+			}
+		});
+	}
+
+	Connection(Connection &&) = delete;
+
+	// Stays true until every outstanding operation has finished, so that no
+	// handler refers to a destroyed connection
+	auto is_open() const -> bool {
+		return m_open or m_pending_operations != 0U;
+	}
+
+private:
+	using RoomName = containers::string;
+
+	auto close() -> void {
+		if (!m_open) {
+			return;
+		}
+		m_open = false;
+		// Destroying the timers cancels them
+		m_rooms.clear();
+		--m_statistics.get().connections;
+		try {
+			websocket_close(m_socket);
+		} catch (std::exception const &) {
+			// The socket was already closed by the client
+		}
+	}
+
+	auto send(containers::string message) -> void {
+		if (!m_open) {
+			return;
+		}
+		m_outgoing.push_back(std::move(message));
+		if (m_outgoing.size() == 1U) {
+			write_front();
+		}
+	}
+
+	auto write_front() -> void {
+		auto const & message = m_outgoing.front();
+		++m_pending_operations;
+		websocket_async_write(
+			m_socket,
+			boost::asio::buffer(containers::data(message), static_cast<std::size_t>(containers::size(message))),
+			[&](boost::beast::error_code const ec, std::size_t) {
+				--m_pending_operations;
+				m_outgoing.pop_front();
+				if (ec) {
+					std::cerr << "Websocket write error: " << ec.message() << '\n';
+					m_outgoing.clear();
+					close();
+					return;
+				}
+				if (m_open and !m_outgoing.empty()) {
+					write_front();
+				}
+			}
+		);
+	}
+
+	auto read() -> void {
+		++m_pending_operations;
+		websocket_async_read(
+			m_socket,
+			m_buffer,
+			[&](boost::beast::error_code const ec, std::size_t) {
+				--m_pending_operations;
+				if (ec) {
+					if (m_open) {
+						std::cerr << "Websocket read error: " << ec.message() << '\n';
+					}
+					close();
+					return;
+				}
+				auto const message = containers::string_view(
+					static_cast<char const *>(m_buffer.data().data()),
+					bounded::assume_in_range<containers::array_size_type<char>>(m_buffer.data().size())
+				);
+				handle_message(message);
+				m_buffer.clear();
+				if (m_open) {
+					read();
+				}
+			}
+		);
+	}
+
+	// Messages from the client are ROOM|COMMAND, where ROOM is empty for
+	// global commands
+	auto handle_message(containers::string_view const message) -> void {
+		auto const separator = containers::find(message, '|');
+		if (separator == containers::end(message)) {
+			return;
+		}
+		auto const room = containers::string_view(containers::begin(message), separator);
+		auto const command = containers::string_view(containers::next(separator), containers::end(message));
+		if (containers::starts_with(command, "/choose "_s)) {
+			handle_choice(room);
+		} else if (containers::starts_with(command, "/accept "_s) or containers::starts_with(command, "/search "_s)) {
+			start_room();
+		}
+		// Everything else (/utm, /leave, /timer) needs no response
+	}
+
+	auto challenge() -> void {
+		auto const & battle = containers::at(m_battles.get(), m_next_battle);
+		m_challenges.push_back(m_next_battle);
+		m_next_battle = (m_next_battle + 1U) % static_cast<std::size_t>(containers::size(m_battles.get()));
+		send(containers::concatenate<containers::string>("|pm| "_s, server_user, "| tm|/challenge|"_s, battle.format));
+	}
+
+	auto start_room() -> void {
+		if (m_challenges.empty()) {
+			return;
+		}
+		auto const & battle = containers::at(m_battles.get(), m_challenges.front());
+		m_challenges.pop_front();
+		auto const name = containers::concatenate<RoomName>("battle-"_s, battle.format, "-local"_s, std::to_string(m_next_room_id));
+		++m_next_room_id;
+		++m_statistics.get().rooms_started;
+		auto & room = *containers::get_mapped(*m_rooms.lazy_insert(
+			name,
+			[&] { return std::make_unique<Room>(m_context.get(), battle); }
+		).iterator);
+		schedule(name, room, std::chrono::nanoseconds(0));
+	}
+
+	auto schedule(RoomName const & name, Room & room, std::chrono::nanoseconds const delay) -> void {
+		room.timer.expires_after(delay);
+		++m_pending_operations;
+		room.timer.async_wait([this, name](boost::beast::error_code const ec) {
+			--m_pending_operations;
+			if (ec or !m_open) {
+				return;
+			}
+			send_next_block(name);
+		});
+	}
+
+	auto send_next_block(RoomName const & name) -> void {
+		auto const room_ptr = containers::lookup(m_rooms, name);
+		if (!room_ptr) {
+			return;
+		}
+		auto & room = **room_ptr;
+		auto const & blocks = room.battle.get().blocks;
+		if (room.next_block == static_cast<std::size_t>(containers::size(blocks))) {
+			containers::keyed_erase(m_rooms, name);
+			++m_statistics.get().rooms_finished;
+			challenge();
+			return;
+		}
+		auto const & block = containers::at(blocks, room.next_block);
+		auto const needs_choice = is_choice_request(block);
+		if (needs_choice and room.request_sent) {
+			room.waiting_for_choice = true;
+			return;
+		}
+		send(containers::concatenate<containers::string>(">"_s, name, "\n"_s, block));
+		++m_statistics.get().blocks_sent;
+		if (needs_choice) {
+			room.request_sent = std::chrono::steady_clock::now();
+		}
+		++room.next_block;
+		schedule(name, room, m_args.get().block_interval);
+	}
+
+	auto handle_choice(containers::string_view const name) -> void {
+		auto const room_ptr = containers::lookup(m_rooms, name);
+		if (!room_ptr or !(*room_ptr)->request_sent) {
+			++m_statistics.get().unexpected_choices;
+			return;
+		}
+		auto & room = **room_ptr;
+		m_statistics.get().latencies.push_back(std::chrono::steady_clock::now() - *room.request_sent);
+		room.request_sent = tv::none;
+		if (room.waiting_for_choice) {
+			room.waiting_for_choice = false;
+			schedule(RoomName(name), room, m_args.get().block_interval);
+		}
+	}
+
+	InsecureWebsocket m_socket;
+	boost::beast::flat_buffer m_buffer;
+	std::reference_wrapper<boost::asio::io_context> m_context;
+	std::reference_wrapper<containers::vector<RecordedBattle> const> m_battles;
+	std::reference_wrapper<ParsedArgs const> m_args;
+	std::reference_wrapper<Statistics> m_statistics;
+	// Writes are one at a time, so messages wait here for their turn
+	std::deque<containers::string> m_outgoing;
+	containers::linear_map<RoomName, std::unique_ptr<Room>> m_rooms;
+	// Indexes of battles that have been offered but not yet accepted
+	std::deque<std::size_t> m_challenges;
+	std::size_t m_next_battle = 0U;
+	std::uint64_t m_next_room_id = 0U;
+	std::size_t m_pending_operations = 0U;
+	bool m_open = true;
+};
+
+struct Reporter {
+	Reporter(boost::asio::io_context & context, Statistics & statistics):
+		m_timer(context),
+		m_statistics(statistics),
+		m_last(std::chrono::steady_clock::now())
+	{
+		wait();
+	}
+
+private:
+	auto wait() -> void {
+		m_timer.expires_after(report_interval);
+		m_timer.async_wait([this](boost::beast::error_code const ec) {
+			if (ec) {
+				return;
+			}
+			auto const now = std::chrono::steady_clock::now();
+			report(m_statistics.get(), now - m_last);
+			m_last = now;
+			wait();
+		});
+	}
+
+	boost::asio::steady_timer m_timer;
+	std::reference_wrapper<Statistics> m_statistics;
+	std::chrono::steady_clock::time_point m_last;
+};
+
+} // namespace technicalmachine::ps
+
+auto main(int argc, char ** argv) -> int {
+	using namespace technicalmachine;
+	using namespace technicalmachine::ps;
+	auto const args = parse_args(argc, argv);
+	auto const battles = load_recorded_battles(args.input_directory);
+	std::cout << "Loaded " << containers::size(battles) << " battles, listening on port " << args.port << '\n' << std::flush;
+	auto statistics = Statistics();
+	auto context = boost::asio::io_context();
+	auto server = WebServer(context, args.port, [&](tcp::socket socket) {
+		return std::make_unique<Connection>(std::move(socket), context, battles, args, statistics);
+	});
+	auto reporter = Reporter(context, statistics);
+	context.run();
+	return 0;
+}
@@ -0,0 +1,41 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+export module tm.test.clients.ps.message_type;
+
+import tm.clients.ps.in_message;
+import tm.clients.ps.message_type;
+
+import containers;
+import std_module;
+
+namespace technicalmachine {
+namespace {
+using namespace containers::string_literals;
+using ps::MessageType;
+
+constexpr auto message_type(containers::string_view const str) -> MessageType {
+	return ps::parse_message_type(ps::InMessage(str).type());
+}
+
+static_assert(message_type("||"_s) == MessageType::empty);
+static_assert(message_type("|switch|p1a: Mew|Mew|100/100"_s) == MessageType::switch_pokemon);
+static_assert(message_type("|-start|p1a: Mew|confusion"_s) == MessageType::minor_start);
+static_assert(message_type("|start"_s) == MessageType::start);
+static_assert(message_type("|t:|1700000000"_s) == MessageType::battle_timestamp);
+static_assert(message_type("|:|1700000000"_s) == MessageType::server_timestamp);
+
+static_assert(message_type("|j|user"_s) == MessageType::join);
+static_assert(message_type("|J|user"_s) == MessageType::join);
+static_assert(message_type("|join|user"_s) == MessageType::join);
+
+static_assert(message_type("|Switch|p1a: Mew"_s) == MessageType::unknown);
+static_assert(message_type("|-|"_s) == MessageType::unknown);
+static_assert(message_type("|switch2|"_s) == MessageType::unknown);
+
+} // namespace
+} // namespace technicalmachine
@@ -0,0 +1,91 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Shared by the executables that replay recorded server messages through a
+// client. Linking this replaces the global operator new.
+
+export module tm.clients.ps.test.replay_client;
+
+import tm.clients.ps.client_message_handler;
+
+import tm.strategy.max_damage;
+
+import tm.boost_networking;
+import tm.open_file;
+import tm.settings_file;
+
+import containers;
+import std_module;
+
+namespace technicalmachine::ps {
+using namespace containers::string_literals;
+
+// Per thread so that allocations made by the logger's background thread are
+// not attributed to message handling
+thread_local auto allocations = std::uint64_t(0);
+
+export auto thread_allocations() -> std::uint64_t {
+	return allocations;
+}
+
+export auto load_server_messages(std::filesystem::path const & path) -> containers::string {
+	auto file = open_text_file_for_reading(path);
+	return containers::string(containers::subrange(
+		std::istreambuf_iterator<char>(file),
+		std::default_sentinel
+	));
+}
+
+constexpr auto send_message = [](containers::string_view) -> void {};
+constexpr auto authenticate = [](
+	containers::string_view,
+	containers::string_view,
+	http::request<http::string_body> const &
+) -> http::response<http::string_body> {
+	return {};
+};
+
+// A client that is never connected to a server, so it only sees the messages
+// it is given
+export auto make_replay_client(std::filesystem::path const & battles_directory) -> ClientMessageHandler {
+	return ClientMessageHandler(
+		SettingsFile{
+			.host = ""_s,
+			.port = ""_s,
+			.resource = ""_s,
+			.username = ""_s,
+			.password = ""_s,
+			.team = SettingsFile::NoTeam(),
+			.style = SettingsFile::Accept()
+		},
+		battles_directory,
+		make_max_damage(),
+		send_message,
+		authenticate
+	);
+}
+
+} // namespace technicalmachine::ps
+
+// The replaceable allocation functions must be attached to the global module
+extern "C++" {
+
+auto operator new(std::size_t const size) -> void * {
+	++technicalmachine::ps::allocations;
+	if (auto const ptr = std::malloc(size == 0U ? 1U : size)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+
+auto operator delete(void * const ptr) noexcept -> void {
+	std::free(ptr);
+}
+
+auto operator delete(void * const ptr, std::size_t) noexcept -> void {
+	std::free(ptr);
+}
+
+} // extern "C++"
@@ -0,0 +1,232 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Replays recorded server_messages.txt files through ClientMessageHandler and
+// reports how quickly the client handles them. Each thread has its own client
+// and replays its share of the rooms.
+
+import tm.clients.ps.test.replay_client;
+
+import tm.clients.ps.battle_message_kind;
+import tm.clients.ps.message_block;
+import tm.clients.ps.room_message_block;
+
+import tm.split_view;
+
+import bounded;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+
+using ThreadCount = bounded::integer<1, 1'000>;
+
+struct ParsedArgs {
+	ThreadCount thread_count;
+	std::filesystem::path input_directory;
+};
+
+auto parse_args(int argc, char const * const * argv) -> ParsedArgs {
+	if (argc != 3) {
+		throw std::runtime_error("Usage is ps_replay_throughput thread_count input_directory");
+	}
+	auto const thread_count = bounded::to_integer<ThreadCount>(argv[1]);
+	auto input_directory = std::filesystem::path(argv[2]);
+	if (!std::filesystem::exists(input_directory)) {
+		throw std::runtime_error(containers::concatenate<std::string>(input_directory.string(), " does not exist"_s));
+	}
+	return ParsedArgs{
+		thread_count,
+		std::move(input_directory)
+	};
+}
+
+auto server_message_files(std::filesystem::path const & directory) -> containers::vector<std::filesystem::path> {
+	auto result = containers::vector<std::filesystem::path>();
+	for (auto const & entry : std::filesystem::recursive_directory_iterator(directory)) {
+		if (entry.is_regular_file() and entry.path().filename() == "server_messages.txt") {
+			containers::push_back(result, entry.path());
+		}
+	}
+	return result;
+}
+
+// Blocks that are not from a battle room, and blocks that the client rejects,
+// have no kind
+using BlockKind = tv::optional<ps::BattleMessageKind>;
+
+constexpr auto all_kinds = containers::array<BlockKind, 6_bi>{
+	ps::BattleMessageKind::junk,
+	ps::BattleMessageKind::init,
+	ps::BattleMessageKind::regular,
+	ps::BattleMessageKind::request,
+	ps::BattleMessageKind::error,
+	tv::none
+};
+
+constexpr auto kind_name(BlockKind const kind) -> std::string_view {
+	if (!kind) {
+		return "other";
+	}
+	switch (*kind) {
+		case ps::BattleMessageKind::junk: return "junk";
+		case ps::BattleMessageKind::init: return "init";
+		case ps::BattleMessageKind::regular: return "regular";
+		case ps::BattleMessageKind::request: return "request";
+		case ps::BattleMessageKind::error: return "error";
+	}
+}
+
+auto classify(ps::RoomMessageBlock const block) -> BlockKind {
+	if (!containers::starts_with(block.room(), "battle-"_s)) {
+		return tv::none;
+	}
+	auto const messages = ps::message_block(block.str());
+	auto const first = containers::begin(messages);
+	auto const has_more_data = containers::next(first) != containers::end(messages);
+	try {
+		return ps::get_battle_message_kind(*first, has_more_data);
+	} catch (std::exception const &) {
+		return tv::none;
+	}
+}
+
+using Latencies = containers::vector<std::chrono::nanoseconds>;
+
+struct Measurements {
+	containers::linear_map<BlockKind, Latencies> latencies;
+	// Excludes loading files and setting up the client
+	std::chrono::nanoseconds handling_time{};
+	std::uint64_t messages = 0U;
+	std::uint64_t allocations = 0U;
+	std::uint64_t rooms = 0U;
+	std::uint64_t failed_rooms = 0U;
+
+	auto record(BlockKind const kind, std::chrono::nanoseconds const latency) & -> void {
+		containers::push_back(latencies.lazy_insert(kind, bounded::construct<Latencies>).iterator->mapped, latency);
+	}
+
+	auto append(Measurements && other) & -> void {
+		for (auto & element : other.latencies) {
+			containers::append(
+				latencies.lazy_insert(element.key, bounded::construct<Latencies>).iterator->mapped,
+				std::move(element.mapped)
+			);
+		}
+		// The threads run at the same time
+		handling_time = std::max(handling_time, other.handling_time);
+		messages += other.messages;
+		allocations += other.allocations;
+		rooms += other.rooms;
+		failed_rooms += other.failed_rooms;
+	}
+};
+
+auto replay_rooms(
+	containers::vector<std::filesystem::path> const & files,
+	ThreadCount const thread_index,
+	ThreadCount const thread_count,
+	std::filesystem::path const & output_directory
+) -> Measurements {
+	auto result = Measurements();
+	auto client = ps::make_replay_client(output_directory);
+	for (auto const index : containers::integer_range(containers::size(files))) {
+		if (index % thread_count != thread_index - 1_bi) {
+			continue;
+		}
+		auto const & file = containers::at(files, index);
+		auto const data = ps::load_server_messages(file);
+		auto const blocks = containers::split_range(containers::drop_exactly(data, 1_bi), "\n>"_s);
+		++result.rooms;
+		try {
+			for (containers::string_view const str : blocks) {
+				auto const block = ps::RoomMessageBlock(str, ps::RoomMessageBlock::FirstLineIsRoom());
+				auto const kind = classify(block);
+				auto const allocations_before = ps::thread_allocations();
+				auto const start = std::chrono::steady_clock::now();
+				client.handle_messages(block);
+				auto const end = std::chrono::steady_clock::now();
+				result.allocations += ps::thread_allocations() - allocations_before;
+				result.handling_time += end - start;
+				result.record(kind, end - start);
+				result.messages += static_cast<std::uint64_t>(containers::linear_size(ps::message_block(block.str())));
+			}
+		} catch (std::exception const & ex) {
+			std::cerr << "Unable to replay " << file.string() << ": " << ex.what() << '\n';
+			++result.failed_rooms;
+		}
+	}
+	return result;
+}
+
+auto percentile(Latencies const & sorted, double const fraction) -> std::chrono::nanoseconds {
+	auto const index = static_cast<std::size_t>(fraction * static_cast<double>(containers::size(sorted) - 1_bi));
+	return containers::at(sorted, index);
+}
+
+auto microseconds(std::chrono::nanoseconds const value) -> double {
+	return std::chrono::duration<double, std::micro>(value).count();
+}
+
+auto print_report(Measurements & measurements) -> void {
+	auto const seconds = std::chrono::duration<double>(measurements.handling_time).count();
+	auto const blocks = containers::sum(containers::transform(
+		measurements.latencies,
+		[](auto const & element) { return containers::size(element.mapped); }
+	));
+	std::cout << "Rooms: " << measurements.rooms << " (" << measurements.failed_rooms << " failed)\n";
+	std::cout << "Blocks: " << blocks << '\n';
+	std::cout << "Messages: " << measurements.messages << '\n';
+	std::cout << "Messages per second: " << static_cast<double>(measurements.messages) / seconds << '\n';
+	if (measurements.messages != 0U) {
+		std::cout << "Allocations per message: " << static_cast<double>(measurements.allocations) / static_cast<double>(measurements.messages) << '\n';
+	}
+	std::cout << "Latency per block, in microseconds:\n";
+	for (auto const kind : all_kinds) {
+		auto const latencies = containers::lookup(measurements.latencies, kind);
+		if (!latencies or containers::is_empty(*latencies)) {
+			continue;
+		}
+		containers::sort(*latencies);
+		std::cout << '\t' << kind_name(kind) <<
+			": count " << containers::size(*latencies) <<
+			", p50 " << microseconds(percentile(*latencies, 0.5)) <<
+			", p99 " << microseconds(percentile(*latencies, 0.99)) <<
+			", max " << microseconds(containers::back(*latencies)) << '\n';
+	}
+}
+
+} // namespace technicalmachine
+
+auto main(int argc, char ** argv) -> int {
+	using namespace technicalmachine;
+	auto const args = parse_args(argc, argv);
+	auto const files = server_message_files(args.input_directory);
+	auto const output_directory = std::filesystem::temp_directory_path() / "tm-replay-throughput";
+	std::filesystem::remove_all(output_directory);
+
+	auto results = containers::dynamic_array<Measurements>(containers::repeat_default_n<Measurements>(args.thread_count));
+	{
+		auto const threads = containers::dynamic_array<std::jthread>(containers::transform(
+			containers::integer_range(1_bi, args.thread_count + 1_bi),
+			[&](ThreadCount const thread_index) {
+				return std::jthread([&, thread_index] {
+					results[thread_index - 1_bi] = replay_rooms(files, thread_index, args.thread_count, output_directory / std::to_string(thread_index.value()));
+				});
+			}
+		));
+	}
+	std::filesystem::remove_all(output_directory);
+
+	auto total = Measurements();
+	for (auto & result : results) {
+		total.append(std::move(result));
+	}
+	print_report(total);
+	return 0;
+}
@@ -5,6 +5,9 @@
 
 import tm.clients.load_team_from_file;
 
+import tm.ps_usage_stats.parallel_for_each;
+import tm.ps_usage_stats.thread_count;
+
 import tm.stat.stat_style;
 
 import tm.string_conversions.initial_team;
@@ -19,33 +22,45 @@ import tv;
 import std_module;
 
 namespace {
-using namespace bounded::literal;
 using namespace containers::string_literals;
 using namespace technicalmachine;
 
 constexpr auto invalid_args_message =
 	"Usage is file_converter output_type output_location files...\n"
-	"Valid output types are: print, text\n"
+	"Valid output types are: print, text, archive\n"
 	"If output_type is \"print\", there is no \"output_location\"\n"
+	"If output_type is \"text\", \"output_location\" is a directory that gets one file per team\n"
+	"If output_type is \"archive\", \"output_location\" is a single file that gets every team\n"
 	"If \"files...\" includes a directory, all files in that directory will be parsed.";
 
-enum class OutputType { print, text };
+enum class OutputType { print, text, archive };
 
 constexpr auto parse_output_type(containers::string_view const str) -> OutputType {
 	if (str == "print"_s) {
 		return OutputType::print;
 	} else if (str == "text"_s) {
 		return OutputType::text;
+	} else if (str == "archive"_s) {
+		return OutputType::archive;
 	} else {
 		throw std::runtime_error(invalid_args_message);
 	}
 }
 
+// Outputs can be called from any number of threads at once. Each team is
+// converted to a string before taking a lock, so the lock is held only while
+// writing.
+
 struct AsStringPrinted {
 	template<SpecialInputStyle style>
-	static auto operator()(InitialTeam<style> const & team, std::filesystem::path const &) -> void {
-		std::cout << to_string(team) << '\n';
+	auto operator()(InitialTeam<style> const & team, std::filesystem::path const &) const -> void {
+		auto const str = to_string(team);
+		auto const lock = std::scoped_lock(*m_mutex);
+		std::cout << str << '\n';
 	}
+
+private:
+	std::unique_ptr<std::mutex> m_mutex = std::make_unique<std::mutex>();
 };
 
 struct AsStringFile {
@@ -65,7 +80,29 @@ private:
 	std::filesystem::path m_base_path;
 };
 
-using Outputter = tv::variant<AsStringPrinted, AsStringFile>;
+// Every team goes into one file, in the order they finish converting. Each
+// team follows a line with the path it was converted from.
+struct AsStringArchive {
+	explicit AsStringArchive(std::filesystem::path const & path):
+		m_archive(std::make_unique<Archive>(open_text_file_for_writing(path)))
+	{
+	}
+	template<SpecialInputStyle style>
+	auto operator()(InitialTeam<style> const & team, std::filesystem::path const & trailing_path) const -> void {
+		auto const str = to_string(team);
+		auto const lock = std::scoped_lock(m_archive->mutex);
+		m_archive->stream << "=== " << trailing_path.generic_string() << " ===\n" << str << "\n\n";
+	}
+
+private:
+	struct Archive {
+		std::ofstream stream;
+		std::mutex mutex;
+	};
+	std::unique_ptr<Archive> m_archive;
+};
+
+using Outputter = tv::variant<AsStringPrinted, AsStringFile, AsStringArchive>;
 struct ParsedArgs {
 	Outputter outputter;
 	containers::dynamic_array<std::filesystem::path> paths;
@@ -79,13 +116,20 @@ auto parse_args(int argc, char const * const * argv) -> ParsedArgs {
 	if (output_type != OutputType::print and argc < 3) {
 		throw std::runtime_error(invalid_args_message);
 	}
-	auto output_location = [=] {
+	auto output_directory = [=] {
 		auto result = std::filesystem::path(argv[2]);
 		if (std::filesystem::exists(result) and !std::filesystem::is_directory(result)) {
 			throw std::runtime_error("Output location must be a directory");
 		}
 		return result;
 	};
+	auto output_file = [=] {
+		auto result = std::filesystem::path(argv[2]);
+		if (std::filesystem::is_directory(result)) {
+			throw std::runtime_error("Output location must be a file");
+		}
+		return result;
+	};
 	auto get_paths = [=](int const initial) {
 		return containers::dynamic_array<std::filesystem::path>(containers::subrange(argv + initial, argv + argc));
 	};
@@ -93,30 +137,78 @@ auto parse_args(int argc, char const * const * argv) -> ParsedArgs {
 		case OutputType::print:
 			return ParsedArgs{Outputter(AsStringPrinted()), get_paths(2)};
 		case OutputType::text:
-			return ParsedArgs{Outputter(AsStringFile(output_location())), get_paths(3)};
+			return ParsedArgs{Outputter(AsStringFile(output_directory())), get_paths(3)};
+		case OutputType::archive:
+			return ParsedArgs{Outputter(AsStringArchive(output_file())), get_paths(3)};
 	}
 }
 
-} // namespace
+struct Input {
+	std::filesystem::path path;
+	// Where the output goes, relative to the output location
+	std::filesystem::path trailing_path;
+};
 
-auto main(int argc, char ** argv) -> int {
-	auto const args = parse_args(argc, argv);
-	auto error_count = bounded::integer<0, bounded::builtin_max_value<std::uint64_t>>(0_bi);
-	for (auto const & source : args.paths) {
-		for (auto const & path : files_in_path(source)) {
+auto all_inputs(containers::dynamic_array<std::filesystem::path> const & sources) -> containers::vector<Input> {
+	auto result = containers::vector<Input>();
+	for (auto const & source : sources) {
+		auto const is_directory = std::filesystem::is_directory(source);
+		for (auto & path : files_in_path(source)) {
+			auto trailing_path = is_directory ? path.lexically_relative(source) : path.filename();
+			containers::push_back(result, Input(std::move(path), std::move(trailing_path)));
+		}
+	}
+	return result;
+}
+
+struct FileError {
+	std::filesystem::path path;
+	std::string message;
+};
+
+// The files are handed out to the threads in turn. A file that fails to
+// convert is recorded and does not stop the others. Errors are sorted by path
+// so the report does not depend on the number of threads.
+auto convert_all(
+	containers::vector<Input> const & inputs,
+	Outputter const & outputter,
+	std::size_t const thread_count
+) -> containers::vector<FileError> {
+	auto errors = containers::vector<FileError>();
+	auto error_mutex = std::mutex();
+	ps_usage_stats::parallel_for_each(
+		bounded::check_in_range<ps_usage_stats::ThreadCount>(std::max(thread_count, std::size_t(1))),
+		inputs,
+		[&](Input const & input) {
 			try {
 				auto const visitor = [&](auto const & team, auto const & function) {
-					function(team, std::filesystem::is_directory(source) ? path.lexically_relative(source) : path.filename());
+					function(team, input.trailing_path);
 				};
-				tv::visit(load_team_from_file(path), args.outputter, visitor);
+				tv::visit(load_team_from_file(input.path), outputter, visitor);
 			} catch (std::exception const & ex) {
-				std::cerr << ex.what() << '\n';
-				++error_count;
+				auto const lock = std::scoped_lock(error_mutex);
+				containers::push_back(errors, FileError(input.path, ex.what()));
 			}
 		}
+	);
+	std::ranges::sort(errors, std::less(), &FileError::path);
+	return errors;
+}
+
+} // namespace
+
+auto main(int argc, char ** argv) -> int {
+	auto const args = parse_args(argc, argv);
+	auto const errors = convert_all(
+		all_inputs(args.paths),
+		args.outputter,
+		std::max(std::thread::hardware_concurrency(), 1U)
+	);
+	for (auto const & error : errors) {
+		std::cerr << error.path.string() << ": " << error.message << '\n';
 	}
-	if (error_count != 0_bi) {
-		std::cerr << "Completed with " << error_count << " errors\n";
+	if (!containers::is_empty(errors)) {
+		std::cerr << "Completed with " << containers::size(errors) << " errors\n";
 	}
-	return error_count == 0_bi ? 0 : 1;
+	return containers::is_empty(errors) ? 0 : 1;
 }
@@ -31,6 +31,11 @@ auto parse_team(nlohmann::json const & json) {
 		SettingsFile::Team(std::filesystem::path(team));
 }
 
+auto parse_secure(nlohmann::json const & json) -> bool {
+	auto const it = json.find("secure");
+	return it == json.end() ? true : it->get<bool>();
+}
+
 auto parse_style(nlohmann::json const & json) {
 	auto get = [&](std::string_view const str) {
 		return get_string(json, str);
@@ -69,6 +74,7 @@ export auto load_settings_file(std::filesystem::path const & path) -> SettingsFi
 		get("host"),
 		get("port"),
 		get("resource"),
+		parse_secure(settings),
 		std::move(username),
 		get("password"),
 		parse_team(settings),
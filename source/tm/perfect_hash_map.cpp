@@ -0,0 +1,190 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.perfect_hash_map;
+
+import bounded;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+
+// FNV-1a. Accepts any range of char so that lookups can hash a view that
+// transforms the input without first copying it into a string.
+constexpr auto hash(auto const & range) -> std::uint64_t {
+	auto result = std::uint64_t(0xCBF2'9CE4'8422'2325U);
+	for (char const c : range) {
+		result ^= static_cast<std::uint8_t>(c);
+		result *= 0x0000'0100'0000'01B3U;
+	}
+	return result;
+}
+
+// The splitmix64 finalizer. Turns one hash of the key into as many
+// independent hashes as we need without looking at the key again.
+constexpr auto mix(std::uint64_t value, std::uint32_t const seed) -> std::uint64_t {
+	value += static_cast<std::uint64_t>(seed) * 0x9E37'79B9'7F4A'7C15U;
+	value = (value ^ (value >> 30U)) * 0xBF58'476D'1CE4'E5B9U;
+	value = (value ^ (value >> 27U)) * 0x94D0'49BB'1331'11EBU;
+	return value ^ (value >> 31U);
+}
+
+export template<typename Value>
+struct PerfectHashEntry {
+	containers::string_view key;
+	Value value;
+};
+
+// A map from a fixed set of strings, built at compile time. A lookup makes one
+// pass over the key to hash it and compares it against at most one stored key,
+// no matter how many keys there are.
+//
+// The hash of a key picks a bucket. Each bucket stores a seed, chosen so that
+// mixing the hash with it places every key in a different slot.
+export template<typename Value, std::size_t size>
+struct PerfectHashMap {
+	static_assert(size > 0U);
+	static_assert(size < std::numeric_limits<std::uint16_t>::max());
+
+	consteval explicit PerfectHashMap(containers::c_array<PerfectHashEntry<Value>, size> const & entries) {
+		for (auto & slot : m_slots) {
+			slot = empty;
+		}
+		auto hashes = containers::array<std::uint64_t, bounded::constant<size>>();
+		for (auto index = std::size_t(0); index != size; ++index) {
+			containers::at(m_entries, index) = entries[index];
+			containers::at(hashes, index) = hash(entries[index].key);
+		}
+
+		// Group the entries by bucket
+		auto bucket_starts = containers::array<std::size_t, bounded::constant<bucket_count + 1U>>();
+		for (auto const key_hash : hashes) {
+			++containers::at(bucket_starts, bucket_index(key_hash) + 1U);
+		}
+		for (auto bucket = std::size_t(0); bucket != bucket_count; ++bucket) {
+			containers::at(bucket_starts, bucket + 1U) += containers::at(bucket_starts, bucket);
+		}
+		auto grouped = containers::array<std::uint16_t, bounded::constant<size>>();
+		auto next = bucket_starts;
+		for (auto index = std::size_t(0); index != size; ++index) {
+			auto & position = containers::at(next, bucket_index(containers::at(hashes, index)));
+			containers::at(grouped, position) = static_cast<std::uint16_t>(index);
+			++position;
+		}
+
+		auto bucket_size = [&](std::size_t const bucket) {
+			return containers::at(bucket_starts, bucket + 1U) - containers::at(bucket_starts, bucket);
+		};
+		auto entry_in_bucket = [&](std::size_t const bucket, std::size_t const offset) {
+			return containers::at(grouped, containers::at(bucket_starts, bucket) + offset);
+		};
+		auto try_insert = [&](std::size_t const bucket, std::uint32_t const seed) -> bool {
+			for (auto offset = std::size_t(0); offset != bucket_size(bucket); ++offset) {
+				auto const index = entry_in_bucket(bucket, offset);
+				auto & slot = containers::at(m_slots, slot_index(containers::at(hashes, index), seed));
+				if (slot == empty) {
+					slot = index;
+					continue;
+				}
+				if (containers::at(m_entries, slot).key == containers::at(m_entries, index).key) {
+					throw std::runtime_error("Duplicate key in PerfectHashMap");
+				}
+				// Undo what this attempt already inserted
+				for (auto previous = std::size_t(0); previous != offset; ++previous) {
+					auto const previous_hash = containers::at(hashes, entry_in_bucket(bucket, previous));
+					containers::at(m_slots, slot_index(previous_hash, seed)) = empty;
+				}
+				return false;
+			}
+			return true;
+		};
+
+		// Placing the largest buckets first, while most slots are still
+		// empty, keeps the seed search short
+		auto largest_bucket = std::size_t(0);
+		for (auto bucket = std::size_t(0); bucket != bucket_count; ++bucket) {
+			largest_bucket = std::max(largest_bucket, bucket_size(bucket));
+		}
+		for (auto target_size = largest_bucket; target_size != 0U; --target_size) {
+			for (auto bucket = std::size_t(0); bucket != bucket_count; ++bucket) {
+				if (bucket_size(bucket) != target_size) {
+					continue;
+				}
+				auto seed = std::uint32_t(1);
+				while (!try_insert(bucket, seed)) {
+					++seed;
+					if (seed == max_seed) {
+						throw std::runtime_error("Unable to find a perfect hash");
+					}
+				}
+				containers::at(m_seeds, bucket) = seed;
+			}
+		}
+	}
+
+	// `key` can be any range of char, including a lazy view
+	constexpr auto lookup(auto const & key) const -> tv::optional<Value> {
+		auto const key_hash = hash(key);
+		auto const seed = containers::at(m_seeds, bucket_index(key_hash));
+		auto const index = containers::at(m_slots, slot_index(key_hash, seed));
+		if (index == empty) {
+			return tv::none;
+		}
+		auto const & entry = containers::at(m_entries, index);
+		if (!containers::equal(entry.key, key)) {
+			return tv::none;
+		}
+		return entry.value;
+	}
+
+private:
+	static constexpr auto bucket_count = std::bit_ceil(size);
+	static constexpr auto slot_count = bucket_count * 2U;
+	static constexpr auto max_seed = std::uint32_t(100'000);
+	static constexpr auto empty = std::numeric_limits<std::uint16_t>::max();
+
+	static constexpr auto bucket_index(std::uint64_t const key_hash) -> std::size_t {
+		return static_cast<std::size_t>(mix(key_hash, 0U) & (bucket_count - 1U));
+	}
+	static constexpr auto slot_index(std::uint64_t const key_hash, std::uint32_t const seed) -> std::size_t {
+		return static_cast<std::size_t>(mix(key_hash, seed) & (slot_count - 1U));
+	}
+
+	containers::array<PerfectHashEntry<Value>, bounded::constant<size>> m_entries = {};
+	containers::array<std::uint32_t, bounded::constant<bucket_count>> m_seeds = {};
+	// Indexes into `m_entries`
+	containers::array<std::uint16_t, bounded::constant<slot_count>> m_slots = {};
+};
+
+// `Value` must be given, the number of entries is deduced
+export template<typename Value, std::size_t size>
+consteval auto make_perfect_hash_map(containers::c_array<PerfectHashEntry<Value>, size> && entries) {
+	return PerfectHashMap<Value, size>(entries);
+}
+
+constexpr auto test_map = make_perfect_hash_map<int>({
+	{""_s, 0},
+	{"a"_s, 1},
+	{"b"_s, 2},
+	{"ab"_s, 3},
+	{"ba"_s, 4},
+	{"-start"_s, 5},
+	{"start"_s, 6},
+});
+static_assert(*test_map.lookup(""_s) == 0);
+static_assert(*test_map.lookup("a"_s) == 1);
+static_assert(*test_map.lookup("b"_s) == 2);
+static_assert(*test_map.lookup("ab"_s) == 3);
+static_assert(*test_map.lookup("ba"_s) == 4);
+static_assert(*test_map.lookup("-start"_s) == 5);
+static_assert(*test_map.lookup("start"_s) == 6);
+static_assert(!test_map.lookup("c"_s));
+static_assert(!test_map.lookup("aa"_s));
+static_assert(!test_map.lookup("-end"_s));
+
+} // namespace technicalmachine
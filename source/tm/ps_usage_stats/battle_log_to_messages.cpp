@@ -16,6 +16,7 @@ import tm.clients.ps.event_block;
 import tm.clients.ps.in_message;
 import tm.clients.ps.is_chat_message;
 import tm.clients.ps.make_battle_init_message;
+import tm.clients.ps.message_type;
 
 import tm.nlohmann_json;
 
@@ -25,35 +26,44 @@ import std_module;
 import tv;
 
 namespace technicalmachine::ps_usage_stats {
-using namespace containers::string_literals;
 using namespace ps;
 
 constexpr auto is_part_of_previous_chunk = [](InMessage const lhs, InMessage const rhs) {
-	auto matches = [&](InMessage const message, auto const... strs) {
-		return (... or (message.type() == strs));
-	};
-	if (matches(lhs, "teamsize"_s)) {
+	auto const lhs_type = parse_message_type(lhs.type());
+	auto const rhs_type = parse_message_type(rhs.type());
+	if (lhs_type == MessageType::teamsize) {
 		return true;
 	}
-	if (matches(rhs, "teamsize"_s, "inactive"_s, "inactiveoff"_s)) {
-		return false;
+	switch (rhs_type) {
+		case MessageType::teamsize:
+		case MessageType::inactive:
+		case MessageType::inactiveoff:
+			return false;
+		default:
+			break;
 	}
-	if (matches(lhs, "turn"_s)) {
+	if (lhs_type == MessageType::turn) {
 		return false;
 	}
-	if (matches(lhs, "faint"_s) and matches(rhs, ""_s)) {
+	if (lhs_type == MessageType::faint and rhs_type == MessageType::empty) {
 		return false;
 	}
 	return true;
 };
 
 constexpr auto is_potentially_useful = [](InMessage const message) {
-	return
-		!is_chat_message(message) and
-		message.type() != "error"_s and
-		message.type() != "gametype"_s and
-		message.type() != "player"_s and
-		message.type() != "t:"_s;
+	if (is_chat_message(message)) {
+		return false;
+	}
+	switch (parse_message_type(message.type())) {
+		case MessageType::error:
+		case MessageType::gametype:
+		case MessageType::player:
+		case MessageType::battle_timestamp:
+			return false;
+		default:
+			return true;
+	}
 };
 
 export struct BattleLogMessages {
@@ -0,0 +1,351 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.ps_usage_stats.battle_result_block;
+
+import tm.clients.ps.parsed_stats;
+import tm.clients.ps.parsed_team;
+
+import tm.move.move_name;
+import tm.move.move_names;
+
+import tm.pokemon.happiness;
+import tm.pokemon.level;
+import tm.pokemon.max_pokemon_per_team;
+import tm.pokemon.species;
+
+import tm.ps_usage_stats.battle_result;
+import tm.ps_usage_stats.rating;
+
+import tm.status.status_name;
+
+import tm.type.type;
+
+import tm.ability;
+import tm.binary_file_reader;
+import tm.gender;
+import tm.item;
+import tm.to_index;
+import tm.usage_for;
+import tm.visible_hp;
+import tm.write_bytes;
+
+import bounded;
+import containers;
+import tv;
+import std_module;
+
+namespace technicalmachine::ps_usage_stats {
+using namespace bounded::literal;
+
+// The tmmt format is a header followed by a sequence of blocks. Each block is
+// independently decodable and starts with its battle count and payload size,
+// so a reader can build an index of the file by skipping over payloads. Within
+// a block the data is stored column-wise, and the species, item, ability, and
+// move columns are dictionary-encoded against the values used in that block.
+
+export constexpr auto battle_result_magic_string = containers::array{
+	std::byte('t'),
+	std::byte('m'),
+	std::byte(' '),
+	std::byte('m'),
+	std::byte('a'),
+	std::byte('t'),
+	std::byte('c'),
+	std::byte('h'),
+	std::byte(' '),
+	std::byte('t'),
+	std::byte('e'),
+	std::byte('a'),
+	std::byte('m'),
+	std::byte('s')
+};
+
+export using BattleResultVersion = bounded::integer<0, 65535>;
+export constexpr auto battle_result_version = BattleResultVersion(2_bi);
+
+export constexpr auto max_battles_per_block = 4096_bi;
+export using BlockBattleCount = bounded::integer<1, bounded::normalize<max_battles_per_block>>;
+export using BlockPayloadSize = bounded::integer<0, bounded::builtin_max_value<std::uint32_t>>;
+
+export auto write_battle_result_header(std::ostream & stream) -> void {
+	write_bytes(stream, battle_result_magic_string, 14_bi);
+	write_bytes(stream, battle_result_version, 2_bi);
+}
+
+export auto check_battle_result_header(std::istream & stream) -> void {
+	auto const str = read_bytes(stream, containers::size(battle_result_magic_string));
+	if (str != battle_result_magic_string) {
+		throw std::runtime_error("Invalid magic string, this is not a tmmt v2 file");
+	}
+	if (read<BattleResultVersion>(stream) != battle_result_version) {
+		throw std::runtime_error("Invalid version");
+	}
+}
+
+export constexpr auto battle_result_header_size = bounded::size_of<decltype(battle_result_magic_string)> + bounded::size_of<BattleResultVersion>;
+
+namespace {
+
+using Winner = BattleResult::Winner;
+using WinnerIndex = bounded::integer<0, 2>;
+using PokemonCount = bounded::integer<0, bounded::normalize<max_battles_per_block * 2_bi * max_pokemon_per_team>>;
+
+template<typename T>
+using DictionarySize = bounded::integer<0, bounded::normalize<bounded::number_of<T>>>;
+template<typename T>
+using DictionaryIndex = containers::index_type<UsageFor<T>>;
+using NarrowDictionaryIndex = bounded::integer<0, 255>;
+
+template<typename T>
+auto read_raw(std::istream & stream) -> T {
+	return std::bit_cast<T>(read_bytes(stream, bounded::size_of<T>));
+}
+
+template<typename T>
+auto write_column(std::ostream & stream, containers::range auto && values) -> void {
+	for (T const value : values) {
+		write_bytes(stream, value, bounded::size_of<T>);
+	}
+}
+
+template<typename T>
+auto read_column(std::istream & stream, auto const count) -> containers::vector<T> {
+	return containers::vector<T>(containers::generate_n(count, [&] { return read_raw<T>(stream); }));
+}
+
+// The dictionary holds only the values used in the block. Almost all blocks
+// use fewer than 256 distinct values for each column, so the indexes are
+// almost always one byte instead of two.
+template<typename T>
+auto write_dictionary_column(std::ostream & stream, containers::range auto const & values) -> void {
+	auto used = UsageFor<T, bool>();
+	for (T const value : values) {
+		used[to_index(value)] = true;
+	}
+	auto const dictionary = containers::vector<T>(containers::filter(
+		containers::enum_range<T>(),
+		[&](T const value) { return used[to_index(value)]; }
+	));
+	write_bytes(stream, DictionarySize<T>(containers::size(dictionary)), 2_bi);
+	auto positions = UsageFor<T, DictionaryIndex<T>>();
+	for (auto const index : containers::integer_range(containers::size(dictionary))) {
+		auto const value = dictionary[index];
+		write_bytes(stream, value, 2_bi);
+		positions[to_index(value)] = DictionaryIndex<T>(index);
+	}
+	auto const is_narrow = containers::size(dictionary) <= 256_bi;
+	for (T const value : values) {
+		auto const position = positions[to_index(value)];
+		if (is_narrow) {
+			write_bytes(stream, bounded::assume_in_range<NarrowDictionaryIndex>(position), 1_bi);
+		} else {
+			write_bytes(stream, position, 2_bi);
+		}
+	}
+}
+
+template<typename T>
+auto read_dictionary_column(std::istream & stream, auto const count) -> containers::vector<T> {
+	auto const dictionary = containers::vector<T>(containers::generate_n(
+		read<DictionarySize<T>>(stream),
+		[&] { return read<T>(stream); }
+	));
+	auto const is_narrow = containers::size(dictionary) <= 256_bi;
+	return containers::vector<T>(containers::generate_n(count, [&] {
+		auto const index = is_narrow ?
+			DictionaryIndex<T>(read<NarrowDictionaryIndex>(stream)) :
+			read<DictionaryIndex<T>>(stream);
+		return containers::at(dictionary, index);
+	}));
+}
+
+constexpr auto to_winner_index(Winner const winner) -> WinnerIndex {
+	switch (winner) {
+		case Winner::side1: return 0_bi;
+		case Winner::side2: return 1_bi;
+		case Winner::tie: return 2_bi;
+	}
+}
+
+constexpr auto from_winner_index(WinnerIndex const index) -> Winner {
+	switch (index.value()) {
+		case 0: return Winner::side1;
+		case 1: return Winner::side2;
+		case 2: return Winner::tie;
+		default: std::unreachable();
+	}
+}
+
+// Side 1 of every battle, followed by side 2 of every battle
+auto all_sides(containers::span<BattleResult const> const battles) -> containers::vector<BattleResult::Side> {
+	auto result = containers::vector<BattleResult::Side>();
+	for (auto const & battle : battles) {
+		containers::push_back(result, battle.side1);
+	}
+	for (auto const & battle : battles) {
+		containers::push_back(result, battle.side2);
+	}
+	return result;
+}
+
+auto all_pokemon(containers::vector<BattleResult::Side> const & sides) -> containers::vector<ps::ParsedPokemon> {
+	auto result = containers::vector<ps::ParsedPokemon>();
+	for (auto const & side : sides) {
+		containers::append(result, side.team);
+	}
+	return result;
+}
+
+template<typename T>
+auto write_pokemon_column(std::ostream & stream, containers::vector<ps::ParsedPokemon> const & pokemon, auto const get) -> void {
+	write_column<T>(stream, containers::transform(pokemon, get));
+}
+
+using MoveCount = containers::range_size_t<MoveNames>;
+
+} // namespace
+
+// Writes a block header followed by the column-wise payload
+export auto write_battle_result_block(std::ostream & stream, containers::span<BattleResult const> const battles) -> void {
+	auto payload = std::stringstream();
+	write_column<WinnerIndex>(payload, containers::transform(battles, [](BattleResult const & battle) {
+		return to_winner_index(battle.winner);
+	}));
+
+	auto const sides = all_sides(battles);
+	write_column<BattleResult::Side::ID>(payload, containers::transform(sides, [](BattleResult::Side const & side) {
+		return side.id;
+	}));
+	write_column<bool>(payload, containers::transform(sides, [](BattleResult::Side const & side) {
+		return static_cast<bool>(side.rating);
+	}));
+	for (auto const & side : sides) {
+		if (side.rating) {
+			write_bytes(payload, side.rating->value, 8_bi);
+			write_bytes(payload, side.rating->deviation, 8_bi);
+		}
+	}
+	write_column<TeamSize>(payload, containers::transform(sides, [](BattleResult::Side const & side) {
+		return containers::size(side.team);
+	}));
+
+	auto const pokemon = all_pokemon(sides);
+	auto get_species = [](ps::ParsedPokemon const & value) { return value.species; };
+	write_dictionary_column<Species>(payload, containers::transform(pokemon, get_species));
+	write_pokemon_column<Level>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.level; });
+	write_pokemon_column<Gender>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.gender; });
+	write_pokemon_column<StatusName>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.status; });
+	auto get_item = [](ps::ParsedPokemon const & value) { return value.item; };
+	write_dictionary_column<Item>(payload, containers::transform(pokemon, get_item));
+	auto get_ability = [](ps::ParsedPokemon const & value) { return value.ability; };
+	write_dictionary_column<Ability>(payload, containers::transform(pokemon, get_ability));
+	write_pokemon_column<VisibleHP>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.stats.hp; });
+	write_pokemon_column<ps::ParsedStat>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.stats.atk; });
+	write_pokemon_column<ps::ParsedStat>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.stats.def; });
+	write_pokemon_column<ps::ParsedStat>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.stats.spa; });
+	write_pokemon_column<ps::ParsedStat>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.stats.spd; });
+	write_pokemon_column<ps::ParsedStat>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.stats.spe; });
+	write_pokemon_column<MoveCount>(payload, pokemon, [](ps::ParsedPokemon const & value) { return containers::size(value.moves); });
+	auto moves = containers::vector<MoveName>();
+	for (auto const & value : pokemon) {
+		containers::append(moves, value.moves);
+	}
+	write_dictionary_column<MoveName>(payload, moves);
+	write_pokemon_column<tv::optional<Type>>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.hidden_power_type; });
+	write_pokemon_column<Happiness>(payload, pokemon, [](ps::ParsedPokemon const & value) { return value.happiness; });
+
+	auto const bytes = std::move(payload).str();
+	write_bytes(stream, bounded::check_in_range<BlockBattleCount>(containers::size(battles)), 2_bi);
+	write_bytes(stream, bounded::check_in_range<BlockPayloadSize>(bounded::integer(bytes.size())), 4_bi);
+	stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+// Reads the payload of a block, assuming the block header has already been
+// read
+export auto read_battle_result_block(std::istream & stream, BlockBattleCount const battle_count) -> containers::vector<BattleResult> {
+	auto const winners = read_column<WinnerIndex>(stream, battle_count);
+	auto const side_count = battle_count * 2_bi;
+	auto const ids = read_column<BattleResult::Side::ID>(stream, side_count);
+	auto const has_rating = read_column<bool>(stream, side_count);
+	auto ratings = containers::vector<tv::optional<Rating>>();
+	for (auto const present : has_rating) {
+		if (present) {
+			auto const value = read_raw<double>(stream);
+			auto const deviation = read_raw<double>(stream);
+			containers::push_back(ratings, Rating(value, deviation));
+		} else {
+			containers::push_back(ratings, tv::none);
+		}
+	}
+	auto const team_sizes = read_column<TeamSize>(stream, side_count);
+
+	auto const pokemon_count = bounded::assume_in_range<PokemonCount>(containers::sum(team_sizes));
+	auto const species = read_dictionary_column<Species>(stream, pokemon_count);
+	auto const levels = read_column<Level>(stream, pokemon_count);
+	auto const genders = read_column<Gender>(stream, pokemon_count);
+	auto const statuses = read_column<StatusName>(stream, pokemon_count);
+	auto const items = read_dictionary_column<Item>(stream, pokemon_count);
+	auto const abilities = read_dictionary_column<Ability>(stream, pokemon_count);
+	auto const hp = read_column<VisibleHP>(stream, pokemon_count);
+	auto const atk = read_column<ps::ParsedStat>(stream, pokemon_count);
+	auto const def = read_column<ps::ParsedStat>(stream, pokemon_count);
+	auto const spa = read_column<ps::ParsedStat>(stream, pokemon_count);
+	auto const spd = read_column<ps::ParsedStat>(stream, pokemon_count);
+	auto const spe = read_column<ps::ParsedStat>(stream, pokemon_count);
+	auto const move_counts = read_column<MoveCount>(stream, pokemon_count);
+	auto const moves = read_dictionary_column<MoveName>(stream, containers::sum(move_counts));
+	auto const hidden_power_types = read_column<tv::optional<Type>>(stream, pokemon_count);
+	auto const happiness = read_column<Happiness>(stream, pokemon_count);
+
+	auto teams = containers::vector<ps::ParsedTeam>();
+	auto pokemon_index = containers::index_type<containers::vector<Species>>(0_bi);
+	auto move_index = containers::index_type<containers::vector<MoveName>>(0_bi);
+	for (auto const team_size : team_sizes) {
+		auto team = ps::ParsedTeam();
+		for ([[maybe_unused]] auto const _ : containers::integer_range(team_size)) {
+			auto pokemon_moves = MoveNames();
+			for ([[maybe_unused]] auto const __ : containers::integer_range(move_counts[pokemon_index])) {
+				containers::push_back(pokemon_moves, moves[move_index]);
+				++move_index;
+			}
+			containers::push_back(team, ps::ParsedPokemon{
+				.species = species[pokemon_index],
+				.level = levels[pokemon_index],
+				.gender = genders[pokemon_index],
+				.status = statuses[pokemon_index],
+				.item = items[pokemon_index],
+				.ability = abilities[pokemon_index],
+				.stats = {
+					hp[pokemon_index],
+					atk[pokemon_index],
+					def[pokemon_index],
+					spa[pokemon_index],
+					spd[pokemon_index],
+					spe[pokemon_index]
+				},
+				.moves = pokemon_moves,
+				.hidden_power_type = hidden_power_types[pokemon_index],
+				.happiness = happiness[pokemon_index]
+			});
+			++pokemon_index;
+		}
+		containers::push_back(teams, std::move(team));
+	}
+
+	return containers::vector<BattleResult>(containers::transform(
+		containers::integer_range(battle_count),
+		[&](auto const index) {
+			auto const other_index = index + battle_count;
+			return BattleResult{
+				{teams[index], ids[index], ratings[index]},
+				{teams[other_index], ids[other_index], ratings[other_index]},
+				from_winner_index(winners[index])
+			};
+		}
+	));
+}
+
+} // namespace technicalmachine::ps_usage_stats
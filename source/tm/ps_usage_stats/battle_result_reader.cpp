@@ -6,6 +6,7 @@
 export module tm.ps_usage_stats.battle_result_reader;
 
 import tm.ps_usage_stats.battle_result;
+import tm.ps_usage_stats.battle_result_block;
 
 import tm.binary_file_reader;
 import tm.open_file;
@@ -17,25 +18,77 @@ import std_module;
 namespace technicalmachine::ps_usage_stats {
 using namespace bounded::literal;
 
-auto compute_number_of_battles(std::filesystem::path const & path) {
-	auto const file_size = std::filesystem::file_size(path);
-	constexpr auto element_size = bounded::size_of<BattleResult>;
-	if (file_size % element_size != 0_bi) {
-		throw std::runtime_error("Invalid file size");
+export struct BattleResultBlock {
+	std::streamoff offset;
+	BlockBattleCount battles;
+};
+
+// Every block in the file, in order. This reads only the block headers, so
+// callers can split the blocks between threads or read a subrange of the file
+// without decoding the rest.
+export auto battle_result_blocks(std::filesystem::path const & path) -> containers::vector<BattleResultBlock> {
+	auto const file_size = static_cast<std::streamoff>(std::filesystem::file_size(path));
+	auto file = open_binary_file_for_reading(path);
+	check_battle_result_header(file);
+	auto result = containers::vector<BattleResultBlock>();
+	auto offset = static_cast<std::streamoff>(file.tellg());
+	while (offset != file_size) {
+		if (offset > file_size) {
+			throw std::runtime_error("Inconsistent file size");
+		}
+		auto const battles = read<BlockBattleCount>(file);
+		auto const payload_size = read<BlockPayloadSize>(file);
+		containers::push_back(result, BattleResultBlock(offset, battles));
+		file.seekg(static_cast<std::streamoff>(payload_size), std::ios_base::cur);
+		offset = static_cast<std::streamoff>(file.tellg());
 	}
-	return bounded::integer(file_size) / element_size;
+	return result;
 }
 
-export auto battle_result_reader(std::filesystem::path const & path) {
+export auto read_battle_result_block(std::istream & stream, BattleResultBlock const block) -> containers::vector<BattleResult> {
+	stream.seekg(block.offset);
+	auto const battles = read<BlockBattleCount>(stream);
+	if (battles != block.battles) {
+		throw std::runtime_error("Inconsistent block index");
+	}
+	[[maybe_unused]] auto const payload_size = read<BlockPayloadSize>(stream);
+	return read_battle_result_block(stream, battles);
+}
+
+export constexpr auto total_battles(containers::vector<BattleResultBlock> const & blocks) {
+	return containers::sum(containers::transform(blocks, [](BattleResultBlock const block) {
+		return bounded::integer(block.battles);
+	}));
+}
+
+export auto battle_result_reader(std::filesystem::path const & path, containers::vector<BattleResultBlock> blocks) {
+	auto const size = total_battles(blocks);
 	return containers::generate_n(
-		compute_number_of_battles(path),
-		[file = open_binary_file_for_reading(path)]() mutable {
-			if (!file) {
-				throw std::runtime_error("Inconsistent file size");
+		size,
+		[
+			file = open_binary_file_for_reading(path),
+			blocks = std::move(blocks),
+			block_index = containers::index_type<containers::vector<BattleResultBlock>>(0_bi),
+			buffer = containers::vector<BattleResult>(),
+			buffer_index = containers::index_type<containers::vector<BattleResult>>(0_bi)
+		]() mutable {
+			if (buffer_index == containers::size(buffer)) {
+				if (block_index == containers::size(blocks)) {
+					throw std::runtime_error("Inconsistent file size");
+				}
+				buffer = read_battle_result_block(file, blocks[block_index]);
+				++block_index;
+				buffer_index = 0_bi;
 			}
-			return std::bit_cast<BattleResult>(read_bytes(file, bounded::size_of<BattleResult>));
+			auto result = std::move(buffer[buffer_index]);
+			++buffer_index;
+			return result;
 		}
 	);
 }
 
-} // namespace technicalmachine::ps_usage_stats
\ No newline at end of file
+export auto battle_result_reader(std::filesystem::path const & path) {
+	return battle_result_reader(path, battle_result_blocks(path));
+}
+
+} // namespace technicalmachine::ps_usage_stats
@@ -6,27 +6,61 @@
 export module tm.ps_usage_stats.battle_result_writer;
 
 import tm.ps_usage_stats.battle_result;
+import tm.ps_usage_stats.battle_result_block;
 
 import tm.open_file;
 
+import containers;
 import std_module;
 
 namespace technicalmachine::ps_usage_stats {
 
+// Buffers up to one block of results in memory. `finish` writes the final
+// partial block. A writer destroyed without calling `finish`, for instance
+// while an exception is propagating, still tries to write that block but only
+// reports an error.
 export struct BattleResultWriter {
 	BattleResultWriter(std::filesystem::path const & path):
 		m_file(open_binary_file_for_writing(path))
 	{
+		write_battle_result_header(m_file);
+	}
+	BattleResultWriter(BattleResultWriter &&) = delete;
+	BattleResultWriter(BattleResultWriter const &) = delete;
+	auto operator=(BattleResultWriter &&) -> BattleResultWriter & = delete;
+	auto operator=(BattleResultWriter const &) -> BattleResultWriter & = delete;
+
+	~BattleResultWriter() {
+		try {
+			flush();
+		} catch (std::exception const & ex) {
+			std::cerr << "Unable to write the final battle results: " << ex.what() << '\n';
+		}
 	}
 
 	auto operator()(BattleResult const & battle) -> void {
-		static_assert(std::is_standard_layout_v<BattleResult>);
-		static_assert(std::is_trivially_copyable_v<BattleResult>);
-		m_file.write(reinterpret_cast<char const *>(std::addressof(battle)), sizeof(battle));
+		containers::push_back(m_buffer, battle);
+		if (containers::size(m_buffer) == max_battles_per_block) {
+			flush();
+		}
+	}
+
+	auto finish() -> void {
+		flush();
+		m_file.flush();
 	}
 
 private:
+	auto flush() -> void {
+		if (containers::is_empty(m_buffer)) {
+			return;
+		}
+		write_battle_result_block(m_file, m_buffer);
+		m_buffer.clear();
+	}
+
 	std::ofstream m_file;
+	containers::vector<BattleResult> m_buffer;
 };
 
 } // namespace technicalmachine::ps_usage_stats
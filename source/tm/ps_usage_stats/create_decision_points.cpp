@@ -0,0 +1,82 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+import tm.ps_usage_stats.battle_log_to_messages;
+import tm.ps_usage_stats.decision_point;
+import tm.ps_usage_stats.decision_point_file;
+import tm.ps_usage_stats.for_each_log;
+import tm.ps_usage_stats.rated_side;
+import tm.ps_usage_stats.thread_count;
+
+import tm.team_predictor.all_usage_stats;
+
+import bounded;
+import containers;
+import std_module;
+
+namespace technicalmachine::ps_usage_stats {
+using namespace containers::string_literals;
+
+struct ParsedArgs {
+	ThreadCount thread_count;
+	std::filesystem::path input_directory;
+	std::filesystem::path output_directory;
+};
+
+auto parse_args(int argc, char const * const * argv) -> ParsedArgs {
+	if (argc != 4) {
+		throw std::runtime_error("Usage is create_decision_points thread_count input_directory output_directory");
+	}
+	auto const thread_count = bounded::to_integer<ThreadCount>(argv[1]);
+	auto input_directory = std::filesystem::path(argv[2]);
+	if (!std::filesystem::exists(input_directory)) {
+		throw std::runtime_error(containers::concatenate<std::string>(input_directory.string(), " does not exist"_s));
+	}
+	auto output_directory = std::filesystem::path(argv[3]);
+	if (std::filesystem::exists(output_directory)) {
+		throw std::runtime_error(containers::concatenate<std::string>(output_directory.string(), " already exists"_s));
+	}
+	return ParsedArgs(
+		thread_count,
+		std::move(input_directory),
+		std::move(output_directory)
+	);
+}
+
+// Replays every log once and records each decision either side made, so that
+// strategies can be evaluated without parsing or replaying the logs again
+auto create_decision_points(ThreadCount const thread_count, std::filesystem::path const & input_directory, std::filesystem::path const & output_directory) -> std::uint64_t {
+	auto const all_usage_stats = AllUsageStats();
+	auto writer = DecisionPointWriter(output_directory);
+	auto const count = for_each_log(
+		thread_count,
+		input_directory,
+		[&](
+			std::filesystem::path const & input_file,
+			RatedSide const & side,
+			BattleLogMessages const & battle_messages
+		) {
+			auto const result = decision_points(input_file, all_usage_stats, side, battle_messages);
+			for (auto const & point : result.points) {
+				writer(point);
+			}
+			writer.unprocessed(battle_messages.init.generation, result.unprocessed_inputs);
+			return static_cast<std::uint64_t>(containers::size(result.points));
+		}
+	);
+	writer.finish();
+	return count;
+}
+
+} // namespace technicalmachine::ps_usage_stats
+
+auto main(int argc, char ** argv) -> int {
+	using namespace technicalmachine::ps_usage_stats;
+	auto const args = parse_args(argc, argv);
+	std::filesystem::create_directories(args.output_directory);
+	auto const count = create_decision_points(args.thread_count, args.input_directory, args.output_directory);
+	std::cout << "Wrote " << count << " decision points\n";
+	return 0;
+}
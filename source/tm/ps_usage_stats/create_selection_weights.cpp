@@ -32,6 +32,7 @@ import tm.ps_usage_stats.thread_count;
 
 import tm.stat.hp;
 
+import tm.compress;
 import tm.generation;
 import tm.get_legal_selections;
 import tm.hp_bucket;
@@ -39,7 +40,6 @@ import tm.open_file;
 import tm.state;
 import tm.team;
 import tm.to_index;
-import tm.usage_for;
 import tm.write_bytes;
 
 import bounded;
@@ -212,10 +212,76 @@ private:
 	Usage m_switch_in_chances = 0_bi;
 };
 
-using PerUser = UsageFor<HPBucket, concurrent::locked_access<PerMatchup>>;
-using PerOtherHP = UsageFor<Species, PerUser>;
-using PerOther = UsageFor<HPBucket, PerOtherHP>;
-using SelectionWeightsMaker = UsageFor<Species, PerOther>;
+struct MatchupKey {
+	Species other;
+	HPBucket other_hp;
+	Species user;
+	HPBucket user_hp;
+
+	friend auto operator<=>(MatchupKey, MatchupKey) = default;
+};
+
+constexpr auto compress(MatchupKey const key) {
+	return compress_combine(key.other, key.other_hp, key.user, key.user_hp);
+}
+
+struct MatchupHash {
+	static constexpr auto operator()(MatchupKey const key) -> std::size_t {
+		return static_cast<std::size_t>(compress(key));
+	}
+};
+
+// Real data touches only a tiny fraction of all possible matchups, so storage
+// is sparse. Entries are spread across shards so that threads processing
+// different matchups rarely contend on the same lock.
+struct SelectionWeightsMaker {
+	// `function` has exclusive access to the matchup while it runs. It must not
+	// access any other matchup.
+	auto update(MatchupKey const key, auto const function) -> void {
+		auto const shard = m_shards[shard_index(key)].locked();
+		function(shard.value()[key]);
+	}
+
+	// Requires exclusive access to `this`. Visits the matchups one shard at a
+	// time, sorted by key within each shard, so the output does not depend on
+	// the order in which threads inserted them. Each shard is freed once it has
+	// been visited, so memory use goes down as the file is written rather than
+	// holding an index of every matchup.
+	auto consume(auto const function) && -> void {
+		auto entries = containers::vector<Entry>();
+		for (auto & shard : m_shards) {
+			auto const locked = shard.locked();
+			auto & map = locked.value();
+			entries.clear();
+			for (auto const & element : map) {
+				containers::push_back(entries, Entry(element.first, std::addressof(element.second)));
+			}
+			containers::sort(entries, [](Entry const lhs, Entry const rhs) {
+				return lhs.key < rhs.key;
+			});
+			for (auto const entry : entries) {
+				function(entry.key, *entry.matchup);
+			}
+			map = Shard();
+		}
+	}
+
+private:
+	struct Entry {
+		MatchupKey key;
+		PerMatchup const * matchup;
+	};
+
+	static constexpr auto shard_count = 256_bi;
+	using Shard = std::unordered_map<MatchupKey, PerMatchup, MatchupHash>;
+	using Shards = containers::array<concurrent::locked_access<Shard>, shard_count>;
+
+	static constexpr auto shard_index(MatchupKey const key) -> containers::index_type<Shards> {
+		return compress(key) % shard_count;
+	}
+
+	Shards m_shards;
+};
 
 auto update_weights_for_one_side_of_battle(
 	std::filesystem::path const & input_file,
@@ -233,21 +299,22 @@ auto update_weights_for_one_side_of_battle(
 		auto const last = containers::end(std::move(selections));
 		for (; first != last; ++first) {
 			auto const & [state, input] = *first;
-			auto & other_hp_weights = weights[to_index(state.other.species)];
-			auto & user_weights = other_hp_weights[to_hp_bucket(state.other.hp)];
-			auto const user_pokemon = state.user.pokemon[to_index(state.user.active)];
-			auto & user_hp_weights = user_weights[to_index(user_pokemon.species)];
-			auto & get_weight = user_hp_weights[to_hp_bucket(user_pokemon.hp)];
+			auto const other_hp = to_hp_bucket(state.other.hp);
+			auto const key_for = [&](RelevantPokemon const user) {
+				return MatchupKey(state.other.species, other_hp, user.species, to_hp_bucket(user.hp));
+			};
+			auto const user_key = key_for(state.user.pokemon[to_index(state.user.active)]);
 			tv::visit(input, tv::overload(
 				[&](MoveName const move) {
-					auto const weight = get_weight.locked();
-					for (auto const possible : state.user.moves) {
-						if (move == possible) {
-							weight.value().used(possible);
-						} else {
-							weight.value().did_not_use(possible);
+					weights.update(user_key, [&](PerMatchup & weight) {
+						for (auto const possible : state.user.moves) {
+							if (move == possible) {
+								weight.used(possible);
+							} else {
+								weight.did_not_use(possible);
+							}
 						}
-					}
+					});
 				},
 				[&](ps::BattleResponseSwitch const switch_) {
 					auto const team_size = containers::size(state.user.pokemon);
@@ -255,20 +322,20 @@ auto update_weights_for_one_side_of_battle(
 						if (index == state.user.active) {
 							continue;
 						}
-						auto const replacement = state.user.pokemon[index];
-						auto & replacement_hp_weights = user_weights[to_index(replacement.species)];
-						auto const weight = replacement_hp_weights[to_hp_bucket(replacement.hp)].locked();
-						if (state.slot_memory.reverse_lookup(switch_) == index) {
-							weight.value().switched_in(bounded::assume_in_range<TeamSize>(team_size - 1_bi));
-						} else {
-							weight.value().did_not_switch_in();
-						}
-					}
-					auto const weight = get_weight.locked();
-					for (auto const possible : state.user.moves) {
-						weight.value().did_not_use(possible);
+						weights.update(key_for(state.user.pokemon[index]), [&](PerMatchup & weight) {
+							if (state.slot_memory.reverse_lookup(switch_) == index) {
+								weight.switched_in(bounded::assume_in_range<TeamSize>(team_size - 1_bi));
+							} else {
+								weight.did_not_switch_in();
+							}
+						});
 					}
-					weight.value().switched_out();
+					weights.update(user_key, [&](PerMatchup & weight) {
+						for (auto const possible : state.user.moves) {
+							weight.did_not_use(possible);
+						}
+						weight.switched_out();
+					});
 				}
 			));
 		}
@@ -278,38 +345,28 @@ auto update_weights_for_one_side_of_battle(
 	}
 }
 
-// Requires exclusive access to `weights`
-auto write_to_file(std::ostream & stream, SelectionWeightsMaker const & weights) {
-	constexpr auto bucket_range = containers::integer_range(bounded::number_of<HPBucket>);
-	for (auto const other : containers::enum_range<Species>()) {
-		auto const & per_other = weights[to_index(other)];
-		for (auto const other_hp : bucket_range) {
-			auto const & per_other_hp = per_other[other_hp];
-			for (auto const user : containers::enum_range<Species>()) {
-				auto const & per_user = per_other_hp[to_index(user)];
-				for (auto const user_hp : bucket_range) {
-					auto const & per_matchup = per_user[user_hp].unlocked();
-					auto const switch_out_weight = per_matchup.switch_out_weight();
-					auto const switch_in_multiplier = per_matchup.switch_in_multiplier();
-					auto const move_weights = per_matchup.move_weights();
-					if (switch_out_weight == 0.0 and switch_in_multiplier == 0.0 and containers::is_empty(move_weights)) {
-						continue;
-					}
-					write_bytes(stream, other, 2_bi);
-					write_bytes(stream, other_hp, 1_bi);
-					write_bytes(stream, user, 2_bi);
-					write_bytes(stream, user_hp, 1_bi);
-					write_bytes(stream, switch_out_weight, 8_bi);
-					write_bytes(stream, switch_in_multiplier, 8_bi);
-					write_bytes(stream, containers::size(move_weights), 2_bi);
-					for (auto const & value : move_weights) {
-						write_bytes(stream, value.move, 2_bi);
-						write_bytes(stream, value.weight, 8_bi);
-					}
-				}
-			}
+// Requires exclusive access to `weights`. Each matchup is written as soon as
+// it is visited, and the reader does not depend on the order of the matchups.
+auto write_to_file(std::ostream & stream, SelectionWeightsMaker && weights) -> void {
+	std::move(weights).consume([&](MatchupKey const key, PerMatchup const & per_matchup) {
+		auto const switch_out_weight = per_matchup.switch_out_weight();
+		auto const switch_in_multiplier = per_matchup.switch_in_multiplier();
+		auto const move_weights = per_matchup.move_weights();
+		if (switch_out_weight == 0.0 and switch_in_multiplier == 0.0 and containers::is_empty(move_weights)) {
+			return;
 		}
-	}
+		write_bytes(stream, key.other, 2_bi);
+		write_bytes(stream, key.other_hp, 1_bi);
+		write_bytes(stream, key.user, 2_bi);
+		write_bytes(stream, key.user_hp, 1_bi);
+		write_bytes(stream, switch_out_weight, 8_bi);
+		write_bytes(stream, switch_in_multiplier, 8_bi);
+		write_bytes(stream, containers::size(move_weights), 2_bi);
+		for (auto const & value : move_weights) {
+			write_bytes(stream, value.move, 2_bi);
+			write_bytes(stream, value.weight, 8_bi);
+		}
+	});
 }
 
 auto create_selection_weights(SelectionWeightsMaker & weights, ThreadCount const thread_count, std::filesystem::path const & input_directory) -> void {
@@ -338,9 +395,9 @@ auto main(int argc, char ** argv) -> int {
 	using namespace technicalmachine;
 	using namespace technicalmachine::ps_usage_stats;
 	auto const args = parse_args(argc, argv);
-	auto weights = std::make_unique<SelectionWeightsMaker>();
-	create_selection_weights(*weights, args.thread_count, args.input_directory);
+	auto weights = SelectionWeightsMaker();
+	create_selection_weights(weights, args.thread_count, args.input_directory);
 	auto out_file = open_binary_file_for_writing(args.output_file);
-	write_to_file(out_file, *weights);
+	write_to_file(out_file, std::move(weights));
 	return 0;
 }
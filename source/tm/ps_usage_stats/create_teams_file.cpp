@@ -69,6 +69,7 @@ auto turn_logs_into_team_file(std::filesystem::path const & output_file, ThreadC
 			}
 		}
 	);
+	battle_result_writer.finish();
 }
 
 } // namespace
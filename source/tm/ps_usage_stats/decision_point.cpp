@@ -0,0 +1,108 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.ps_usage_stats.decision_point;
+
+import tm.clients.ps.battle_message_handler;
+import tm.clients.ps.slot_memory;
+
+import tm.clients.party;
+
+import tm.move.legal_selections;
+import tm.move.pass;
+
+import tm.ps_usage_stats.battle_log_to_messages;
+import tm.ps_usage_stats.parse_input_log;
+import tm.ps_usage_stats.rated_side;
+
+import tm.team_predictor.all_usage_stats;
+import tm.team_predictor.team_predictor;
+import tm.team_predictor.usage_stats;
+
+import tm.generation;
+import tm.generation_generic;
+import tm.get_legal_selections;
+import tm.state;
+import tm.team;
+import tm.team_is_empty;
+
+import bounded;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine::ps_usage_stats {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+
+// What one side could see when it had to make a choice, and what it chose
+export template<Generation generation>
+struct DecisionPoint {
+	VisibleState<generation> state;
+	ps::SlotMemory slot_memory;
+	PlayerInput input;
+
+	friend auto operator==(DecisionPoint const &, DecisionPoint const &) -> bool = default;
+};
+
+// The foe's team is filled in the same way a strategy would see it, so this
+// skips exactly the states in which any strategy can only pass
+template<Generation generation>
+auto has_decision(VisibleState<generation> const & state, UsageStats const & usage_stats) -> bool {
+	if (team_is_empty(state.ai) or team_is_empty(state.foe)) {
+		return false;
+	}
+	auto const user_team = Team<generation>(state.ai);
+	auto const predicted_team = most_likely_team(usage_stats, state.foe);
+	return get_legal_selections(user_team, predicted_team, state.environment) != LegalSelections({pass});
+}
+
+export struct SideDecisionPoints {
+	containers::vector<GenerationGeneric<DecisionPoint>> points;
+	// Inputs after an error in replaying the battle
+	std::uint64_t unprocessed_inputs;
+};
+
+// Replays the battle from the point of view of one side. Each state that
+// requires a choice is paired with the next input that side sent. If the
+// battle cannot be replayed to the end, this returns the decision points
+// before the error, and counts the inputs after it as unprocessed.
+export auto decision_points(
+	std::filesystem::path const & input_file,
+	AllUsageStats const & all_usage_stats,
+	RatedSide const & rated_side,
+	BattleLogMessages const & battle_messages
+) -> SideDecisionPoints {
+	auto result = SideDecisionPoints();
+	try {
+		auto battle = ps::BattleMessageHandler(rated_side.side.party, rated_side.side.team, battle_messages.init);
+		auto const usage_stats = all_usage_stats[battle_messages.init.generation];
+		auto input = containers::begin(rated_side.inputs);
+		auto const last_input = containers::end(rated_side.inputs);
+		for (auto const & message : battle_messages.messages) {
+			if (input == last_input) {
+				break;
+			}
+			auto point = tv::visit(battle.state(), [&]<Generation generation>(VisibleState<generation> const & state) -> tv::optional<GenerationGeneric<DecisionPoint>> {
+				if (!has_decision(state, *usage_stats)) {
+					return tv::none;
+				}
+				return GenerationGeneric<DecisionPoint>(DecisionPoint<generation>(state, battle.slot_memory(), *input));
+			});
+			battle.handle_message(message);
+			if (point) {
+				containers::push_back(result.points, std::move(*point));
+				++input;
+			}
+		}
+	} catch (std::exception const & ex) {
+		auto const party_str = rated_side.side.party == Party(0_bi) ? "p1"_s : "p2"_s;
+		std::cerr << "Unable to process " << input_file.string() << ", side " << party_str << ": " << ex.what() << ", skipping the rest of the battle\n";
+		result.unprocessed_inputs = static_cast<std::uint64_t>(containers::size(rated_side.inputs) - containers::size(result.points));
+	}
+	return result;
+}
+
+} // namespace technicalmachine::ps_usage_stats
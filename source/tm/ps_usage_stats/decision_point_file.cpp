@@ -0,0 +1,182 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.ps_usage_stats.decision_point_file;
+
+import tm.ps_usage_stats.decision_point;
+
+import tm.string_conversions.generation;
+
+import tm.binary_file_reader;
+import tm.constant_generation;
+import tm.generation;
+import tm.generation_generic;
+import tm.open_file;
+import tm.write_bytes;
+
+import bounded;
+import concurrent;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine::ps_usage_stats {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+
+// The tmdp format is a header followed by an array of `DecisionPoint`, stored
+// exactly as they are laid out in memory, and then the number of inputs that
+// could not be paired with a decision point because their battle could not be
+// replayed. There is one file per generation.
+// Reading a record is a copy with no parsing, but the file can be read only by
+// a build with the same layout. The record size in the header catches most
+// mismatches; the version must be changed whenever the layout changes in a way
+// that keeps the same size.
+
+constexpr auto magic_string = containers::array{
+	std::byte('t'),
+	std::byte('m'),
+	std::byte(' '),
+	std::byte('d'),
+	std::byte('e'),
+	std::byte('c'),
+	std::byte('i'),
+	std::byte('s'),
+	std::byte('i'),
+	std::byte('o'),
+	std::byte('n'),
+	std::byte('s')
+};
+
+using Version = bounded::integer<0, 65535>;
+constexpr auto version = Version(2_bi);
+
+using RecordSize = bounded::integer<0, bounded::builtin_max_value<std::uint32_t>>;
+
+constexpr auto header_size = bounded::size_of<decltype(magic_string)> + bounded::size_of<Version> + 1_bi + bounded::size_of<RecordSize>;
+
+using UnprocessedInputs = bounded::integer<0, bounded::builtin_max_value<std::uint64_t>>;
+constexpr auto trailer_size = bounded::size_of<UnprocessedInputs>;
+
+template<Generation generation>
+constexpr auto record_size = bounded::size_of<DecisionPoint<generation>>;
+
+template<Generation generation>
+auto write_header(std::ostream & stream) -> void {
+	write_bytes(stream, magic_string, 12_bi);
+	write_bytes(stream, version, 2_bi);
+	write_bytes(stream, generation, 1_bi);
+	write_bytes(stream, RecordSize(record_size<generation>), 4_bi);
+}
+
+export auto decision_point_generation(std::istream & stream) -> Generation {
+	auto const str = read_bytes(stream, containers::size(magic_string));
+	if (str != magic_string) {
+		throw std::runtime_error("Invalid magic string, this is not a tmdp file");
+	}
+	if (read<Version>(stream) != version) {
+		throw std::runtime_error("Invalid version");
+	}
+	return read<Generation>(stream);
+}
+
+export auto decision_point_generation(std::filesystem::path const & path) -> Generation {
+	auto file = open_binary_file_for_reading(path);
+	return decision_point_generation(file);
+}
+
+export auto decision_point_path(std::filesystem::path const & directory, Generation const generation) -> std::filesystem::path {
+	return directory / containers::concatenate<std::string>("gen"_s, to_string(generation), ".tmdp"_s);
+}
+
+// Can be called from any number of threads at once. Each generation's file is
+// created the first time anything from that generation is written. `finish`
+// must be called once everything has been written.
+export struct DecisionPointWriter {
+	explicit DecisionPointWriter(std::filesystem::path directory):
+		m_directory(std::move(directory))
+	{
+	}
+
+	auto operator()(GenerationGeneric<DecisionPoint> const & point) -> void {
+		tv::visit(point, [&]<Generation generation>(DecisionPoint<generation> const & value) {
+			auto const file = m_files[bounded::integer(generation) - 1_bi].locked();
+			write_bytes(open<generation>(file.value()), value, record_size<generation>);
+		});
+	}
+
+	auto unprocessed(Generation const generation, std::uint64_t const count) -> void {
+		m_unprocessed[bounded::integer(generation) - 1_bi] += count;
+	}
+
+	auto finish() & -> void {
+		for (auto const generation : containers::enum_range<Generation>()) {
+			auto const index = bounded::integer(generation) - 1_bi;
+			auto const unprocessed = UnprocessedInputs(bounded::integer(m_unprocessed[index].load()));
+			auto const file = m_files[index].locked();
+			if (!file.value() and unprocessed == 0_bi) {
+				continue;
+			}
+			constant_generation(generation, [&]<Generation g>(constant_gen_t<g>) {
+				write_bytes(open<g>(file.value()), unprocessed, trailer_size);
+			});
+		}
+	}
+
+private:
+	template<Generation generation>
+	auto open(tv::optional<std::ofstream> & file) const -> std::ofstream & {
+		if (!file) {
+			file.emplace([&] {
+				auto stream = open_binary_file_for_writing(decision_point_path(m_directory, generation));
+				write_header<generation>(stream);
+				return stream;
+			});
+		}
+		return *file;
+	}
+
+	std::filesystem::path m_directory;
+	containers::array<concurrent::locked_access<tv::optional<std::ofstream>>, bounded::number_of<Generation>> m_files;
+	containers::array<std::atomic<std::uint64_t>, bounded::number_of<Generation>> m_unprocessed;
+};
+
+export template<Generation generation>
+struct DecisionPoints {
+	containers::vector<DecisionPoint<generation>> points;
+	// Each one is scored as the worst possible prediction
+	std::uint64_t unprocessed_inputs;
+};
+
+// Reads the entire file at once so that callers can index into it
+export template<Generation generation>
+auto read_decision_points(std::filesystem::path const & path) -> DecisionPoints<generation> {
+	auto const file_size = std::filesystem::file_size(path);
+	if (file_size < static_cast<std::uintmax_t>(header_size + trailer_size)) {
+		throw std::runtime_error(containers::concatenate<std::string>(path.string(), " is too small to be a tmdp file"_s));
+	}
+	auto file = open_binary_file_for_reading(path);
+	if (decision_point_generation(file) != generation) {
+		throw std::runtime_error(containers::concatenate<std::string>(path.string(), " is not for generation "_s, to_string(generation)));
+	}
+	if (read<RecordSize>(file) != record_size<generation>) {
+		throw std::runtime_error(containers::concatenate<std::string>(path.string(), " was created by a build with a different layout"_s));
+	}
+	auto const payload_size = file_size - static_cast<std::uintmax_t>(header_size + trailer_size);
+	auto const size = static_cast<std::uintmax_t>(record_size<generation>);
+	if (payload_size % size != 0U) {
+		throw std::runtime_error(containers::concatenate<std::string>(path.string(), " has a partial record"_s));
+	}
+	auto points = containers::vector<DecisionPoint<generation>>(containers::generate_n(
+		bounded::integer(payload_size / size),
+		[&] {
+			return std::bit_cast<DecisionPoint<generation>>(read_bytes(file, record_size<generation>));
+		}
+	));
+	auto const unprocessed_inputs = read<UnprocessedInputs>(file);
+	return DecisionPoints<generation>(std::move(points), static_cast<std::uint64_t>(unprocessed_inputs));
+}
+
+} // namespace technicalmachine::ps_usage_stats
@@ -8,6 +8,7 @@ export module tm.ps_usage_stats.for_each_log;
 import tm.clients.party;
 
 import tm.ps_usage_stats.battle_log_to_messages;
+import tm.ps_usage_stats.battle_result;
 import tm.ps_usage_stats.files_in_directory;
 import tm.ps_usage_stats.parallel_for_each;
 import tm.ps_usage_stats.parse_input_log;
@@ -24,15 +25,33 @@ import std_module;
 namespace technicalmachine::ps_usage_stats {
 using namespace bounded::literal;
 
+// `process_log` can also accept the other side of the battle, which has the
+// team that side actually brought rather than only what was revealed
+auto call_process_log(
+	auto const & process_log,
+	std::filesystem::path const & input_file,
+	RatedSide const & side,
+	BattleLogMessages const & battle_messages,
+	BattleResult::Side const & foe
+) {
+	if constexpr (requires { process_log(input_file, side, battle_messages, foe); }) {
+		return process_log(input_file, side, battle_messages, foe);
+	} else {
+		return process_log(input_file, side, battle_messages);
+	}
+}
+
 export auto for_each_log(
 	ThreadCount const thread_count,
 	std::filesystem::path const & input_directory,
 	auto process_log
 ) {
-	using Accumulate = decltype(process_log(
+	using Accumulate = decltype(call_process_log(
+		process_log,
 		bounded::declval<std::filesystem::path const &>(),
 		bounded::declval<RatedSide const &>(),
-		bounded::declval<BattleLogMessages const &>()
+		bounded::declval<BattleLogMessages const &>(),
+		bounded::declval<BattleResult::Side const &>()
 	));
 	auto accumulator = containers::dynamic_array(containers::repeat_default_n<Accumulate>(thread_count));
 	parallel_for_each(
@@ -49,8 +68,8 @@ export auto for_each_log(
 			auto const side1 = RatedSide(Party(0_bi), battle_result->side1, input_log.side1);
 			auto const side2 = RatedSide(Party(1_bi), battle_result->side2, input_log.side2);
 			accumulator[index] +=
-				process_log(input_file, side1, battle_messages) +
-				process_log(input_file, side2, battle_messages);
+				call_process_log(process_log, input_file, side1, battle_messages, battle_result->side2) +
+				call_process_log(process_log, input_file, side2, battle_messages, battle_result->side1);
 		}
 	);
 	return containers::sum(accumulator);
@@ -8,10 +8,13 @@ export module tm.ps_usage_stats.glicko1;
 import tm.ps_usage_stats.battle_result;
 import tm.ps_usage_stats.rating;
 
+import bounded;
 import containers;
+import tv;
 import std_module;
 
 namespace technicalmachine::ps_usage_stats {
+using namespace bounded::literal;
 
 // ln(10.0) / 400.0
 constexpr auto q = 0.00575646273248511421004;
@@ -28,49 +31,186 @@ constexpr auto reciprocal_of_d_squared_delta(Rating const rating) -> double {
 	return square(q) * square(g(rating.deviation)) * E(rating) * (1.0 - E(rating));
 };
 
+using ID = BattleResult::Side::ID;
+
+// Open addressing with linear probing. The capacity is always a power of two
+// and the table is kept at most half full.
+template<typename Mapped>
+struct PlayerTable {
+	explicit PlayerTable(std::size_t const expected_players):
+		m_slots(containers::repeat_default_n<Slot>(bounded::check_in_range<SlotCount>(bounded::integer(capacity_for(expected_players)))))
+	{
+	}
+
+	auto operator[](ID const id) & -> Mapped & {
+		if (2U * (m_size + 1U) > capacity()) {
+			grow();
+		}
+		auto & slot = find_slot(id);
+		if (!slot.entry) {
+			slot.entry.emplace([=] { return Entry(id, Mapped()); });
+			++m_size;
+		}
+		return slot.entry->mapped;
+	}
+
+	auto size() const -> std::size_t {
+		return m_size;
+	}
+
+	auto find(ID const id) const -> Mapped const * {
+		auto const & slot = find_slot(id);
+		return slot.entry ? std::addressof(slot.entry->mapped) : nullptr;
+	}
+
+	auto for_each(auto function) const -> void {
+		for (auto const & slot : m_slots) {
+			if (slot.entry) {
+				function(slot.entry->id, slot.entry->mapped);
+			}
+		}
+	}
+	auto for_each(auto function) & -> void {
+		for (auto & slot : m_slots) {
+			if (slot.entry) {
+				function(slot.entry->id, slot.entry->mapped);
+			}
+		}
+	}
+
+private:
+	struct Entry {
+		ID id;
+		Mapped mapped;
+	};
+	struct Slot {
+		tv::optional<Entry> entry;
+	};
+	using Slots = containers::vector<Slot>;
+	using SlotCount = containers::range_size_t<Slots>;
+
+	static constexpr auto capacity_for(std::size_t const expected_players) -> std::size_t {
+		return std::bit_ceil(std::max(std::size_t(16), 2U * expected_players));
+	}
+
+	auto capacity() const -> std::size_t {
+		return static_cast<std::size_t>(containers::size(m_slots));
+	}
+
+	// Fibonacci hashing, so that sequential IDs do not cluster
+	auto home(ID const id) const -> std::size_t {
+		auto const mixed = static_cast<std::uint64_t>(id) * 0x9E37'79B9'7F4A'7C15U;
+		return static_cast<std::size_t>(mixed >> (64 - std::countr_zero(capacity())));
+	}
+
+	auto find_slot(this auto & self, ID const id) -> auto & {
+		auto const mask = self.capacity() - 1U;
+		for (auto index = self.home(id); ; index = (index + 1U) & mask) {
+			auto & slot = self.m_slots[bounded::assume_in_range<containers::index_type<Slots>>(bounded::integer(index))];
+			if (!slot.entry or slot.entry->id == id) {
+				return slot;
+			}
+		}
+	}
+
+	auto grow() & -> void {
+		auto old = std::exchange(m_slots, Slots(containers::repeat_default_n<Slot>(
+			bounded::check_in_range<SlotCount>(bounded::integer(2U * capacity()))
+		)));
+		for (auto & slot : old) {
+			if (slot.entry) {
+				find_slot(slot.entry->id).entry.emplace([&] { return std::move(*slot.entry); });
+			}
+		}
+	}
+
+	Slots m_slots;
+	std::size_t m_size = 0U;
+};
+
 // http://www.glicko.net/glicko/glicko.pdf
+//
+// All battles are treated as a single rating period in which every player
+// starts at `initial_rating`. That means each battle's contribution to the
+// first pass depends only on the score, so the first pass accumulates scores
+// and the Glicko-1 terms are evaluated once per player in `finalize`. Because
+// the first pass is just a sum, separate instances can accumulate disjoint
+// sets of battles in parallel and then be combined with `merge`.
 export struct Glicko1 {
-	constexpr auto add_result(BattleResult::Side::ID const id1, BattleResult::Side::ID const id2, BattleResult::Winner const winner) & -> void {
-		auto to_score = [=](BattleResult::Side::ID const id) {
-			constexpr auto lose = 0.0;
-			constexpr auto tie = 0.5;
-			constexpr auto win = 1.0;
-			switch (winner) {
-				case BattleResult::Winner::side1: return id == id1 ? win : lose;
-				case BattleResult::Winner::side2: return id == id2 ? win : lose;
-				case BattleResult::Winner::tie: return tie;
-			}
+	explicit Glicko1(std::size_t const expected_players = 0U):
+		m_map(expected_players)
+	{
+	}
+
+	auto add_result(ID const id1, ID const id2, BattleResult::Winner const winner) & -> void {
+		constexpr auto lose = 0.0;
+		constexpr auto tie = 0.5;
+		constexpr auto win = 1.0;
+		auto add = [&](ID const id, double const score) {
+			auto & first_pass = m_map[id].first_pass;
+			first_pass.score += score;
+			first_pass.games += 1.0;
 		};
-		for (auto const id : {id1, id2}) {
-			auto & mapped = m_map.try_emplace(id, Mapped(FirstPass{0.0, 0.0})).first->second;
-			mapped.first_pass.rating_sum += g(initial_rating.deviation) * (to_score(id) - E(initial_rating));
-			mapped.first_pass.reciprocal_of_d_squared += reciprocal_of_d_squared_delta(initial_rating);
+		switch (winner) {
+			case BattleResult::Winner::side1:
+				add(id1, win);
+				add(id2, lose);
+				break;
+			case BattleResult::Winner::side2:
+				add(id1, lose);
+				add(id2, win);
+				break;
+			case BattleResult::Winner::tie:
+				add(id1, tie);
+				add(id2, tie);
+				break;
 		}
 	}
 
+	auto players() const -> std::size_t {
+		return m_map.size();
+	}
+
+	// Must be called before `finalize` on either instance
+	auto merge(Glicko1 const & other) & -> void {
+		other.m_map.for_each([&](ID const id, Mapped const & mapped) {
+			auto & first_pass = m_map[id].first_pass;
+			first_pass.score += mapped.first_pass.score;
+			first_pass.games += mapped.first_pass.games;
+		});
+	}
+
 	auto finalize() & -> void {
-		for (auto & element : m_map) {
-			auto & mapped = element.second;
-			auto const common = 1.0 / (1.0 / square(initial_rating.deviation) + mapped.first_pass.reciprocal_of_d_squared);
+		auto const initial_g = g(initial_rating.deviation);
+		auto const initial_E = E(initial_rating);
+		auto const initial_reciprocal_of_d_squared = reciprocal_of_d_squared_delta(initial_rating);
+		m_map.for_each([&](ID, Mapped & mapped) {
+			auto const rating_sum = initial_g * (mapped.first_pass.score - mapped.first_pass.games * initial_E);
+			auto const reciprocal_of_d_squared = mapped.first_pass.games * initial_reciprocal_of_d_squared;
+			auto const common = 1.0 / (1.0 / square(initial_rating.deviation) + reciprocal_of_d_squared);
 			mapped = Mapped(Rating(
-				initial_rating.value + q * common * mapped.first_pass.rating_sum,
+				initial_rating.value + q * common * rating_sum,
 				std::sqrt(common)
 			));
-		}
+		});
 	}
 
-	auto get(BattleResult::Side::ID const id) const -> Rating {
-		return containers::lookup(m_map, id)->rating;
+	auto get(ID const id) const -> Rating {
+		auto const mapped = m_map.find(id);
+		if (!mapped) {
+			throw std::runtime_error("Player has no rating");
+		}
+		return mapped->rating;
 	}
 
 private:
 	struct FirstPass {
-		double rating_sum;
-		double reciprocal_of_d_squared;
+		double score;
+		double games;
 	};
 	union Mapped {
-		constexpr explicit Mapped(FirstPass const first_pass_):
-			first_pass(first_pass_)
+		constexpr Mapped():
+			first_pass{0.0, 0.0}
 		{
 		}
 		constexpr explicit Mapped(Rating const rating_):
@@ -80,9 +220,7 @@ private:
 		FirstPass first_pass;
 		Rating rating;
 	};
-	std::unordered_map<BattleResult::Side::ID, Mapped> m_map;
+	PlayerTable<Mapped> m_map;
 };
 
-
-
-} // namespace technicalmachine::ps_usage_stats
\ No newline at end of file
+} // namespace technicalmachine::ps_usage_stats
@@ -10,6 +10,7 @@ import containers;
 import std_module;
 
 namespace technicalmachine {
+using namespace bounded::literal;
 
 export constexpr auto usage_stats_magic_string = containers::array{
 	std::byte('t'),
@@ -30,6 +31,16 @@ export constexpr auto usage_stats_magic_string = containers::array{
 
 export using UsageStatsVersion = bounded::integer<0, 65535>;
 
+// Version 0 is a single nested stream that must be parsed front to back.
+// Version 1 starts with a table of species and each species starts with a
+// table of moves. Each table entry has the offset of the detailed data, so a
+// reader can parse the detailed data for a species or move only when needed.
+export constexpr auto latest_usage_stats_version = UsageStatsVersion(1_bi);
+
+// In version 1, species offsets are relative to the start of the body (the
+// generation byte) and move offsets are relative to the start of the species
+export using UsageStatsOffset = bounded::integer<0, bounded::builtin_max_value<std::uint64_t>>;
+
 // Regieleki with a Choice Scarf
 export using InitialSpeed = bounded::integer<0, bounded::normalize<822>>;
 
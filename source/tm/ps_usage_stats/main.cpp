@@ -112,10 +112,36 @@ constexpr auto do_pass(Mode const mode, Glicko1 const & ratings_estimate, Battle
 	}
 }
 
-auto populate_ratings_estimate(std::filesystem::path const & team_path) -> Glicko1 {
-	auto ratings_estimate = Glicko1();
-	for (auto const & battle_result : battle_result_reader(team_path)) {
-		ratings_estimate.add_result(battle_result.side1.id, battle_result.side2.id, battle_result.winner);
+// Each thread accumulates the battles in its share of the blocks, and the
+// partial results are merged before computing the ratings. There are far
+// fewer players than battles and there is no cheap way to count them up front,
+// so the partial tables start small and grow as players are added.
+auto populate_ratings_estimate(ThreadCount const thread_count, std::filesystem::path const & teams_file_path) -> Glicko1 {
+	auto const blocks = battle_result_blocks(teams_file_path);
+	auto partial_estimates = containers::dynamic_array(containers::indexed_generate_n(
+		thread_count,
+		[&](ThreadIndex) { return Glicko1(); }
+	));
+	parallel_for_each(
+		thread_count,
+		blocks,
+		[&](BattleResultBlock const block, ThreadIndex const index) {
+			auto file = open_binary_file_for_reading(teams_file_path);
+			auto & estimate = partial_estimates[index];
+			for (auto const & battle_result : read_battle_result_block(file, block)) {
+				estimate.add_result(battle_result.side1.id, battle_result.side2.id, battle_result.winner);
+			}
+		}
+	);
+	// Every player is in at least one partial table, so the largest one is a
+	// lower bound on the number of players
+	auto largest_partial = std::size_t(0);
+	for (auto const & partial : partial_estimates) {
+		largest_partial = std::max(largest_partial, partial.players());
+	}
+	auto ratings_estimate = Glicko1(largest_partial);
+	for (auto const & partial : partial_estimates) {
+		ratings_estimate.merge(partial);
 	}
 	ratings_estimate.finalize();
 	return ratings_estimate;
@@ -151,7 +177,7 @@ auto main(int argc, char ** argv) -> int {
 
 	auto const args = parse_args(argc, argv);
 
-	auto const ratings_estimate = populate_ratings_estimate(args.teams_file_path);
+	auto const ratings_estimate = populate_ratings_estimate(args.thread_count, args.teams_file_path);
 
 	auto usage_stats = std::make_unique<UsageStats>();
 	for (auto const & result : battle_result_reader(args.teams_file_path)) {
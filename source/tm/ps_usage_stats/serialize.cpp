@@ -111,41 +111,46 @@ auto serialize_teammates(std::ostream & stream, Correlations::Teammates const &
 
 [[clang::no_destroy]] constexpr auto empty_move_data = Correlations::MoveData();
 
+auto get_used_moves(UsageStats const & usage_stats, Species const species) {
+	return get_used<MoveName>([&](MoveName const name) { return usage_stats.get(species, name); });
+}
+
+auto serialize_move_data(std::ostream & stream, Generation const generation, Correlations::TopMoves const & top_moves, containers::map_value_type<MoveName, double> const move) -> void {
+	auto serialize_all = [&](Correlations::MoveData const & data) {
+		serialize_speed(stream, data.speed, move.mapped);
+		serialize_teammates(stream, data.teammates, move.mapped);
+		serialize_simple_correlations(stream, used_to_map<MoveName>(data.moves), move.mapped);
+		if (generation >= Generation::two) {
+			serialize_simple_correlations(stream, used_to_map<Item>(data.items), move.mapped);
+		}
+		if (generation >= Generation::three) {
+			serialize_simple_correlations(stream, used_to_map<Ability>(data.abilities), move.mapped);
+		}
+	};
+	if (auto const top_move = containers::lookup(top_moves, move.key)) {
+		serialize_all((*top_move)->unlocked());
+	} else {
+		serialize_all(empty_move_data);
+	}
+}
+
 auto serialize_moves(std::ostream & stream, Generation const generation, UsageStats const & usage_stats, Species const species, Correlations::TopMoves const & top_moves, double const species_total) -> void {
-	auto const used_moves = get_used<MoveName>([&](MoveName const name) { return usage_stats.get(species, name); });
+	auto const used_moves = get_used_moves(usage_stats, species);
 	write_bytes(stream, containers::linear_size(used_moves), 2_bi);
 	for (auto const move : used_moves) {
 		write_bytes(stream, move.key, 2_bi);
 		write_bytes(stream, move.mapped / species_total, 8_bi);
-
-		auto serialize_all = [&](Correlations::MoveData const & data) {
-			serialize_speed(stream, data.speed, move.mapped);
-			serialize_teammates(stream, data.teammates, move.mapped);
-			serialize_simple_correlations(stream, used_to_map<MoveName>(data.moves), move.mapped);
-			if (generation >= Generation::two) {
-				serialize_simple_correlations(stream, used_to_map<Item>(data.items), move.mapped);
-			}
-			if (generation >= Generation::three) {
-				serialize_simple_correlations(stream, used_to_map<Ability>(data.abilities), move.mapped);
-			}
-		};
-		if (auto const top_move = containers::lookup(top_moves, move.key)) {
-			serialize_all((*top_move)->unlocked());
-		} else {
-			serialize_all(empty_move_data);
-		}
+		serialize_move_data(stream, generation, top_moves, move);
 	}
 }
 
-} // namespace
+auto get_all_species(UsageStats const & usage_stats) {
+	return get_used<Species>([&](Species const species) { return usage_stats.get_total(species); });
+}
 
-export auto serialize(std::ostream & stream, Generation const generation, UsageStats const & usage_stats, Correlations const & correlations) -> void {
-	using Version = bounded::integer<0, 65535>;
-	write_bytes(stream, usage_stats_magic_string, 14_bi);
-	constexpr auto version = Version(0_bi);
-	write_bytes(stream, version, 2_bi);
+auto serialize_v0(std::ostream & stream, Generation const generation, UsageStats const & usage_stats, Correlations const & correlations) -> void {
 	write_bytes(stream, generation, 1_bi);
-	auto const all_species = get_used<Species>([&](Species const species) { return usage_stats.get_total(species); });
+	auto const all_species = get_all_species(usage_stats);
 	write_bytes(stream, containers::linear_size(all_species), 2_bi);
 	for (auto const usage : all_species) {
 		auto const species = usage.key;
@@ -164,4 +169,115 @@ export auto serialize(std::ostream & stream, Generation const generation, UsageS
 	}
 }
 
+auto write_offset(std::ostream & stream, std::size_t const offset) -> void {
+	write_bytes(stream, bounded::check_in_range<UsageStatsOffset>(bounded::integer(offset)), 8_bi);
+}
+
+// Table entries are the key (2 bytes), the weight (8 bytes), and the offset
+// (8 bytes)
+constexpr auto table_entry_size = 18U;
+
+// Layout of a species:
+// - Summary: moves, items, and abilities
+// - Table of moves
+// - Speed distribution
+// - Teammates
+// - The data for each move in the table
+auto species_v1(Generation const generation, UsageStats const & usage_stats, Correlations const & correlations, containers::map_value_type<Species, double> const usage) -> std::string {
+	auto const species = usage.key;
+	auto const total = usage.mapped;
+	auto const used_moves = get_used_moves(usage_stats, species);
+
+	auto summary = std::stringstream();
+	serialize_simple_correlations(summary, used_moves, total);
+	if (generation >= Generation::two) {
+		serialize<Item>(summary, usage_stats, usage);
+	}
+	if (generation >= Generation::three) {
+		serialize<Ability>(summary, usage_stats, usage);
+	}
+
+	auto details = std::stringstream();
+	serialize_speed(details, usage_stats.speed_distribution(species), total);
+	serialize_teammates(details, correlations.teammates(species), total);
+
+	auto move_data = containers::vector<std::string>();
+	for (auto const move : used_moves) {
+		auto stream = std::stringstream();
+		serialize_move_data(stream, generation, correlations.top_moves(species), move);
+		containers::push_back(move_data, std::move(stream).str());
+	}
+
+	auto const summary_str = std::move(summary).str();
+	auto const details_str = std::move(details).str();
+	auto result = std::stringstream();
+	result << summary_str;
+	write_bytes(result, containers::linear_size(used_moves), 2_bi);
+	auto offset = summary_str.size() + 2U + table_entry_size * static_cast<std::size_t>(containers::linear_size(used_moves)) + details_str.size();
+	auto data_it = containers::begin(move_data);
+	for (auto const move : used_moves) {
+		write_bytes(result, move.key, 2_bi);
+		write_bytes(result, move.mapped / total, 8_bi);
+		write_offset(result, offset);
+		offset += data_it->size();
+		++data_it;
+	}
+	result << details_str;
+	for (auto const & data : move_data) {
+		result << data;
+	}
+	return std::move(result).str();
+}
+
+// Layout of the body:
+// - Generation
+// - Table of species
+// - The data for each species in the table
+auto serialize_v1(std::ostream & stream, Generation const generation, UsageStats const & usage_stats, Correlations const & correlations) -> void {
+	auto const all_species = get_all_species(usage_stats);
+	auto const species_data = containers::vector<std::string>(containers::transform(
+		all_species,
+		[&](containers::map_value_type<Species, double> const usage) {
+			return species_v1(generation, usage_stats, correlations, usage);
+		}
+	));
+	write_bytes(stream, generation, 1_bi);
+	write_bytes(stream, containers::linear_size(all_species), 2_bi);
+	auto offset = 1U + 2U + table_entry_size * static_cast<std::size_t>(containers::size(species_data));
+	auto data_it = containers::begin(species_data);
+	for (auto const usage : all_species) {
+		write_bytes(stream, usage.key, 2_bi);
+		write_bytes(stream, usage.mapped / usage_stats.total_teams(), 8_bi);
+		write_offset(stream, offset);
+		offset += data_it->size();
+		++data_it;
+	}
+	for (auto const & data : species_data) {
+		stream << data;
+	}
+}
+
+} // namespace
+
+export auto serialize(
+	std::ostream & stream,
+	Generation const generation,
+	UsageStats const & usage_stats,
+	Correlations const & correlations,
+	UsageStatsVersion const version = latest_usage_stats_version
+) -> void {
+	write_bytes(stream, usage_stats_magic_string, 14_bi);
+	write_bytes(stream, version, 2_bi);
+	switch (version.value()) {
+		case 0:
+			serialize_v0(stream, generation, usage_stats, correlations);
+			break;
+		case 1:
+			serialize_v1(stream, generation, usage_stats, correlations);
+			break;
+		default:
+			throw std::runtime_error("Unsupported usage stats version");
+	}
+}
+
 } // namespace technicalmachine::ps_usage_stats
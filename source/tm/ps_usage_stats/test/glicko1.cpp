@@ -32,4 +32,23 @@ TEST_CASE("Glicko-1: Glicko-1") {
 	check(2_bi, ps_usage_stats::Rating(1460.0, 123.0));
 }
 
+TEST_CASE("Glicko-1: merge matches a single pass") {
+	using ps_usage_stats::BattleResult;
+	auto single = ps_usage_stats::Glicko1();
+	auto first = ps_usage_stats::Glicko1();
+	auto second = ps_usage_stats::Glicko1();
+	single.add_result(1_bi, 2_bi, BattleResult::Winner::side1);
+	first.add_result(1_bi, 2_bi, BattleResult::Winner::side1);
+	single.add_result(2_bi, 3_bi, BattleResult::Winner::tie);
+	second.add_result(2_bi, 3_bi, BattleResult::Winner::tie);
+	single.add_result(3_bi, 1_bi, BattleResult::Winner::side2);
+	second.add_result(3_bi, 1_bi, BattleResult::Winner::side2);
+	single.finalize();
+	first.merge(second);
+	first.finalize();
+	for (auto const id : {BattleResult::Side::ID(1_bi), BattleResult::Side::ID(2_bi), BattleResult::Side::ID(3_bi)}) {
+		CHECK(first.get(id) == single.get(id));
+	}
+}
+
 } // namespace technicalmachine
@@ -13,6 +13,7 @@ import tm.clients.ps.parsed_stats;
 import tm.clients.ps.parsed_team;
 
 import tm.ps_usage_stats.battle_result;
+import tm.ps_usage_stats.battle_result_block;
 import tm.ps_usage_stats.battle_result_reader;
 import tm.ps_usage_stats.battle_result_writer;
 import tm.ps_usage_stats.rating;
@@ -182,6 +183,7 @@ TEST_CASE("Minimal: Minimal team file") {
 	{
 		auto writer = ps_usage_stats::BattleResultWriter(path);
 		writer(original);
+		writer.finish();
 	}
 	{
 		auto reader = ps_usage_stats::battle_result_reader(path);
@@ -191,5 +193,28 @@ TEST_CASE("Minimal: Minimal team file") {
 	std::filesystem::remove(path);
 }
 
+TEST_CASE("Multiple blocks") {
+	auto const path = std::filesystem::temp_directory_path() / "teams" / "test_blocks.tmmt";
+	auto const original = make_result();
+	constexpr auto count = ps_usage_stats::max_battles_per_block + 1_bi;
+	{
+		auto writer = ps_usage_stats::BattleResultWriter(path);
+		for ([[maybe_unused]] auto const _ : containers::integer_range(count)) {
+			writer(original);
+		}
+		writer.finish();
+	}
+	{
+		auto const blocks = ps_usage_stats::battle_result_blocks(path);
+		CHECK(containers::size(blocks) == 2_bi);
+		auto reader = ps_usage_stats::battle_result_reader(path);
+		CHECK(containers::size(reader) == count);
+		for (auto const & result : reader) {
+			CHECK(result == original);
+		}
+	}
+	std::filesystem::remove(path);
+}
+
 } // namespace
 } // namespace technicalmachine
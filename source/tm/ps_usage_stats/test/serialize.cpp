@@ -27,6 +27,9 @@ import tm.stat.evs;
 import tm.stat.iv;
 import tm.stat.nature;
 
+import tm.team_predictor.usage_stats;
+import tm.team_predictor.usage_stats_probabilities;
+
 import tm.test.usage_bytes;
 
 import tm.ability;
@@ -137,7 +140,7 @@ TEST_CASE("ps_usage_stats: Serialize smallest non-empty file") {
 	auto correlations = ps_usage_stats::Correlations(*usage_stats);
 	correlations.add(team, weight);
 	auto stream = std::stringstream();
-	ps_usage_stats::serialize(stream, generation, *usage_stats, correlations);
+	ps_usage_stats::serialize(stream, generation, *usage_stats, correlations, UsageStatsVersion(0_bi));
 	auto const expected = smallest_team_bytes(generation);
 	CHECK(string_to_bytes(stream.str()) == expected);
 }
@@ -150,7 +153,7 @@ TEST_CASE("ps_usage_stats: Serialize team with two Pokemon") {
 	auto correlations = ps_usage_stats::Correlations(*usage_stats);
 	correlations.add(team, weight);
 	auto stream = std::stringstream();
-	ps_usage_stats::serialize(stream, Generation::one, *usage_stats, correlations);
+	ps_usage_stats::serialize(stream, Generation::one, *usage_stats, correlations, UsageStatsVersion(0_bi));
 	auto const expected = containers::dynamic_array<std::byte>(containers::concatenate_view(
 		usage_stats_magic_string,
 		version_bytes(0),
@@ -264,7 +267,7 @@ TEST_CASE("ps_usage_stats: Serialize two teams") {
 		correlations.add(team, weight);
 	}
 	auto stream = std::stringstream();
-	ps_usage_stats::serialize(stream, Generation::one, *usage_stats, correlations);
+	ps_usage_stats::serialize(stream, Generation::one, *usage_stats, correlations, UsageStatsVersion(0_bi));
 	auto const expected = containers::dynamic_array<std::byte>(containers::concatenate_view(
 		usage_stats_magic_string,
 		version_bytes(0),
@@ -322,10 +325,56 @@ TEST_CASE("ps_usage_stats: Serialize smallest non-empty Generation 2 file") {
 	auto correlations = ps_usage_stats::Correlations(*usage_stats);
 	correlations.add(team, weight);
 	auto stream = std::stringstream();
-	ps_usage_stats::serialize(stream, generation, *usage_stats, correlations);
+	ps_usage_stats::serialize(stream, generation, *usage_stats, correlations, UsageStatsVersion(0_bi));
 	auto const expected = smallest_team_bytes(generation);
 	CHECK(string_to_bytes(stream.str()) == expected);
 }
 
+auto check_equal(UsageStatsProbabilities const * const version0, UsageStatsProbabilities const * const version1) -> void {
+	REQUIRE(version0);
+	REQUIRE(version1);
+	auto const & map0 = version0->map();
+	auto const & map1 = version1->map();
+	REQUIRE(containers::size(map0) == containers::size(map1));
+	for (auto const & element : map0) {
+		auto const other = (*version1)(element.key);
+		REQUIRE(other);
+		CHECK(element.mapped.moves.map() == other->moves.map());
+		CHECK(element.mapped.items.map() == other->items.map());
+		CHECK(element.mapped.abilities.map() == other->abilities.map());
+	}
+}
+
+TEST_CASE("ps_usage_stats: Version 1 reads the same as version 0") {
+	auto usage_stats = std::make_unique<ps_usage_stats::UsageStats>();
+	constexpr auto weight = 1.0;
+	auto teams = containers::array{make_smallest_team(), make_second_team(), make_team_with_two_pokemon()};
+	for (auto const team : teams) {
+		usage_stats->add(team, weight);
+	}
+	auto correlations = ps_usage_stats::Correlations(*usage_stats);
+	for (auto const team : teams) {
+		correlations.add(team, weight);
+	}
+	for (auto const generation : {Generation::one, Generation::three}) {
+		auto serialized = [&](UsageStatsVersion const version) {
+			auto stream = std::stringstream();
+			ps_usage_stats::serialize(stream, generation, *usage_stats, correlations, version);
+			return bytes_to_usage_stats(string_to_bytes(stream.str()));
+		};
+		auto const version0 = serialized(UsageStatsVersion(0_bi));
+		auto const version1 = serialized(UsageStatsVersion(1_bi));
+		check_equal(std::addressof(version0.assuming()), std::addressof(version1.assuming()));
+		for (auto const & species : version0.assuming().map()) {
+			check_equal(version0.assuming(species.key), version1.assuming(species.key));
+			for (auto const & move : species.mapped.moves.map()) {
+				check_equal(version0.assuming(species.key, move.key), version1.assuming(species.key, move.key));
+			}
+		}
+		CHECK(!version1.assuming(Species::Bulbasaur));
+		CHECK(!version1.assuming(Species::Mew, MoveName::Surf));
+	}
+}
+
 } // namespace
 } // namespace technicalmachine
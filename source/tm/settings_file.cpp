@@ -15,6 +15,8 @@ export struct SettingsFile {
 	containers::string host;
 	containers::string port;
 	containers::string resource;
+	// Only a local test server should be used without TLS
+	bool secure = true;
 	containers::string username;
 	containers::string password;
 
@@ -20,7 +20,11 @@ import tm.move.switch_;
 
 import tm.ps_usage_stats.battle_log_to_messages;
 import tm.ps_usage_stats.battle_result;
+import tm.ps_usage_stats.decision_point;
+import tm.ps_usage_stats.decision_point_file;
 import tm.ps_usage_stats.for_each_log;
+import tm.ps_usage_stats.parallel_for_each;
+import tm.ps_usage_stats.parse_input_log;
 import tm.ps_usage_stats.rated_side;
 import tm.ps_usage_stats.rating;
 import tm.ps_usage_stats.thread_count;
@@ -33,6 +37,7 @@ import tm.team_predictor.all_usage_stats;
 import tm.team_predictor.team_predictor;
 import tm.team_predictor.usage_stats;
 
+import tm.constant_generation;
 import tm.generation;
 import tm.get_legal_selections;
 import tm.open_file;
@@ -54,22 +59,23 @@ using namespace ps_usage_stats;
 
 struct ParsedArgs {
 	ThreadCount thread_count;
-	std::filesystem::path input_directory;
+	// Either a directory of logs or a decision point file
+	std::filesystem::path input;
 	Strategy strategy;
 };
 
 auto parse_args(int argc, char const * const * argv) -> ParsedArgs {
 	if (argc < 4) {
-		throw std::runtime_error("Usage is score_predict_selection thread_count input_directory strategy");
+		throw std::runtime_error("Usage is score_predict_selection thread_count (input_directory | decision_point_file) strategy");
 	}
 	auto const thread_count = bounded::to_integer<ThreadCount>(argv[1]);
-	auto input_directory = std::filesystem::path(argv[2]);
-	if (!std::filesystem::exists(input_directory)) {
-		throw std::runtime_error(containers::concatenate<std::string>(input_directory.string(), " does not exist"_s));
+	auto input = std::filesystem::path(argv[2]);
+	if (!std::filesystem::exists(input)) {
+		throw std::runtime_error(containers::concatenate<std::string>(input.string(), " does not exist"_s));
 	}
 	return ParsedArgs{
 		thread_count,
-		std::move(input_directory),
+		std::move(input),
 		parse_strategy(argc - 3, argv + 3)
 	};
 }
@@ -81,29 +87,37 @@ struct PredictedSelection {
 
 constexpr auto empty_selection_probability = SelectionProbabilities({{pass, Probability(1.0)}});
 
+template<Generation generation>
+auto predict_selection(
+	Strategy const & strategy,
+	VisibleState<generation> const & state,
+	UsageStats const & usage_stats
+) -> SelectionProbabilities {
+	if (team_is_empty(state.ai) or team_is_empty(state.foe)) {
+		return empty_selection_probability;
+	}
+	auto const user_team = Team<generation>(state.ai);
+	auto const predicted_team = most_likely_team(usage_stats, state.foe);
+	BOUNDED_ASSERT(!team_is_empty(predicted_team));
+	return strategy(
+		user_team,
+		get_legal_selections(user_team, predicted_team, state.environment),
+		predicted_team,
+		get_legal_selections(predicted_team, user_team, state.environment),
+		state.environment
+	).user;
+}
+
 auto get_predicted_selection(
 	Strategy const & strategy,
 	ps::BattleMessageHandler & battle,
-	AllUsageStats const & all_usage_stats
+	UsageStats const & usage_stats
 ) {
 	return [&](containers::span<ps::ParsedMessage const> const message) -> tv::optional<PredictedSelection> {
-		auto function = [&]<Generation generation>(VisibleState<generation> const & state) {
-			if (team_is_empty(state.ai) or team_is_empty(state.foe)) {
-				return empty_selection_probability;
-			}
-			auto const user_team = Team<generation>(state.ai);
-			auto const predicted_team = most_likely_team(all_usage_stats[generation], state.foe);
-			BOUNDED_ASSERT(!team_is_empty(predicted_team));
-			return strategy(
-				user_team,
-				get_legal_selections(user_team, predicted_team, state.environment),
-				predicted_team,
-				get_legal_selections(predicted_team, user_team, state.environment),
-				state.environment
-			).user;
-		};
 		auto selection = PredictedSelection(
-			tv::visit(battle.state(), function),
+			tv::visit(battle.state(), [&]<Generation generation>(VisibleState<generation> const & state) {
+				return predict_selection(strategy, state, usage_stats);
+			}),
 			battle.slot_memory()
 		);
 		battle.handle_message(message);
@@ -114,8 +128,7 @@ auto get_predicted_selection(
 	};
 }
 
-constexpr auto individual_brier_score = [](auto const & tuple) -> double {
-	auto const & [evaluated, reported] = tuple;
+auto brier_score(PredictedSelection const & evaluated, PlayerInput const & reported) -> double {
 	auto const actual = tv::visit(reported, tv::overload(
 		[](MoveName const move) -> Selection {
 			return move;
@@ -130,6 +143,11 @@ constexpr auto individual_brier_score = [](auto const & tuple) -> double {
 		return value * value;
 	};
 	return containers::sum(containers::transform(evaluated.predicted, score_prediction));
+}
+
+constexpr auto individual_brier_score = [](auto const & tuple) -> double {
+	auto const & [evaluated, reported] = tuple;
+	return brier_score(evaluated, reported);
 };
 
 struct WeightedScore {
@@ -156,14 +174,21 @@ auto predicted_selections(
 	Strategy const & strategy,
 	containers::span<ps::EventBlock const> const battle_messages,
 	ps::BattleMessageHandler & battle,
-	AllUsageStats const & all_usage_stats
+	UsageStats const & usage_stats
 ) {
 	return containers::remove_none(containers::transform_non_idempotent(
 		std::move(battle_messages),
-		get_predicted_selection(strategy, battle, all_usage_stats)
+		get_predicted_selection(strategy, battle, usage_stats)
 	));
 }
 
+// An input that could not be scored counts as the worst possible prediction.
+// Both ways of scoring use this, so they give the same result.
+auto unprocessed_score(std::uint64_t const count) -> WeightedScore {
+	auto const weight = static_cast<double>(count);
+	return WeightedScore(weight * 2.0, weight);
+}
+
 auto score_one_side_of_battle(
 	std::filesystem::path const & input_file,
 	Strategy const & strategy,
@@ -172,6 +197,7 @@ auto score_one_side_of_battle(
 	BattleLogMessages const & battle_messages
 ) -> WeightedScore {
 	auto battle = ps::BattleMessageHandler(rated_side.side.party, rated_side.side.team, battle_messages.init);
+	auto const usage_stats = all_usage_stats[battle_messages.init.generation];
 	auto scores = containers::vector<double>(containers::reserve_space_for(bounded::min(
 		containers::size(rated_side.inputs),
 		containers::size(battle_messages.messages)
@@ -182,7 +208,7 @@ auto score_one_side_of_battle(
 		// ensures that each useful result is accessible in the `catch` block.
 		auto input_scores = containers::transform(
 			containers::zip_smallest(
-				predicted_selections(strategy, battle_messages.messages, battle, all_usage_stats),
+				predicted_selections(strategy, battle_messages.messages, battle, *usage_stats),
 				rated_side.inputs
 			),
 			individual_brier_score
@@ -197,8 +223,7 @@ auto score_one_side_of_battle(
 		std::cerr << "Unable to process " << input_file.string() << ", side " << party_str << ": " << ex.what() << ", skipping\n";
 		auto const total = containers::size(rated_side.inputs);
 		auto const processed = containers::size(scores);
-		auto const remaining = double(total - processed);
-		return weighted_score(scores) + WeightedScore(remaining * 2.0, remaining);
+		return weighted_score(scores) + unprocessed_score(static_cast<std::uint64_t>(total - processed));
 	}
 }
 
@@ -224,12 +249,51 @@ auto score_predict_selection(ThreadCount const thread_count, std::filesystem::pa
 	return result.weight != 0.0 ? result.score / result.weight : 0.0;
 }
 
+// The decision points were recorded by `create_decision_points`, so nothing is
+// parsed or replayed here. Each thread takes individual decision points rather
+// than whole battles, which keeps every thread busy even when battles vary a
+// lot in length.
+template<Generation generation>
+auto score_decision_points(
+	ThreadCount const thread_count,
+	std::filesystem::path const & input_file,
+	Strategy const & strategy,
+	AllUsageStats const & all_usage_stats
+) -> WeightedScore {
+	auto const [points, unprocessed_inputs] = read_decision_points<generation>(input_file);
+	auto const usage_stats = all_usage_stats[generation];
+	auto accumulator = containers::dynamic_array(containers::repeat_default_n<WeightedScore>(thread_count));
+	parallel_for_each(
+		thread_count,
+		containers::integer_range(containers::size(points)),
+		[&](auto const index, ThreadIndex const thread_index) {
+			auto const & point = points[index];
+			auto const evaluated = PredictedSelection(
+				predict_selection(strategy, point.state, *usage_stats),
+				point.slot_memory
+			);
+			accumulator[thread_index] = accumulator[thread_index] + WeightedScore(brier_score(evaluated, point.input), 1.0);
+		}
+	);
+	return containers::sum(accumulator) + unprocessed_score(unprocessed_inputs);
+}
+
+auto score_decision_points(ThreadCount const thread_count, std::filesystem::path const & input_file, Strategy const & strategy) -> double {
+	auto const all_usage_stats = AllUsageStats();
+	auto const result = constant_generation(decision_point_generation(input_file), [&]<Generation generation>(constant_gen_t<generation>) {
+		return score_decision_points<generation>(thread_count, input_file, strategy, all_usage_stats);
+	});
+	return result.weight != 0.0 ? result.score / result.weight : 0.0;
+}
+
 } // namespace technicalmachine
 
 auto main(int argc, char ** argv) -> int {
 	using namespace technicalmachine;
 	auto const args = parse_args(argc, argv);
-	auto const result = score_predict_selection(args.thread_count, args.input_directory, args.strategy);
+	auto const result = std::filesystem::is_directory(args.input) ?
+		score_predict_selection(args.thread_count, args.input, args.strategy) :
+		score_decision_points(args.thread_count, args.input, args.strategy);
 	std::cout << "Brier score: " << result << '\n';
 	return 0;
 }
@@ -0,0 +1,580 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Plays two strategies against each other without a server. Every random
+// event that the engine models (accuracy, critical hits, side effects, status
+// clearing, full paralysis, Sleep Talk, turn order ties and end of turn
+// effects) is sampled instead of being searched over.
+//
+// Unlike a game on a server, each strategy is given its opponent's real team,
+// including Pokemon, moves, items and stats that have not been revealed yet.
+// A game on a server instead gives the strategy the team predicted from what
+// has been seen. Results here therefore measure play with perfect
+// information, and overstate the strength of strategies that rely on knowing
+// the opponent's team.
+
+import tm.clients.get_team;
+
+import tm.evaluate.possible_executed_moves;
+import tm.evaluate.score;
+import tm.evaluate.selector;
+import tm.evaluate.win;
+
+import tm.move.actual_damage;
+import tm.move.call_move;
+import tm.move.category;
+import tm.move.future_selection;
+import tm.move.irrelevant_action;
+import tm.move.known_move;
+import tm.move.legal_selections;
+import tm.move.move_name;
+import tm.move.other_action;
+import tm.move.pass;
+import tm.move.selection;
+import tm.move.side_effects;
+import tm.move.switch_;
+import tm.move.used_move;
+
+import tm.pokemon.active_pokemon;
+import tm.pokemon.get_hidden_power_type;
+
+import tm.ps_usage_stats.parallel_for_each;
+import tm.ps_usage_stats.thread_count;
+
+import tm.stat.chance_to_hit;
+import tm.stat.faster;
+
+import tm.status.clears_status;
+import tm.status.status_name;
+
+import tm.strategy.expectimax.moved;
+import tm.strategy.parse_strategy;
+import tm.strategy.selection_probability;
+import tm.strategy.strategy;
+
+import tm.string_conversions.generation;
+
+import tm.team_predictor.all_usage_stats;
+
+import tm.type.move_type;
+
+import tm.activate_ability_on_switch;
+import tm.any_team;
+import tm.constant_generation;
+import tm.contact_ability_effect;
+import tm.critical_hit_probability;
+import tm.end_of_turn;
+import tm.end_of_turn_flags;
+import tm.environment;
+import tm.generation;
+import tm.generation_generic;
+import tm.get_legal_selections;
+import tm.probability;
+import tm.settings_file;
+import tm.state;
+import tm.team;
+
+import bounded;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+using namespace ps_usage_stats;
+
+// A game still going after this many turns is scored as a tie
+constexpr auto max_turns = 1000;
+
+using GameCount = bounded::integer<1, 100'000'000>;
+
+struct Player {
+	SettingsFile::Team team;
+	Strategy strategy;
+};
+
+struct ParsedArgs {
+	ThreadCount thread_count;
+	GameCount games;
+	Generation generation;
+	std::uint32_t seed;
+	Player one;
+	Player two;
+};
+
+auto parse_team(containers::string_view const str) -> SettingsFile::Team {
+	if (str == "generate"_s) {
+		return SettingsFile::GenerateTeam();
+	}
+	auto path = std::filesystem::path(std::string_view(str));
+	if (!std::filesystem::exists(path)) {
+		throw std::runtime_error(containers::concatenate<std::string>(path.string(), " does not exist"_s));
+	}
+	return path;
+}
+
+auto parse_args(int argc, char const * const * argv) -> ParsedArgs {
+	constexpr auto usage = "Usage is self_play thread_count games generation seed team1 team2 strategy1 -- strategy2\n"
+		"Each team is either generate or a directory of team files";
+	if (argc < 10) {
+		throw std::runtime_error(usage);
+	}
+	auto const strategies_begin = argv + 7;
+	auto const strategies_end = argv + argc;
+	auto const separator = std::find_if(strategies_begin, strategies_end, [](char const * const arg) {
+		return containers::string_view(arg) == "--"_s;
+	});
+	if (separator == strategies_end) {
+		throw std::runtime_error(usage);
+	}
+	return ParsedArgs{
+		bounded::to_integer<ThreadCount>(argv[1]),
+		bounded::to_integer<GameCount>(argv[2]),
+		from_string<Generation>(containers::string_view(argv[3])),
+		static_cast<std::uint32_t>(bounded::to_integer<bounded::integer<0, bounded::builtin_max_value<std::uint32_t>>>(argv[4])),
+		Player(
+			parse_team(containers::string_view(argv[5])),
+			parse_strategy(static_cast<int>(separator - strategies_begin), strategies_begin)
+		),
+		Player(
+			parse_team(containers::string_view(argv[6])),
+			parse_strategy(static_cast<int>(strategies_end - separator - 1), separator + 1)
+		)
+	};
+}
+
+enum class Outcome {
+	one_wins,
+	two_wins,
+	tie,
+};
+
+struct Totals {
+	std::uint64_t games = 0U;
+	std::uint64_t one_wins = 0U;
+	std::uint64_t two_wins = 0U;
+	std::uint64_t ties = 0U;
+	std::uint64_t errors = 0U;
+	std::uint64_t turns = 0U;
+	// Only counts decisions with more than one legal selection
+	containers::array<std::uint64_t, 2_bi> decisions = {};
+	containers::array<std::chrono::nanoseconds, 2_bi> decision_time = {};
+
+	friend auto operator+(Totals const lhs, Totals const rhs) -> Totals {
+		return Totals{
+			lhs.games + rhs.games,
+			lhs.one_wins + rhs.one_wins,
+			lhs.two_wins + rhs.two_wins,
+			lhs.ties + rhs.ties,
+			lhs.errors + rhs.errors,
+			lhs.turns + rhs.turns,
+			{lhs.decisions[0_bi] + rhs.decisions[0_bi], lhs.decisions[1_bi] + rhs.decisions[1_bi]},
+			{lhs.decision_time[0_bi] + rhs.decision_time[0_bi], lhs.decision_time[1_bi] + rhs.decision_time[1_bi]}
+		};
+	}
+};
+
+constexpr auto is_damaging(Selection const selection) -> bool {
+	return tv::visit(selection, tv::overload(
+		[](Switch) { return false; },
+		[](MoveName const move) { return is_damaging(move); },
+		[](Pass) { return false; }
+	));
+}
+
+constexpr auto is_fainted(any_team auto const & team) -> bool {
+	return team.pokemon().hp().current() == 0_bi;
+}
+
+constexpr auto is_delayed_switching(any_team auto const & team) -> bool {
+	return team.size() != 1_bi and team.pokemon().last_used_move().is_delayed_switching();
+}
+
+template<Generation generation>
+constexpr auto get_other_action(ActivePokemon<generation> const pokemon) -> OtherAction {
+	auto const move = pokemon.last_used_move().name();
+	return move ?
+		OtherAction(KnownMove(*move, move_type(generation, *move, get_hidden_power_type(pokemon)))) :
+		OtherAction(IrrelevantAction());
+}
+
+// "One" is always `state.ai` and "two" is always `state.foe`
+template<Generation generation>
+struct Game {
+	Game(
+		Team<generation> one,
+		Team<generation> two,
+		Strategy const & one_strategy,
+		Strategy const & two_strategy,
+		std::mt19937 & random_engine,
+		Totals & totals
+	):
+		m_state(std::move(one), std::move(two), Environment()),
+		m_one_strategy(one_strategy),
+		m_two_strategy(two_strategy),
+		m_random_engine(random_engine),
+		m_totals(totals)
+	{
+		auto const one_pokemon = m_state.ai.pokemon();
+		auto const two_pokemon = m_state.foe.pokemon();
+		one_pokemon.switch_in(m_state.environment, true);
+		two_pokemon.switch_in(m_state.environment, true);
+		activate_ability_on_switch(one_pokemon, two_pokemon, m_state.environment);
+		activate_ability_on_switch(two_pokemon, one_pokemon, m_state.environment);
+	}
+
+	auto play() -> Outcome {
+		for (auto turn = 0; turn != max_turns; ++turn) {
+			++m_totals.turns;
+			if (auto const outcome = play_turn()) {
+				return *outcome;
+			}
+		}
+		return Outcome::tie;
+	}
+
+private:
+	auto happens(Probability const probability) -> bool {
+		return std::bernoulli_distribution(double(probability))(m_random_engine);
+	}
+
+	auto pick(SelectionProbabilities const selections) -> Selection {
+		auto const probabilities = containers::transform(
+			selections,
+			[](SelectionProbability const element) {
+				return double(element.probability);
+			}
+		);
+		auto distribution = std::discrete_distribution(
+			containers::legacy_iterator(containers::begin(probabilities)),
+			containers::legacy_iterator(containers::end(probabilities))
+		);
+		return containers::at(selections, distribution(m_random_engine)).selection;
+	}
+
+	auto outcome() const -> tv::optional<Outcome> {
+		auto const won = win(m_state.ai, m_state.foe);
+		if (!won) {
+			return tv::none;
+		}
+		return
+			*won > Score(0.0) ? Outcome::one_wins :
+			*won < Score(0.0) ? Outcome::two_wins :
+			Outcome::tie;
+	}
+
+	// Asks each side for a selection in the current state. Sides with only one
+	// legal selection are not asked.
+	auto select() -> containers::array<Selection, 2_bi> {
+		auto const one_legal = get_legal_selections(m_state.ai, m_state.foe, m_state.environment);
+		auto const two_legal = get_legal_selections(m_state.foe, m_state.ai, m_state.environment);
+		auto select_one_side = [&](
+			Strategy const & strategy,
+			auto const index,
+			Team<generation> const & team,
+			LegalSelections const legal,
+			Team<generation> const & other,
+			LegalSelections const other_legal
+		) -> Selection {
+			if (containers::size(legal) == 1_bi) {
+				return containers::front(legal);
+			}
+			auto const start = std::chrono::steady_clock::now();
+			// `other` is the opponent's real team, not a prediction from
+			// what this side has seen
+			auto const result = strategy(team, legal, other, other_legal, m_state.environment);
+			auto const finish = std::chrono::steady_clock::now();
+			++m_totals.decisions[index];
+			m_totals.decision_time[index] += finish - start;
+			return pick(result.user);
+		};
+		return {
+			select_one_side(m_one_strategy, 0_bi, m_state.ai, one_legal, m_state.foe, two_legal),
+			select_one_side(m_two_strategy, 1_bi, m_state.foe, two_legal, m_state.ai, one_legal)
+		};
+	}
+
+	auto play_turn() -> tv::optional<Outcome> {
+		auto const selections = select();
+		auto const one_selection = selections[0_bi];
+		auto const two_selection = selections[1_bi];
+		auto const order = Order(m_state.ai, one_selection, m_state.foe, two_selection, m_state.environment);
+		auto const one_first = order ?
+			std::addressof(order->first.team) == std::addressof(m_state.ai) :
+			happens(Probability(0.5));
+		auto const selector = Selector(one_first);
+		auto const first_selection = one_first ? one_selection : two_selection;
+		auto const last_selection = one_first ? two_selection : one_selection;
+
+		if (auto const result = execute(selector, first_selection, FutureSelection(is_damaging(last_selection)))) {
+			return result;
+		}
+		if (auto const result = delayed_switch(selector)) {
+			return result;
+		}
+		auto const selected = selector(m_state);
+		if (!moved(selected.other) and !fainting_forces_end_of_turn(selected.other)) {
+			auto const other_action = get_other_action(std::as_const(selected.selection).pokemon());
+			if (auto const result = execute(selector.invert(), last_selection, other_action)) {
+				return result;
+			}
+			if (auto const result = delayed_switch(selector.invert())) {
+				return result;
+			}
+		}
+		if (replacement_before_end_of_turn_required()) {
+			if (auto const result = replace_fainted()) {
+				return result;
+			}
+		}
+		run_end_of_turn();
+		if (auto const result = outcome()) {
+			return result;
+		}
+		if (is_fainted(m_state.ai) or is_fainted(m_state.foe)) {
+			return replace_fainted();
+		}
+		return tv::none;
+	}
+
+	auto fainting_forces_end_of_turn(Team<generation> const & next) const -> bool {
+		switch (generation) {
+			case Generation::one:
+			case Generation::two:
+			case Generation::three:
+				return is_fainted(m_state.ai) or is_fainted(m_state.foe);
+			default:
+				return is_fainted(next);
+		}
+	}
+
+	auto replacement_before_end_of_turn_required() const -> bool {
+		return generation == Generation::two and (is_fainted(m_state.ai) or is_fainted(m_state.foe));
+	}
+
+	auto execute(Selector const select, Selection const selection, OtherAction const other_action) -> tv::optional<Outcome> {
+		tv::visit(selection, tv::overload(
+			[&](Switch const switch_) {
+				auto const selected = select(m_state);
+				selected.selection.switch_pokemon(selected.other.pokemon(), m_state.environment, switch_.value());
+			},
+			[&](MoveName const move) {
+				use_move(select, move, other_action);
+			},
+			[](Pass) {
+			}
+		));
+		return outcome();
+	}
+
+	auto use_move(Selector const select, MoveName const selected_move, OtherAction const other_action) -> void {
+		auto const & state = m_state;
+		auto const selected = select(state);
+		if (is_fainted(selected.selection)) {
+			return;
+		}
+		auto const user_pokemon = selected.selection.pokemon();
+		auto const other_pokemon = selected.other.pokemon();
+
+		auto const executed_moves = possible_executed_moves(selected_move, selected.selection);
+		auto const executed = containers::is_empty(executed_moves) ?
+			selected_move :
+			containers::at(executed_moves, std::uniform_int_distribution<std::size_t>(0U, static_cast<std::size_t>(containers::size(executed_moves)) - 1U)(m_random_engine));
+
+		auto const clear_status = happens(user_pokemon.status().probability_of_clearing(generation, user_pokemon.ability()));
+		auto const hits = happens(chance_to_hit(
+			user_pokemon,
+			KnownMove(executed, move_type(generation, executed, get_hidden_power_type(user_pokemon))),
+			other_pokemon,
+			state.environment,
+			moved(other_pokemon)
+		));
+		auto const is_fully_paralyzed = user_pokemon.status().name() == StatusName::paralysis and happens(Probability(0.25));
+		auto const action_ends = happens(user_pokemon.last_used_move().action_end_probability());
+		auto const critical_hit = hits and happens(critical_hit_probability(user_pokemon, executed, other_pokemon.ability(), state.environment));
+
+		auto const side_effects = possible_side_effects(executed, user_pokemon, selected.other, state.environment);
+		auto const side_effect_probabilities = containers::transform(side_effects, [](auto const & side_effect) {
+			return double(side_effect.probability);
+		});
+		auto side_effect_distribution = std::discrete_distribution(
+			containers::legacy_iterator(containers::begin(side_effect_probabilities)),
+			containers::legacy_iterator(containers::end(side_effect_probabilities))
+		);
+		auto const & side_effect = containers::at(side_effects, side_effect_distribution(m_random_engine));
+
+		auto const mutable_selected = select(m_state);
+		// TODO: https://github.com/davidstone/technical-machine/issues/24
+		constexpr auto contact_ability_effect = ContactAbilityEffect::nothing;
+		call_move(
+			mutable_selected.selection,
+			UsedMove<Team<generation>>(
+				selected_move,
+				executed,
+				critical_hit,
+				!hits,
+				action_ends,
+				contact_ability_effect,
+				side_effect.function
+			),
+			mutable_selected.other,
+			other_action,
+			m_state.environment,
+			clear_status,
+			ActualDamage::Unknown{},
+			is_fully_paralyzed
+		);
+	}
+
+	// After a move like U-turn, the user picks its replacement before the turn
+	// continues
+	auto delayed_switch(Selector const select) -> tv::optional<Outcome> {
+		if (!is_delayed_switching(select(m_state).selection)) {
+			return tv::none;
+		}
+		return switch_selected();
+	}
+
+	auto replace_fainted() -> tv::optional<Outcome> {
+		return switch_selected();
+	}
+
+	// Only the sides that must switch have a choice here; the other side
+	// passes
+	auto switch_selected() -> tv::optional<Outcome> {
+		auto const selections = select();
+		if (auto const result = execute(Selector(true), selections[0_bi], IrrelevantAction())) {
+			return result;
+		}
+		return execute(Selector(false), selections[1_bi], IrrelevantAction());
+	}
+
+	auto run_end_of_turn() -> void {
+		auto flags = [&](Team<generation> const & team) {
+			auto const pokemon = team.pokemon();
+			auto const shed_skin = can_clear_status(pokemon.ability(), pokemon.status().name()) and happens(Probability(0.3));
+			auto const lock_in_ends = happens(pokemon.last_used_move().end_of_turn_end_probability());
+			auto const thaws = generation == Generation::two and pokemon.status().name() == StatusName::freeze and happens(Probability(0.1));
+			return EndOfTurnFlags(shed_skin, lock_in_ends, thaws);
+		};
+		auto const one_flags = flags(m_state.ai);
+		auto const two_flags = flags(m_state.foe);
+		auto const faster = Faster<generation>(m_state.ai, m_state.foe, m_state.environment);
+		auto const one_first = faster ?
+			std::addressof(faster->first) == std::addressof(m_state.ai) :
+			happens(Probability(0.5));
+		if (one_first) {
+			end_of_turn(m_state.ai, one_flags, m_state.foe, two_flags, m_state.environment);
+		} else {
+			end_of_turn(m_state.foe, two_flags, m_state.ai, one_flags, m_state.environment);
+		}
+	}
+
+	State<generation> m_state;
+	Strategy const & m_one_strategy;
+	Strategy const & m_two_strategy;
+	std::mt19937 & m_random_engine;
+	Totals & m_totals;
+};
+
+template<Generation generation>
+auto to_team(GenerationGeneric<KnownTeam> const & team) -> Team<generation> {
+	return tv::visit(team, []<Generation team_generation>(KnownTeam<team_generation> const & known) -> Team<generation> {
+		if constexpr (team_generation != generation) {
+			throw std::runtime_error("Team is for the wrong generation");
+		} else {
+			return Team<generation>(known);
+		}
+	});
+}
+
+auto play_game(
+	ParsedArgs const & args,
+	AllUsageStats const & all_usage_stats,
+	std::uint32_t const game_index,
+	Totals & totals
+) -> void {
+	auto seeds = std::seed_seq({args.seed, game_index});
+	auto random_engine = std::mt19937(seeds);
+	auto get_player_team = [&](Player const & player) {
+		auto const team = get_team(args.generation, player.team, all_usage_stats, random_engine);
+		if (!team) {
+			throw std::runtime_error("Unable to get a team");
+		}
+		return *team;
+	};
+	auto const one_team = get_player_team(args.one);
+	auto const two_team = get_player_team(args.two);
+	auto const outcome = constant_generation(args.generation, [&]<Generation generation>(constant_gen_t<generation>) {
+		return Game<generation>(
+			to_team<generation>(one_team),
+			to_team<generation>(two_team),
+			args.one.strategy,
+			args.two.strategy,
+			random_engine,
+			totals
+		).play();
+	});
+	++totals.games;
+	switch (outcome) {
+		case Outcome::one_wins: ++totals.one_wins; break;
+		case Outcome::two_wins: ++totals.two_wins; break;
+		case Outcome::tie: ++totals.ties; break;
+	}
+}
+
+auto print_report(Totals const totals, std::chrono::nanoseconds const elapsed) -> void {
+	auto const games = static_cast<double>(totals.games);
+	std::cout << "Games: " << totals.games << " (" << totals.errors << " failed)\n";
+	std::cout << "Each strategy sees its opponent's full team\n";
+	std::cout << "Player one wins: " << totals.one_wins << ", ties: " << totals.ties << ", losses: " << totals.two_wins << '\n';
+	if (totals.games != 0U) {
+		// Ties count as half a win. The interval is the normal approximation.
+		auto const score = (static_cast<double>(totals.one_wins) + 0.5 * static_cast<double>(totals.ties)) / games;
+		auto const margin = 1.96 * std::sqrt(score * (1.0 - score) / games);
+		std::cout << "Player one score: " << score << " (95% confidence interval " << std::max(score - margin, 0.0) << " to " << std::min(score + margin, 1.0) << ")\n";
+		std::cout << "Turns per game: " << static_cast<double>(totals.turns) / games << '\n';
+	}
+	for (auto const index : containers::integer_range(2_bi)) {
+		auto const decisions = totals.decisions[index];
+		auto const seconds = std::chrono::duration<double>(totals.decision_time[index]).count();
+		std::cout << "Player " << (index == 0_bi ? "one" : "two") << ": " << seconds << " seconds deciding";
+		if (totals.games != 0U) {
+			std::cout << ", " << static_cast<double>(decisions) / games << " decisions per game";
+		}
+		if (decisions != 0U) {
+			std::cout << ", " << seconds * 1000.0 / static_cast<double>(decisions) << " ms per decision";
+		}
+		std::cout << '\n';
+	}
+	std::cout << "Games per second: " << games / std::chrono::duration<double>(elapsed).count() << '\n';
+}
+
+} // namespace technicalmachine
+
+auto main(int argc, char ** argv) -> int {
+	using namespace technicalmachine;
+	auto const args = parse_args(argc, argv);
+	auto const all_usage_stats = AllUsageStats();
+	auto totals = containers::dynamic_array(containers::repeat_default_n<Totals>(args.thread_count));
+	auto const start = std::chrono::steady_clock::now();
+	parallel_for_each(
+		args.thread_count,
+		containers::integer_range(args.games),
+		[&](auto const index, ThreadIndex const thread_index) {
+			auto & thread_totals = totals[thread_index];
+			try {
+				play_game(args, all_usage_stats, static_cast<std::uint32_t>(index), thread_totals);
+			} catch (std::exception const & ex) {
+				std::cerr << "Game " << index << " failed: " << ex.what() << '\n';
+				++thread_totals.errors;
+			}
+		}
+	);
+	auto const elapsed = std::chrono::steady_clock::now() - start;
+	print_report(containers::sum(totals), elapsed);
+	return 0;
+}
@@ -10,6 +10,7 @@ import tm.string_conversions.invalid_string_conversion;
 import tm.string_conversions.lowercase_alphanumeric;
 
 import tm.ability;
+import tm.perfect_hash_map;
 
 import bounded;
 import containers;
@@ -294,273 +295,270 @@ export constexpr auto to_string(Ability const ability) -> containers::string_vie
 
 export template<>
 constexpr auto from_string<Ability>(containers::string_view const str) -> Ability {
-	static constexpr auto converter = containers::basic_flat_map(
-		containers::assume_sorted_unique,
-		containers::to_array<containers::map_value_type<containers::string_view, Ability>>({
-			{"adaptability"_s, Ability::Adaptability},
-			{"aerilate"_s, Ability::Aerilate},
-			{"aftermath"_s, Ability::Aftermath},
-			{"airlock"_s, Ability::Air_Lock},
-			{"analytic"_s, Ability::Analytic},
-			{"angerpoint"_s, Ability::Anger_Point},
-			{"anticipation"_s, Ability::Anticipation},
-			{"arenatrap"_s, Ability::Arena_Trap},
-			{"aromaveil"_s, Ability::Aroma_Veil},
-			{"aurabreak"_s, Ability::Aura_Break},
-			{"baddreams"_s, Ability::Bad_Dreams},
-			{"ballfetch"_s, Ability::Ball_Fetch},
-			{"battery"_s, Ability::Battery},
-			{"battlearmor"_s, Ability::Battle_Armor},
-			{"battlebond"_s, Ability::Battle_Bond},
-			{"beastboost"_s, Ability::Beast_Boost},
-			{"berserk"_s, Ability::Berserk},
-			{"bigpecks"_s, Ability::Big_Pecks},
-			{"blaze"_s, Ability::Blaze},
-			{"bulletproof"_s, Ability::Bulletproof},
-			{"cheekpouch"_s, Ability::Cheek_Pouch},
-			{"chlorophyll"_s, Ability::Chlorophyll},
-			{"clearbody"_s, Ability::Clear_Body},
-			{"cloudnine"_s, Ability::Cloud_Nine},
-			{"colorchange"_s, Ability::Color_Change},
-			{"comatose"_s, Ability::Comatose},
-			{"competitive"_s, Ability::Competitive},
-			{"compoundeyes"_s, Ability::Compound_Eyes},
-			{"contrary"_s, Ability::Contrary},
-			{"corrosion"_s, Ability::Corrosion},
-			{"cottondown"_s, Ability::Cotton_Down},
-			{"cursedbody"_s, Ability::Cursed_Body},
-			{"cutecharm"_s, Ability::Cute_Charm},
-			{"damp"_s, Ability::Damp},
-			{"dancer"_s, Ability::Dancer},
-			{"darkaura"_s, Ability::Dark_Aura},
-			{"dauntlessshield"_s, Ability::Dauntless_Shield},
-			{"dazzling"_s, Ability::Dazzling},
-			{"defeatist"_s, Ability::Defeatist},
-			{"defiant"_s, Ability::Defiant},
-			{"deltastream"_s, Ability::Delta_Stream},
-			{"desolateland"_s, Ability::Desolate_Land},
-			{"disguise"_s, Ability::Disguise},
-			{"download"_s, Ability::Download},
-			{"drizzle"_s, Ability::Drizzle},
-			{"drought"_s, Ability::Drought},
-			{"dryskin"_s, Ability::Dry_Skin},
-			{"earlybird"_s, Ability::Early_Bird},
-			{"effectspore"_s, Ability::Effect_Spore},
-			{"electricsurge"_s, Ability::Electric_Surge},
-			{"emergencyexit"_s, Ability::Emergency_Exit},
-			{"fairyaura"_s, Ability::Fairy_Aura},
-			{"filter"_s, Ability::Filter},
-			{"flamebody"_s, Ability::Flame_Body},
-			{"flareboost"_s, Ability::Flare_Boost},
-			{"flashfire"_s, Ability::Flash_Fire},
-			{"flowergift"_s, Ability::Flower_Gift},
-			{"flowerveil"_s, Ability::Flower_Veil},
-			{"fluffy"_s, Ability::Fluffy},
-			{"forecast"_s, Ability::Forecast},
-			{"forewarn"_s, Ability::Forewarn},
-			{"friendguard"_s, Ability::Friend_Guard},
-			{"frisk"_s, Ability::Frisk},
-			{"fullmetalbody"_s, Ability::Full_Metal_Body},
-			{"furcoat"_s, Ability::Fur_Coat},
-			{"galewings"_s, Ability::Gale_Wings},
-			{"galvanize"_s, Ability::Galvanize},
-			{"gluttony"_s, Ability::Gluttony},
-			{"gooey"_s, Ability::Gooey},
-			{"gorillatactics"_s, Ability::Gorilla_Tactics},
-			{"grasspelt"_s, Ability::Grass_Pelt},
-			{"grassysurge"_s, Ability::Grassy_Surge},
-			{"gulpmissile"_s, Ability::Gulp_Missile},
-			{"guts"_s, Ability::Guts},
-			{"harvest"_s, Ability::Harvest},
-			{"healer"_s, Ability::Healer},
-			{"heatproof"_s, Ability::Heatproof},
-			{"heavymetal"_s, Ability::Heavy_Metal},
-			{"honeygather"_s, Ability::Honey_Gather},
-			{"hugepower"_s, Ability::Huge_Power},
-			{"hungerswitch"_s, Ability::Hunger_Switch},
-			{"hustle"_s, Ability::Hustle},
-			{"hydration"_s, Ability::Hydration},
-			{"hypercutter"_s, Ability::Hyper_Cutter},
-			{"icebody"_s, Ability::Ice_Body},
-			{"iceface"_s, Ability::Ice_Face},
-			{"icescales"_s, Ability::Ice_Scales},
-			{"illuminate"_s, Ability::Illuminate},
-			{"illusion"_s, Ability::Illusion},
-			{"immunity"_s, Ability::Immunity},
-			{"imposter"_s, Ability::Imposter},
-			{"infiltrator"_s, Ability::Infiltrator},
-			{"innardsout"_s, Ability::Innards_Out},
-			{"innerfocus"_s, Ability::Inner_Focus},
-			{"insomnia"_s, Ability::Insomnia},
-			{"intimidate"_s, Ability::Intimidate},
-			{"intrepidsword"_s, Ability::Intrepid_Sword},
-			{"ironbarbs"_s, Ability::Iron_Barbs},
-			{"ironfist"_s, Ability::Iron_Fist},
-			{"justified"_s, Ability::Justified},
-			{"keeneye"_s, Ability::Keen_Eye},
-			{"klutz"_s, Ability::Klutz},
-			{"leafguard"_s, Ability::Leaf_Guard},
-			{"levitate"_s, Ability::Levitate},
-			{"libero"_s, Ability::Libero},
-			{"lightmetal"_s, Ability::Light_Metal},
-			{"lightningrod"_s, Ability::Lightning_Rod},
-			{"limber"_s, Ability::Limber},
-			{"liquidooze"_s, Ability::Liquid_Ooze},
-			{"liquidvoice"_s, Ability::Liquid_Voice},
-			{"longreach"_s, Ability::Long_Reach},
-			{"magicbounce"_s, Ability::Magic_Bounce},
-			{"magicguard"_s, Ability::Magic_Guard},
-			{"magician"_s, Ability::Magician},
-			{"magmaarmor"_s, Ability::Magma_Armor},
-			{"magnetpull"_s, Ability::Magnet_Pull},
-			{"marvelscale"_s, Ability::Marvel_Scale},
-			{"megalauncher"_s, Ability::Mega_Launcher},
-			{"merciless"_s, Ability::Merciless},
-			{"mimicry"_s, Ability::Mimicry},
-			{"minus"_s, Ability::Minus},
-			{"mirrorarmor"_s, Ability::Mirror_Armor},
-			{"mistysurge"_s, Ability::Misty_Surge},
-			{"moldbreaker"_s, Ability::Mold_Breaker},
-			{"moody"_s, Ability::Moody},
-			{"motordrive"_s, Ability::Motor_Drive},
-			{"moxie"_s, Ability::Moxie},
-			{"multiscale"_s, Ability::Multiscale},
-			{"multitype"_s, Ability::Multitype},
-			{"mummy"_s, Ability::Mummy},
-			{"naturalcure"_s, Ability::Natural_Cure},
-			{"neuroforce"_s, Ability::Neuroforce},
-			{"neutralizinggas"_s, Ability::Neutralizing_Gas},
-			{"noability"_s, Ability::Honey_Gather}, // TODO: ???
-			{"noguard"_s, Ability::No_Guard},
-			{"none"_s, Ability::Honey_Gather}, // TODO: ???
-			{"normalize"_s, Ability::Normalize},
-			{"oblivious"_s, Ability::Oblivious},
-			{"overcoat"_s, Ability::Overcoat},
-			{"overgrow"_s, Ability::Overgrow},
-			{"owntempo"_s, Ability::Own_Tempo},
-			{"parentalbond"_s, Ability::Parental_Bond},
-			{"pastelveil"_s, Ability::Pastel_Veil},
-			{"perishbody"_s, Ability::Perish_Body},
-			{"pickpocket"_s, Ability::Pickpocket},
-			{"pickup"_s, Ability::Pickup},
-			{"pixilate"_s, Ability::Pixilate},
-			{"plus"_s, Ability::Plus},
-			{"poisonheal"_s, Ability::Poison_Heal},
-			{"poisonpoint"_s, Ability::Poison_Point},
-			{"poisontouch"_s, Ability::Poison_Touch},
-			{"powerconstruct"_s, Ability::Power_Construct},
-			{"powerofalchemy"_s, Ability::Power_of_Alchemy},
-			{"powerspot"_s, Ability::Power_Spot},
-			{"prankster"_s, Ability::Prankster},
-			{"pressure"_s, Ability::Pressure},
-			{"primordialsea"_s, Ability::Primordial_Sea},
-			{"prismarmor"_s, Ability::Prism_Armor},
-			{"propellertail"_s, Ability::Propeller_Tail},
-			{"protean"_s, Ability::Protean},
-			{"psychicsurge"_s, Ability::Psychic_Surge},
-			{"punkrock"_s, Ability::Punk_Rock},
-			{"purepower"_s, Ability::Pure_Power},
-			{"queenlymajesty"_s, Ability::Queenly_Majesty},
-			{"quickfeet"_s, Ability::Quick_Feet},
-			{"raindish"_s, Ability::Rain_Dish},
-			{"rattled"_s, Ability::Rattled},
-			{"receiver"_s, Ability::Receiver},
-			{"reckless"_s, Ability::Reckless},
-			{"refrigerate"_s, Ability::Refrigerate},
-			{"regenerator"_s, Ability::Regenerator},
-			{"ripen"_s, Ability::Ripen},
-			{"rivalry"_s, Ability::Rivalry},
-			{"rkssystem"_s, Ability::RKS_System},
-			{"rockhead"_s, Ability::Rock_Head},
-			{"roughskin"_s, Ability::Rough_Skin},
-			{"runaway"_s, Ability::Run_Away},
-			{"sandforce"_s, Ability::Sand_Force},
-			{"sandrush"_s, Ability::Sand_Rush},
-			{"sandspit"_s, Ability::Sand_Spit},
-			{"sandstream"_s, Ability::Sand_Stream},
-			{"sandveil"_s, Ability::Sand_Veil},
-			{"sapsipper"_s, Ability::Sap_Sipper},
-			{"schooling"_s, Ability::Schooling},
-			{"scrappy"_s, Ability::Scrappy},
-			{"screencleaner"_s, Ability::Screen_Cleaner},
-			{"serenegrace"_s, Ability::Serene_Grace},
-			{"shadowshield"_s, Ability::Shadow_Shield},
-			{"shadowtag"_s, Ability::Shadow_Tag},
-			{"shedskin"_s, Ability::Shed_Skin},
-			{"sheerforce"_s, Ability::Sheer_Force},
-			{"shellarmor"_s, Ability::Shell_Armor},
-			{"shielddust"_s, Ability::Shield_Dust},
-			{"shieldsdown"_s, Ability::Shields_Down},
-			{"simple"_s, Ability::Simple},
-			{"skilllink"_s, Ability::Skill_Link},
-			{"slowstart"_s, Ability::Slow_Start},
-			{"slushrush"_s, Ability::Slush_Rush},
-			{"sniper"_s, Ability::Sniper},
-			{"snowcloak"_s, Ability::Snow_Cloak},
-			{"snowwarning"_s, Ability::Snow_Warning},
-			{"solarpower"_s, Ability::Solar_Power},
-			{"solidrock"_s, Ability::Solid_Rock},
-			{"soulheart"_s, Ability::Soul_Heart},
-			{"soundproof"_s, Ability::Soundproof},
-			{"speedboost"_s, Ability::Speed_Boost},
-			{"stakeout"_s, Ability::Stakeout},
-			{"stall"_s, Ability::Stall},
-			{"stalwart"_s, Ability::Stalwart},
-			{"stamina"_s, Ability::Stamina},
-			{"stancechange"_s, Ability::Stance_Change},
-			{"static"_s, Ability::Static},
-			{"steadfast"_s, Ability::Steadfast},
-			{"steamengine"_s, Ability::Steam_Engine},
-			{"steelworker"_s, Ability::Steelworker},
-			{"steelyspirit"_s, Ability::Steely_Spirit},
-			{"stench"_s, Ability::Stench},
-			{"stickyhold"_s, Ability::Sticky_Hold},
-			{"stormdrain"_s, Ability::Storm_Drain},
-			{"strongjaw"_s, Ability::Strong_Jaw},
-			{"sturdy"_s, Ability::Sturdy},
-			{"suctioncups"_s, Ability::Suction_Cups},
-			{"superluck"_s, Ability::Super_Luck},
-			{"surgesurfer"_s, Ability::Surge_Surfer},
-			{"swarm"_s, Ability::Swarm},
-			{"sweetveil"_s, Ability::Sweet_Veil},
-			{"swiftswim"_s, Ability::Swift_Swim},
-			{"symbiosis"_s, Ability::Symbiosis},
-			{"synchronize"_s, Ability::Synchronize},
-			{"tangledfeet"_s, Ability::Tangled_Feet},
-			{"tanglinghair"_s, Ability::Tangling_Hair},
-			{"technician"_s, Ability::Technician},
-			{"telepathy"_s, Ability::Telepathy},
-			{"teravolt"_s, Ability::Teravolt},
-			{"thickfat"_s, Ability::Thick_Fat},
-			{"tintedlens"_s, Ability::Tinted_Lens},
-			{"torrent"_s, Ability::Torrent},
-			{"toughclaws"_s, Ability::Tough_Claws},
-			{"toxicboost"_s, Ability::Toxic_Boost},
-			{"trace"_s, Ability::Trace},
-			{"triage"_s, Ability::Triage},
-			{"truant"_s, Ability::Truant},
-			{"turboblaze"_s, Ability::Turboblaze},
-			{"unaware"_s, Ability::Unaware},
-			{"unburden"_s, Ability::Unburden},
-			{"unnerve"_s, Ability::Unnerve},
-			{"victorystar"_s, Ability::Victory_Star},
-			{"vitalspirit"_s, Ability::Vital_Spirit},
-			{"voltabsorb"_s, Ability::Volt_Absorb},
-			{"wanderingspirit"_s, Ability::Wandering_Spirit},
-			{"waterabsorb"_s, Ability::Water_Absorb},
-			{"waterbubble"_s, Ability::Water_Bubble},
-			{"watercompaction"_s, Ability::Water_Compaction},
-			{"waterveil"_s, Ability::Water_Veil},
-			{"weakarmor"_s, Ability::Weak_Armor},
-			{"whitesmoke"_s, Ability::White_Smoke},
-			{"wimpout"_s, Ability::Wimp_Out},
-			{"wonderguard"_s, Ability::Wonder_Guard},
-			{"wonderskin"_s, Ability::Wonder_Skin},
-			{"zenmode"_s, Ability::Zen_Mode},
-		})
-	);
-	auto const converted = fixed_capacity_lowercase_and_digit_string<15_bi>(str);
-	auto const result = containers::lookup(converter, converted);
+	static constexpr auto converter = make_perfect_hash_map<Ability>({
+		{"adaptability"_s, Ability::Adaptability},
+		{"aerilate"_s, Ability::Aerilate},
+		{"aftermath"_s, Ability::Aftermath},
+		{"airlock"_s, Ability::Air_Lock},
+		{"analytic"_s, Ability::Analytic},
+		{"angerpoint"_s, Ability::Anger_Point},
+		{"anticipation"_s, Ability::Anticipation},
+		{"arenatrap"_s, Ability::Arena_Trap},
+		{"aromaveil"_s, Ability::Aroma_Veil},
+		{"aurabreak"_s, Ability::Aura_Break},
+		{"baddreams"_s, Ability::Bad_Dreams},
+		{"ballfetch"_s, Ability::Ball_Fetch},
+		{"battery"_s, Ability::Battery},
+		{"battlearmor"_s, Ability::Battle_Armor},
+		{"battlebond"_s, Ability::Battle_Bond},
+		{"beastboost"_s, Ability::Beast_Boost},
+		{"berserk"_s, Ability::Berserk},
+		{"bigpecks"_s, Ability::Big_Pecks},
+		{"blaze"_s, Ability::Blaze},
+		{"bulletproof"_s, Ability::Bulletproof},
+		{"cheekpouch"_s, Ability::Cheek_Pouch},
+		{"chlorophyll"_s, Ability::Chlorophyll},
+		{"clearbody"_s, Ability::Clear_Body},
+		{"cloudnine"_s, Ability::Cloud_Nine},
+		{"colorchange"_s, Ability::Color_Change},
+		{"comatose"_s, Ability::Comatose},
+		{"competitive"_s, Ability::Competitive},
+		{"compoundeyes"_s, Ability::Compound_Eyes},
+		{"contrary"_s, Ability::Contrary},
+		{"corrosion"_s, Ability::Corrosion},
+		{"cottondown"_s, Ability::Cotton_Down},
+		{"cursedbody"_s, Ability::Cursed_Body},
+		{"cutecharm"_s, Ability::Cute_Charm},
+		{"damp"_s, Ability::Damp},
+		{"dancer"_s, Ability::Dancer},
+		{"darkaura"_s, Ability::Dark_Aura},
+		{"dauntlessshield"_s, Ability::Dauntless_Shield},
+		{"dazzling"_s, Ability::Dazzling},
+		{"defeatist"_s, Ability::Defeatist},
+		{"defiant"_s, Ability::Defiant},
+		{"deltastream"_s, Ability::Delta_Stream},
+		{"desolateland"_s, Ability::Desolate_Land},
+		{"disguise"_s, Ability::Disguise},
+		{"download"_s, Ability::Download},
+		{"drizzle"_s, Ability::Drizzle},
+		{"drought"_s, Ability::Drought},
+		{"dryskin"_s, Ability::Dry_Skin},
+		{"earlybird"_s, Ability::Early_Bird},
+		{"effectspore"_s, Ability::Effect_Spore},
+		{"electricsurge"_s, Ability::Electric_Surge},
+		{"emergencyexit"_s, Ability::Emergency_Exit},
+		{"fairyaura"_s, Ability::Fairy_Aura},
+		{"filter"_s, Ability::Filter},
+		{"flamebody"_s, Ability::Flame_Body},
+		{"flareboost"_s, Ability::Flare_Boost},
+		{"flashfire"_s, Ability::Flash_Fire},
+		{"flowergift"_s, Ability::Flower_Gift},
+		{"flowerveil"_s, Ability::Flower_Veil},
+		{"fluffy"_s, Ability::Fluffy},
+		{"forecast"_s, Ability::Forecast},
+		{"forewarn"_s, Ability::Forewarn},
+		{"friendguard"_s, Ability::Friend_Guard},
+		{"frisk"_s, Ability::Frisk},
+		{"fullmetalbody"_s, Ability::Full_Metal_Body},
+		{"furcoat"_s, Ability::Fur_Coat},
+		{"galewings"_s, Ability::Gale_Wings},
+		{"galvanize"_s, Ability::Galvanize},
+		{"gluttony"_s, Ability::Gluttony},
+		{"gooey"_s, Ability::Gooey},
+		{"gorillatactics"_s, Ability::Gorilla_Tactics},
+		{"grasspelt"_s, Ability::Grass_Pelt},
+		{"grassysurge"_s, Ability::Grassy_Surge},
+		{"gulpmissile"_s, Ability::Gulp_Missile},
+		{"guts"_s, Ability::Guts},
+		{"harvest"_s, Ability::Harvest},
+		{"healer"_s, Ability::Healer},
+		{"heatproof"_s, Ability::Heatproof},
+		{"heavymetal"_s, Ability::Heavy_Metal},
+		{"honeygather"_s, Ability::Honey_Gather},
+		{"hugepower"_s, Ability::Huge_Power},
+		{"hungerswitch"_s, Ability::Hunger_Switch},
+		{"hustle"_s, Ability::Hustle},
+		{"hydration"_s, Ability::Hydration},
+		{"hypercutter"_s, Ability::Hyper_Cutter},
+		{"icebody"_s, Ability::Ice_Body},
+		{"iceface"_s, Ability::Ice_Face},
+		{"icescales"_s, Ability::Ice_Scales},
+		{"illuminate"_s, Ability::Illuminate},
+		{"illusion"_s, Ability::Illusion},
+		{"immunity"_s, Ability::Immunity},
+		{"imposter"_s, Ability::Imposter},
+		{"infiltrator"_s, Ability::Infiltrator},
+		{"innardsout"_s, Ability::Innards_Out},
+		{"innerfocus"_s, Ability::Inner_Focus},
+		{"insomnia"_s, Ability::Insomnia},
+		{"intimidate"_s, Ability::Intimidate},
+		{"intrepidsword"_s, Ability::Intrepid_Sword},
+		{"ironbarbs"_s, Ability::Iron_Barbs},
+		{"ironfist"_s, Ability::Iron_Fist},
+		{"justified"_s, Ability::Justified},
+		{"keeneye"_s, Ability::Keen_Eye},
+		{"klutz"_s, Ability::Klutz},
+		{"leafguard"_s, Ability::Leaf_Guard},
+		{"levitate"_s, Ability::Levitate},
+		{"libero"_s, Ability::Libero},
+		{"lightmetal"_s, Ability::Light_Metal},
+		{"lightningrod"_s, Ability::Lightning_Rod},
+		{"limber"_s, Ability::Limber},
+		{"liquidooze"_s, Ability::Liquid_Ooze},
+		{"liquidvoice"_s, Ability::Liquid_Voice},
+		{"longreach"_s, Ability::Long_Reach},
+		{"magicbounce"_s, Ability::Magic_Bounce},
+		{"magicguard"_s, Ability::Magic_Guard},
+		{"magician"_s, Ability::Magician},
+		{"magmaarmor"_s, Ability::Magma_Armor},
+		{"magnetpull"_s, Ability::Magnet_Pull},
+		{"marvelscale"_s, Ability::Marvel_Scale},
+		{"megalauncher"_s, Ability::Mega_Launcher},
+		{"merciless"_s, Ability::Merciless},
+		{"mimicry"_s, Ability::Mimicry},
+		{"minus"_s, Ability::Minus},
+		{"mirrorarmor"_s, Ability::Mirror_Armor},
+		{"mistysurge"_s, Ability::Misty_Surge},
+		{"moldbreaker"_s, Ability::Mold_Breaker},
+		{"moody"_s, Ability::Moody},
+		{"motordrive"_s, Ability::Motor_Drive},
+		{"moxie"_s, Ability::Moxie},
+		{"multiscale"_s, Ability::Multiscale},
+		{"multitype"_s, Ability::Multitype},
+		{"mummy"_s, Ability::Mummy},
+		{"naturalcure"_s, Ability::Natural_Cure},
+		{"neuroforce"_s, Ability::Neuroforce},
+		{"neutralizinggas"_s, Ability::Neutralizing_Gas},
+		{"noability"_s, Ability::Honey_Gather}, // TODO: ???
+		{"noguard"_s, Ability::No_Guard},
+		{"none"_s, Ability::Honey_Gather}, // TODO: ???
+		{"normalize"_s, Ability::Normalize},
+		{"oblivious"_s, Ability::Oblivious},
+		{"overcoat"_s, Ability::Overcoat},
+		{"overgrow"_s, Ability::Overgrow},
+		{"owntempo"_s, Ability::Own_Tempo},
+		{"parentalbond"_s, Ability::Parental_Bond},
+		{"pastelveil"_s, Ability::Pastel_Veil},
+		{"perishbody"_s, Ability::Perish_Body},
+		{"pickpocket"_s, Ability::Pickpocket},
+		{"pickup"_s, Ability::Pickup},
+		{"pixilate"_s, Ability::Pixilate},
+		{"plus"_s, Ability::Plus},
+		{"poisonheal"_s, Ability::Poison_Heal},
+		{"poisonpoint"_s, Ability::Poison_Point},
+		{"poisontouch"_s, Ability::Poison_Touch},
+		{"powerconstruct"_s, Ability::Power_Construct},
+		{"powerofalchemy"_s, Ability::Power_of_Alchemy},
+		{"powerspot"_s, Ability::Power_Spot},
+		{"prankster"_s, Ability::Prankster},
+		{"pressure"_s, Ability::Pressure},
+		{"primordialsea"_s, Ability::Primordial_Sea},
+		{"prismarmor"_s, Ability::Prism_Armor},
+		{"propellertail"_s, Ability::Propeller_Tail},
+		{"protean"_s, Ability::Protean},
+		{"psychicsurge"_s, Ability::Psychic_Surge},
+		{"punkrock"_s, Ability::Punk_Rock},
+		{"purepower"_s, Ability::Pure_Power},
+		{"queenlymajesty"_s, Ability::Queenly_Majesty},
+		{"quickfeet"_s, Ability::Quick_Feet},
+		{"raindish"_s, Ability::Rain_Dish},
+		{"rattled"_s, Ability::Rattled},
+		{"receiver"_s, Ability::Receiver},
+		{"reckless"_s, Ability::Reckless},
+		{"refrigerate"_s, Ability::Refrigerate},
+		{"regenerator"_s, Ability::Regenerator},
+		{"ripen"_s, Ability::Ripen},
+		{"rivalry"_s, Ability::Rivalry},
+		{"rkssystem"_s, Ability::RKS_System},
+		{"rockhead"_s, Ability::Rock_Head},
+		{"roughskin"_s, Ability::Rough_Skin},
+		{"runaway"_s, Ability::Run_Away},
+		{"sandforce"_s, Ability::Sand_Force},
+		{"sandrush"_s, Ability::Sand_Rush},
+		{"sandspit"_s, Ability::Sand_Spit},
+		{"sandstream"_s, Ability::Sand_Stream},
+		{"sandveil"_s, Ability::Sand_Veil},
+		{"sapsipper"_s, Ability::Sap_Sipper},
+		{"schooling"_s, Ability::Schooling},
+		{"scrappy"_s, Ability::Scrappy},
+		{"screencleaner"_s, Ability::Screen_Cleaner},
+		{"serenegrace"_s, Ability::Serene_Grace},
+		{"shadowshield"_s, Ability::Shadow_Shield},
+		{"shadowtag"_s, Ability::Shadow_Tag},
+		{"shedskin"_s, Ability::Shed_Skin},
+		{"sheerforce"_s, Ability::Sheer_Force},
+		{"shellarmor"_s, Ability::Shell_Armor},
+		{"shielddust"_s, Ability::Shield_Dust},
+		{"shieldsdown"_s, Ability::Shields_Down},
+		{"simple"_s, Ability::Simple},
+		{"skilllink"_s, Ability::Skill_Link},
+		{"slowstart"_s, Ability::Slow_Start},
+		{"slushrush"_s, Ability::Slush_Rush},
+		{"sniper"_s, Ability::Sniper},
+		{"snowcloak"_s, Ability::Snow_Cloak},
+		{"snowwarning"_s, Ability::Snow_Warning},
+		{"solarpower"_s, Ability::Solar_Power},
+		{"solidrock"_s, Ability::Solid_Rock},
+		{"soulheart"_s, Ability::Soul_Heart},
+		{"soundproof"_s, Ability::Soundproof},
+		{"speedboost"_s, Ability::Speed_Boost},
+		{"stakeout"_s, Ability::Stakeout},
+		{"stall"_s, Ability::Stall},
+		{"stalwart"_s, Ability::Stalwart},
+		{"stamina"_s, Ability::Stamina},
+		{"stancechange"_s, Ability::Stance_Change},
+		{"static"_s, Ability::Static},
+		{"steadfast"_s, Ability::Steadfast},
+		{"steamengine"_s, Ability::Steam_Engine},
+		{"steelworker"_s, Ability::Steelworker},
+		{"steelyspirit"_s, Ability::Steely_Spirit},
+		{"stench"_s, Ability::Stench},
+		{"stickyhold"_s, Ability::Sticky_Hold},
+		{"stormdrain"_s, Ability::Storm_Drain},
+		{"strongjaw"_s, Ability::Strong_Jaw},
+		{"sturdy"_s, Ability::Sturdy},
+		{"suctioncups"_s, Ability::Suction_Cups},
+		{"superluck"_s, Ability::Super_Luck},
+		{"surgesurfer"_s, Ability::Surge_Surfer},
+		{"swarm"_s, Ability::Swarm},
+		{"sweetveil"_s, Ability::Sweet_Veil},
+		{"swiftswim"_s, Ability::Swift_Swim},
+		{"symbiosis"_s, Ability::Symbiosis},
+		{"synchronize"_s, Ability::Synchronize},
+		{"tangledfeet"_s, Ability::Tangled_Feet},
+		{"tanglinghair"_s, Ability::Tangling_Hair},
+		{"technician"_s, Ability::Technician},
+		{"telepathy"_s, Ability::Telepathy},
+		{"teravolt"_s, Ability::Teravolt},
+		{"thickfat"_s, Ability::Thick_Fat},
+		{"tintedlens"_s, Ability::Tinted_Lens},
+		{"torrent"_s, Ability::Torrent},
+		{"toughclaws"_s, Ability::Tough_Claws},
+		{"toxicboost"_s, Ability::Toxic_Boost},
+		{"trace"_s, Ability::Trace},
+		{"triage"_s, Ability::Triage},
+		{"truant"_s, Ability::Truant},
+		{"turboblaze"_s, Ability::Turboblaze},
+		{"unaware"_s, Ability::Unaware},
+		{"unburden"_s, Ability::Unburden},
+		{"unnerve"_s, Ability::Unnerve},
+		{"victorystar"_s, Ability::Victory_Star},
+		{"vitalspirit"_s, Ability::Vital_Spirit},
+		{"voltabsorb"_s, Ability::Volt_Absorb},
+		{"wanderingspirit"_s, Ability::Wandering_Spirit},
+		{"waterabsorb"_s, Ability::Water_Absorb},
+		{"waterbubble"_s, Ability::Water_Bubble},
+		{"watercompaction"_s, Ability::Water_Compaction},
+		{"waterveil"_s, Ability::Water_Veil},
+		{"weakarmor"_s, Ability::Weak_Armor},
+		{"whitesmoke"_s, Ability::White_Smoke},
+		{"wimpout"_s, Ability::Wimp_Out},
+		{"wonderguard"_s, Ability::Wonder_Guard},
+		{"wonderskin"_s, Ability::Wonder_Skin},
+		{"zenmode"_s, Ability::Zen_Mode},
+	});
+	// Longer strings are truncated to the length of the longest key
+	auto const result = converter.lookup(containers::take(lowercase_alphanumeric(str), 15_bi));
 	if (!result) {
 		throw InvalidFromStringConversion("Ability"_s, str);
 	}
@@ -11,6 +11,7 @@ import tm.string_conversions.invalid_string_conversion;
 import tm.string_conversions.lowercase_alphanumeric;
 
 import tm.item;
+import tm.perfect_hash_map;
 
 import bounded;
 import containers;
@@ -892,865 +893,862 @@ export constexpr auto to_string(Item const item) -> containers::string_view {
 
 export template<>
 constexpr auto from_string(containers::string_view const str) -> Item {
-	static constexpr auto converter = containers::basic_flat_map(
-		containers::assume_sorted_unique,
-		containers::to_array<containers::map_value_type<containers::string_view, Item>>({
-			{""_s, Item::None},
-			{"abilitycapsule"_s, Item::Ability_Capsule},
-			{"abomasite"_s, Item::Abomasite},
-			{"absolite"_s, Item::Absolite},
-			{"absorbbulb"_s, Item::Absorb_Bulb},
-			{"adamantmint"_s, Item::Adamant_Mint},
-			{"adamantorb"_s, Item::Adamant_Orb},
-			{"adrenalineorb"_s, Item::Adrenaline_Orb},
-			{"aerodactylite"_s, Item::Aerodactylite},
-			{"aggronite"_s, Item::Aggronite},
-			{"aguavberry"_s, Item::Aguav_Berry},
-			{"airballoon"_s, Item::Air_Balloon},
-			{"airmail"_s, Item::Air_Mail},
-			{"alakazite"_s, Item::Alakazite},
-			{"aloraichiumz"_s, Item::Aloraichium_Z},
-			{"altarianite"_s, Item::Altarianite},
-			{"amazemulch"_s, Item::Amaze_Mulch},
-			{"ampharosite"_s, Item::Ampharosite},
-			{"amuletcoin"_s, Item::Amulet_Coin},
-			{"antidote"_s, Item::Antidote},
-			{"apicotberry"_s, Item::Apicot_Berry},
-			{"armorfossil"_s, Item::Armor_Fossil},
-			{"aspearberry"_s, Item::Aspear_Berry},
-			{"assaultvest"_s, Item::Assault_Vest},
-			{"audinite"_s, Item::Audinite},
-			{"awakening"_s, Item::Awakening},
-			{"babiriberry"_s, Item::Babiri_Berry},
-			{"bachsfoodtin"_s, Item::Bachs_Food_Tin},
-			{"balmmushroom"_s, Item::Balm_Mushroom},
-			{"banettite"_s, Item::Banettite},
-			{"beadmail"_s, Item::Bead_Mail},
-			{"beastball"_s, Item::Beast_Ball},
-			{"beedrillite"_s, Item::Beedrillite},
-			{"belueberry"_s, Item::Belue_Berry},
-			{"berry"_s, Item::Berry},
-			{"berryjuice"_s, Item::Berry_Juice},
-			{"berrysweet"_s, Item::Berry_Sweet},
-			{"berserkgene"_s, Item::Berserk_Gene},
-			{"bigmalasada"_s, Item::Big_Malasada},
-			{"bigmushroom"_s, Item::Big_Mushroom},
-			{"bignugget"_s, Item::Big_Nugget},
-			{"bigpearl"_s, Item::Big_Pearl},
-			{"bigroot"_s, Item::Big_Root},
-			{"bindingband"_s, Item::Binding_Band},
-			{"bitterberry"_s, Item::Bitter_Berry},
-			{"blackapricorn"_s, Item::Black_Apricorn},
-			{"blackbelt"_s, Item::Black_Belt},
-			{"blackflute"_s, Item::Black_Flute},
-			{"blackglasses"_s, Item::Black_Glasses},
-			{"blacksludge"_s, Item::Black_Sludge},
-			{"blastoisinite"_s, Item::Blastoisinite},
-			{"blazikenite"_s, Item::Blazikenite},
-			{"bloommail"_s, Item::Bloom_Mail},
-			{"blueapricorn"_s, Item::Blue_Apricorn},
-			{"blueflute"_s, Item::Blue_Flute},
-			{"blueorb"_s, Item::Blue_Orb},
-			{"bluescarf"_s, Item::Blue_Scarf},
-			{"blueshard"_s, Item::Blue_Shard},
-			{"blueskymail"_s, Item::Bluesky_Mail},
-			{"blukberry"_s, Item::Bluk_Berry},
-			{"blunderpolicy"_s, Item::Blunder_Policy},
-			{"bobsfoodtin"_s, Item::Bobs_Food_Tin},
-			{"boiledegg"_s, Item::Boiled_Egg},
-			{"boldmint"_s, Item::Bold_Mint},
-			{"boostmulch"_s, Item::Boost_Mulch},
-			{"bottlecap"_s, Item::Bottle_Cap},
-			{"bravemint"_s, Item::Brave_Mint},
-			{"bread"_s, Item::Bread},
-			{"brickmail"_s, Item::Brick_Mail},
-			{"brickpiece"_s, Item::Brick_Piece},
-			{"bridgemaild"_s, Item::BridgeMail_D},
-			{"bridgemailm"_s, Item::BridgeMail_M},
-			{"bridgemails"_s, Item::BridgeMail_S},
-			{"bridgemailt"_s, Item::BridgeMail_T},
-			{"bridgemailv"_s, Item::BridgeMail_V},
-			{"brightpowder"_s, Item::Bright_Powder},
-			{"brittlebones"_s, Item::Brittle_Bones},
-			{"bubblemail"_s, Item::Bubble_Mail},
-			{"buggem"_s, Item::Bug_Gem},
-			{"buginiumz"_s, Item::Buginium_Z},
-			{"bugmemory"_s, Item::Bug_Memory},
-			{"burndrive"_s, Item::Burn_Drive},
-			{"burnheal"_s, Item::Burn_Heal},
-			{"burntberry"_s, Item::Burnt_Berry},
-			{"calcium"_s, Item::Calcium},
-			{"calmmint"_s, Item::Calm_Mint},
-			{"cameruptite"_s, Item::Cameruptite},
-			{"carbos"_s, Item::Carbos},
-			{"carefulmint"_s, Item::Careful_Mint},
-			{"casteliacone"_s, Item::Casteliacone},
-			{"cellbattery"_s, Item::Cell_Battery},
-			{"charcoal"_s, Item::Charcoal},
-			{"charizarditex"_s, Item::Charizardite_X},
-			{"charizarditey"_s, Item::Charizardite_Y},
-			{"chartiberry"_s, Item::Charti_Berry},
-			{"cheriberry"_s, Item::Cheri_Berry},
-			{"cherishball"_s, Item::Cherish_Ball},
-			{"chestoberry"_s, Item::Chesto_Berry},
-			{"chilanberry"_s, Item::Chilan_Berry},
-			{"chilldrive"_s, Item::Chill_Drive},
-			{"chippedpot"_s, Item::Chipped_Pot},
-			{"choiceband"_s, Item::Choice_Band},
-			{"choicescarf"_s, Item::Choice_Scarf},
-			{"choicespecs"_s, Item::Choice_Specs},
-			{"chopleberry"_s, Item::Chople_Berry},
-			{"clawfossil"_s, Item::Claw_Fossil},
-			{"cleansetag"_s, Item::Cleanse_Tag},
-			{"cleverwing"_s, Item::Clever_Wing},
-			{"cloversweet"_s, Item::Clover_Sweet},
-			{"cobaberry"_s, Item::Coba_Berry},
-			{"coconutmilk"_s, Item::Coconut_Milk},
-			{"colburberry"_s, Item::Colbur_Berry},
-			{"cometshard"_s, Item::Comet_Shard},
-			{"cornnberry"_s, Item::Cornn_Berry},
-			{"coverfossil"_s, Item::Cover_Fossil},
-			{"crackedpot"_s, Item::Cracked_Pot},
-			{"custapberry"_s, Item::Custap_Berry},
-			{"dampmulch"_s, Item::Damp_Mulch},
-			{"damprock"_s, Item::Damp_Rock},
-			{"darkgem"_s, Item::Dark_Gem},
-			{"darkiniumz"_s, Item::Darkinium_Z},
-			{"darkmemory"_s, Item::Dark_Memory},
-			{"dawnstone"_s, Item::Dawn_Stone},
-			{"decidiumz"_s, Item::Decidium_Z},
-			{"deepseascale"_s, Item::Deep_Sea_Scale},
-			{"deepseatooth"_s, Item::Deep_Sea_Tooth},
-			{"destinyknot"_s, Item::Destiny_Knot},
-			{"diancite"_s, Item::Diancite},
-			{"direhit"_s, Item::Dire_Hit},
-			{"discountcoupon"_s, Item::Discount_Coupon},
-			{"diveball"_s, Item::Dive_Ball},
-			{"domefossil"_s, Item::Dome_Fossil},
-			{"dousedrive"_s, Item::Douse_Drive},
-			{"dracoplate"_s, Item::Draco_Plate},
-			{"dragonfang"_s, Item::Dragon_Fang},
-			{"dragongem"_s, Item::Dragon_Gem},
-			{"dragoniumz"_s, Item::Dragonium_Z},
-			{"dragonmemory"_s, Item::Dragon_Memory},
-			{"dragonscale"_s, Item::Dragon_Scale},
-			{"drashberry"_s, Item::Drash_Berry},
-			{"dreadplate"_s, Item::Dread_Plate},
-			{"dreamball"_s, Item::Dream_Ball},
-			{"dreammail"_s, Item::Dream_Mail},
-			{"dubiousdisc"_s, Item::Dubious_Disc},
-			{"durinberry"_s, Item::Durin_Berry},
-			{"duskball"_s, Item::Dusk_Ball},
-			{"duskstone"_s, Item::Dusk_Stone},
-			{"earthplate"_s, Item::Earth_Plate},
-			{"eeviumz"_s, Item::Eevium_Z},
-			{"eggantberry"_s, Item::Eggant_Berry},
-			{"ejectbutton"_s, Item::Eject_Button},
-			{"ejectpack"_s, Item::Eject_Pack},
-			{"electirizer"_s, Item::Electirizer},
-			{"electricgem"_s, Item::Electric_Gem},
-			{"electricmemory"_s, Item::Electric_Memory},
-			{"electricseed"_s, Item::Electric_Seed},
-			{"electriumz"_s, Item::Electrium_Z},
-			{"elixir"_s, Item::Elixir},
-			{"energypowder"_s, Item::Energy_Powder},
-			{"energyroot"_s, Item::Energy_Root},
-			{"enigmaberry"_s, Item::Enigma_Berry},
-			{"eonmail"_s, Item::Eon_Mail},
-			{"escaperope"_s, Item::Escape_Rope},
-			{"ether"_s, Item::Ether},
-			{"everstone"_s, Item::Everstone},
-			{"eviolite"_s, Item::Eviolite},
-			{"expertbelt"_s, Item::Expert_Belt},
-			{"expshare"_s, Item::Exp_Share},
-			{"fabmail"_s, Item::Fab_Mail},
-			{"fairiumz"_s, Item::Fairium_Z},
-			{"fairygem"_s, Item::Fairy_Gem},
-			{"fairymemory"_s, Item::Fairy_Memory},
-			{"fancyapple"_s, Item::Fancy_Apple},
-			{"fastball"_s, Item::Fast_Ball},
-			{"favoredmail"_s, Item::Favored_Mail},
-			{"festivalticket"_s, Item::Festival_Ticket},
-			{"fightinggem"_s, Item::Fighting_Gem},
-			{"fightingmemory"_s, Item::Fighting_Memory},
-			{"fightiniumz"_s, Item::Fightinium_Z},
-			{"figyberry"_s, Item::Figy_Berry},
-			{"firegem"_s, Item::Fire_Gem},
-			{"firememory"_s, Item::Fire_Memory},
-			{"firestone"_s, Item::Fire_Stone},
-			{"firiumz"_s, Item::Firium_Z},
-			{"fistplate"_s, Item::Fist_Plate},
-			{"flamemail"_s, Item::Flame_Mail},
-			{"flameorb"_s, Item::Flame_Orb},
-			{"flameplate"_s, Item::Flame_Plate},
-			{"floatstone"_s, Item::Float_Stone},
-			{"flowermail"_s, Item::Flower_Mail},
-			{"flowersweet"_s, Item::Flower_Sweet},
-			{"fluffytail"_s, Item::Fluffy_Tail},
-			{"flyinggem"_s, Item::Flying_Gem},
-			{"flyingmemory"_s, Item::Flying_Memory},
-			{"flyiniumz"_s, Item::Flyinium_Z},
-			{"focusband"_s, Item::Focus_Band},
-			{"focussash"_s, Item::Focus_Sash},
-			{"fossilizedbird"_s, Item::Fossilized_Bird},
-			{"fossilizeddino"_s, Item::Fossilized_Dino},
-			{"fossilizeddrake"_s, Item::Fossilized_Drake},
-			{"fossilizedfish"_s, Item::Fossilized_Fish},
-			{"freshcream"_s, Item::Fresh_Cream},
-			{"freshwater"_s, Item::Fresh_Water},
-			{"friedfood"_s, Item::Fried_Food},
-			{"friendball"_s, Item::Friend_Ball},
-			{"fruitbunch"_s, Item::Fruit_Bunch},
-			{"fullheal"_s, Item::Full_Heal},
-			{"fullincense"_s, Item::Full_Incense},
-			{"fullrestore"_s, Item::Full_Restore},
-			{"galladite"_s, Item::Galladite},
-			{"ganlonberry"_s, Item::Ganlon_Berry},
-			{"garchompite"_s, Item::Garchompite},
-			{"gardevoirite"_s, Item::Gardevoirite},
-			{"gengarite"_s, Item::Gengarite},
-			{"geniuswing"_s, Item::Genius_Wing},
-			{"gentlemint"_s, Item::Gentle_Mint},
-			{"ghostgem"_s, Item::Ghost_Gem},
-			{"ghostiumz"_s, Item::Ghostium_Z},
-			{"ghostmemory"_s, Item::Ghost_Memory},
-			{"gigantamix"_s, Item::Gigantamix},
-			{"ginemaberry"_s, Item::Ginema_Berry},
-			{"glalitite"_s, Item::Glalitite},
-			{"glittermail"_s, Item::Glitter_Mail},
-			{"goldberry"_s, Item::Gold_Berry},
-			{"goldbottlecap"_s, Item::Gold_Bottle_Cap},
-			{"goldleaf"_s, Item::Gold_Leaf},
-			{"gooeymulch"_s, Item::Gooey_Mulch},
-			{"gorgeousbox"_s, Item::Gorgeous_Box},
-			{"grassgem"_s, Item::Grass_Gem},
-			{"grassiumz"_s, Item::Grassium_Z},
-			{"grassmail"_s, Item::Grass_Mail},
-			{"grassmemory"_s, Item::Grass_Memory},
-			{"grassyseed"_s, Item::Grassy_Seed},
-			{"greatball"_s, Item::Great_Ball},
-			{"greenapricorn"_s, Item::Green_Apricorn},
-			{"greenscarf"_s, Item::Green_Scarf},
-			{"greenshard"_s, Item::Green_Shard},
-			{"greetmail"_s, Item::Greet_Mail},
-			{"grepaberry"_s, Item::Grepa_Berry},
-			{"gripclaw"_s, Item::Grip_Claw},
-			{"griseousorb"_s, Item::Griseous_Orb},
-			{"groundgem"_s, Item::Ground_Gem},
-			{"groundiumz"_s, Item::Groundium_Z},
-			{"groundmemory"_s, Item::Ground_Memory},
-			{"growthmulch"_s, Item::Growth_Mulch},
-			{"guardspec"_s, Item::Guard_Spec},
-			{"gyaradosite"_s, Item::Gyaradosite},
-			{"habanberry"_s, Item::Haban_Berry},
-			{"harbormail"_s, Item::Harbor_Mail},
-			{"hardstone"_s, Item::Hard_Stone},
-			{"hastymint"_s, Item::Hasty_Mint},
-			{"healball"_s, Item::Heal_Ball},
-			{"healpowder"_s, Item::Heal_Powder},
-			{"healthwing"_s, Item::Health_Wing},
-			{"heartmail"_s, Item::Heart_Mail},
-			{"heartscale"_s, Item::Heart_Scale},
-			{"heatrock"_s, Item::Heat_Rock},
-			{"heavyball"_s, Item::Heavy_Ball},
-			{"heavydutyboots"_s, Item::Heavy_Duty_Boots},
-			{"helixfossil"_s, Item::Helix_Fossil},
-			{"heracronite"_s, Item::Heracronite},
-			{"hondewberry"_s, Item::Hondew_Berry},
-			{"honey"_s, Item::Honey},
-			{"houndoominite"_s, Item::Houndoominite},
-			{"hpup"_s, Item::HP_Up},
-			{"hyperpotion"_s, Item::Hyper_Potion},
-			{"iapapaberry"_s, Item::Iapapa_Berry},
-			{"iceberry"_s, Item::Ice_Berry},
-			{"icegem"_s, Item::Ice_Gem},
-			{"iceheal"_s, Item::Ice_Heal},
-			{"icememory"_s, Item::Ice_Memory},
-			{"icestone"_s, Item::Ice_Stone},
-			{"icicleplate"_s, Item::Icicle_Plate},
-			{"iciumz"_s, Item::Icium_Z},
-			{"icyrock"_s, Item::Icy_Rock},
-			{"impishmint"_s, Item::Impish_Mint},
-			{"inciniumz"_s, Item::Incinium_Z},
-			{"inquirymail"_s, Item::Inquiry_Mail},
-			{"insectplate"_s, Item::Insect_Plate},
-			{"instantnoodles"_s, Item::Instant_Noodles},
-			{"iron"_s, Item::Iron},
-			{"ironball"_s, Item::Iron_Ball},
-			{"ironplate"_s, Item::Iron_Plate},
-			{"jabocaberry"_s, Item::Jaboca_Berry},
-			{"jawfossil"_s, Item::Jaw_Fossil},
-			{"jollymint"_s, Item::Jolly_Mint},
-			{"kangaskhanite"_s, Item::Kangaskhanite},
-			{"kasibberry"_s, Item::Kasib_Berry},
-			{"kebiaberry"_s, Item::Kebia_Berry},
-			{"keeberry"_s, Item::Kee_Berry},
-			{"kelpsyberry"_s, Item::Kelpsy_Berry},
-			{"kingsrock"_s, Item::Kings_Rock},
-			{"kommoniumz"_s, Item::Kommonium_Z},
-			{"kuoberry"_s, Item::Kuo_Berry},
-			{"laggingtail"_s, Item::Lagging_Tail},
-			{"lansatberry"_s, Item::Lansat_Berry},
-			{"largeleek"_s, Item::Large_Leek},
-			{"latiasite"_s, Item::Latiasite},
-			{"latiosite"_s, Item::Latiosite},
-			{"lavacookie"_s, Item::Lava_Cookie},
-			{"laxincense"_s, Item::Lax_Incense},
-			{"laxmint"_s, Item::Lax_Mint},
-			{"leafstone"_s, Item::Leaf_Stone},
-			{"leek"_s, Item::Leek},
-			{"leftovers"_s, Item::Leftovers},
-			{"lemonade"_s, Item::Lemonade},
-			{"leppaberry"_s, Item::Leppa_Berry},
-			{"levelball"_s, Item::Level_Ball},
-			{"liechiberry"_s, Item::Liechi_Berry},
-			{"lifeorb"_s, Item::Life_Orb},
-			{"lightball"_s, Item::Light_Ball},
-			{"lightclay"_s, Item::Light_Clay},
-			{"likemail"_s, Item::Like_Mail},
-			{"litebluemail"_s, Item::Litebluemail},
-			{"lonelymint"_s, Item::Lonely_Mint},
-			{"lopunnite"_s, Item::Lopunnite},
-			{"loveball"_s, Item::Love_Ball},
-			{"lovelymail"_s, Item::Lovely_Mail},
-			{"lovesweet"_s, Item::Love_Sweet},
-			{"lucarionite"_s, Item::Lucarionite},
-			{"luckincense"_s, Item::Luck_Incense},
-			{"luckyegg"_s, Item::Lucky_Egg},
-			{"luckypunch"_s, Item::Lucky_Punch},
-			{"lumberry"_s, Item::Lum_Berry},
-			{"luminousmoss"_s, Item::Luminous_Moss},
-			{"lumiosegalette"_s, Item::Lumiose_Galette},
-			{"lunaliumz"_s, Item::Lunalium_Z},
-			{"lureball"_s, Item::Lure_Ball},
-			{"lustrousorb"_s, Item::Lustrous_Orb},
-			{"luxuryball"_s, Item::Luxury_Ball},
-			{"lycaniumz"_s, Item::Lycanium_Z},
-			{"machobrace"_s, Item::Macho_Brace},
-			{"magmarizer"_s, Item::Magmarizer},
-			{"magnet"_s, Item::Magnet},
-			{"magoberry"_s, Item::Mago_Berry},
-			{"magostberry"_s, Item::Magost_Berry},
-			{"mail"_s, Item::Eon_Mail},
-			{"manectite"_s, Item::Manectite},
-			{"marangaberry"_s, Item::Maranga_Berry},
-			{"marshadiumz"_s, Item::Marshadium_Z},
-			{"masterball"_s, Item::Master_Ball},
-			{"mawilite"_s, Item::Mawilite},
-			{"maxelixir"_s, Item::Max_Elixir},
-			{"maxether"_s, Item::Max_Ether},
-			{"maxpotion"_s, Item::Max_Potion},
-			{"maxrepel"_s, Item::Max_Repel},
-			{"maxrevive"_s, Item::Max_Revive},
-			{"meadowplate"_s, Item::Meadow_Plate},
-			{"mechmail"_s, Item::Mech_Mail},
-			{"medichamite"_s, Item::Medichamite},
-			{"mentalherb"_s, Item::Mental_Herb},
-			{"metagrossite"_s, Item::Metagrossite},
-			{"metalcoat"_s, Item::Metal_Coat},
-			{"metalpowder"_s, Item::Metal_Powder},
-			{"metronome"_s, Item::Metronome},
-			{"mewniumz"_s, Item::Mewnium_Z},
-			{"mewtwonitex"_s, Item::Mewtwonite_X},
-			{"mewtwonitey"_s, Item::Mewtwonite_Y},
-			{"micleberry"_s, Item::Micle_Berry},
-			{"mildmint"_s, Item::Mild_Mint},
-			{"mimikiumz"_s, Item::Mimikium_Z},
-			{"mindplate"_s, Item::Mind_Plate},
-			{"mintberry"_s, Item::Mint_Berry},
-			{"miracleberry"_s, Item::MiracleBerry},
-			{"miracleseed"_s, Item::Miracle_Seed},
-			{"miragemail"_s, Item::Mirage_Mail},
-			{"mistyseed"_s, Item::Misty_Seed},
-			{"mixedmushrooms"_s, Item::Mixed_Mushrooms},
-			{"modestmint"_s, Item::Modest_Mint},
-			{"moomoocheese"_s, Item::Moomoo_Cheese},
-			{"moomoomilk"_s, Item::Moomoo_Milk},
-			{"moonball"_s, Item::Moon_Ball},
-			{"moonstone"_s, Item::Moon_Stone},
-			{"morphmail"_s, Item::Morph_Mail},
-			{"mosaicmail"_s, Item::Mosaic_Mail},
-			{"muscleband"_s, Item::Muscle_Band},
-			{"musclewing"_s, Item::Muscle_Wing},
-			{"musicmail"_s, Item::Music_Mail},
-			{"mysteryberry"_s, Item::MysteryBerry},
-			{"mysticwater"_s, Item::Mystic_Water},
-			{"naivemint"_s, Item::Naive_Mint},
-			{"nanabberry"_s, Item::Nanab_Berry},
-			{"naughtymint"_s, Item::Naughty_Mint},
-			{"nestball"_s, Item::Nest_Ball},
-			{"netball"_s, Item::Net_Ball},
-			{"nevermeltice"_s, Item::Never_Melt_Ice},
-			{"ninikuberry"_s, Item::Niniku_Berry},
-			{"nomelberry"_s, Item::Nomel_Berry},
-			{"none"_s, Item::None},
-			{"normalbox"_s, Item::Normal_Box},
-			{"normalgem"_s, Item::Normal_Gem},
-			{"normaliumz"_s, Item::Normalium_Z},
-			{"nugget"_s, Item::Nugget},
-			{"nutpeaberry"_s, Item::Nutpea_Berry},
-			{"occaberry"_s, Item::Occa_Berry},
-			{"oddincense"_s, Item::Odd_Incense},
-			{"oddkeystone"_s, Item::Odd_Keystone},
-			{"oldamber"_s, Item::Old_Amber},
-			{"oldgateau"_s, Item::Old_Gateau},
-			{"oranberry"_s, Item::Oran_Berry},
-			{"orangemail"_s, Item::Orange_Mail},
-			{"ovalstone"_s, Item::Oval_Stone},
-			{"packagedcurry"_s, Item::Packaged_Curry},
-			{"packofpotatoes"_s, Item::Pack_of_Potatoes},
-			{"pamtreberry"_s, Item::Pamtre_Berry},
-			{"paralyzeheal"_s, Item::Paralyze_Heal},
-			{"parkball"_s, Item::Park_Ball},
-			{"parlyzheal"_s, Item::Paralyze_Heal},
-			{"passhoberry"_s, Item::Passho_Berry},
-			{"passorb"_s, Item::Pass_Orb},
-			{"pasta"_s, Item::Pasta},
-			{"payapaberry"_s, Item::Payapa_Berry},
-			{"pearl"_s, Item::Pearl},
-			{"pearlstring"_s, Item::Pearl_String},
-			{"pechaberry"_s, Item::Pecha_Berry},
-			{"persimberry"_s, Item::Persim_Berry},
-			{"petayaberry"_s, Item::Petaya_Berry},
-			{"pewtercrunchies"_s, Item::Pewter_Crunchies},
-			{"pidgeotite"_s, Item::Pidgeotite},
-			{"pikaniumz"_s, Item::Pikanium_Z},
-			{"pikashuniumz"_s, Item::Pikashunium_Z},
-			{"pinapberry"_s, Item::Pinap_Berry},
-			{"pinkapricorn"_s, Item::Pink_Apricorn},
-			{"pinkbow"_s, Item::Pink_Bow},
-			{"pinknectar"_s, Item::Pink_Nectar},
-			{"pinkscarf"_s, Item::Pink_Scarf},
-			{"pinsirite"_s, Item::Pinsirite},
-			{"pixieplate"_s, Item::Pixie_Plate},
-			{"plumefossil"_s, Item::Plume_Fossil},
-			{"poisonbarb"_s, Item::Poison_Barb},
-			{"poisongem"_s, Item::Poison_Gem},
-			{"poisoniumz"_s, Item::Poisonium_Z},
-			{"poisonmemory"_s, Item::Poison_Memory},
-			{"pokeball"_s, Item::Poke_Ball},
-			{"pokedoll"_s, Item::Poke_Doll},
-			{"poketoy"_s, Item::Poke_Toy},
-			{"polkadotbow"_s, Item::Polkadot_Bow},
-			{"pomegberry"_s, Item::Pomeg_Berry},
-			{"portraitmail"_s, Item::Portraitmail},
-			{"potion"_s, Item::Potion},
-			{"poweranklet"_s, Item::Power_Anklet},
-			{"powerband"_s, Item::Power_Band},
-			{"powerbelt"_s, Item::Power_Belt},
-			{"powerbracer"_s, Item::Power_Bracer},
-			{"powerherb"_s, Item::Power_Herb},
-			{"powerlens"_s, Item::Power_Lens},
-			{"powerweight"_s, Item::Power_Weight},
-			{"ppmax"_s, Item::PP_Max},
-			{"ppup"_s, Item::PP_Up},
-			{"precookedburger"_s, Item::Precooked_Burger},
-			{"premierball"_s, Item::Premier_Ball},
-			{"prettywing"_s, Item::Pretty_Wing},
-			{"primariumz"_s, Item::Primarium_Z},
-			{"prismscale"_s, Item::Prism_Scale},
-			{"protectivepads"_s, Item::Protective_Pads},
-			{"protector"_s, Item::Protector},
-			{"protein"_s, Item::Protein},
-			{"przcureberry"_s, Item::PRZCureBerry},
-			{"psncureberry"_s, Item::PSNCureBerry},
-			{"psychicgem"_s, Item::Psychic_Gem},
-			{"psychicmemory"_s, Item::Psychic_Memory},
-			{"psychicseed"_s, Item::Psychic_Seed},
-			{"psychiumz"_s, Item::Psychium_Z},
-			{"pumkinberry"_s, Item::Pumkin_Berry},
-			{"pungentroot"_s, Item::Pungent_Root},
-			{"pureincense"_s, Item::Pure_Incense},
-			{"purplenectar"_s, Item::Purple_Nectar},
-			{"qualotberry"_s, Item::Qualot_Berry},
-			{"quickball"_s, Item::Quick_Ball},
-			{"quickclaw"_s, Item::Quick_Claw},
-			{"quickpowder"_s, Item::Quick_Powder},
-			{"quietmint"_s, Item::Quiet_Mint},
-			{"rabutaberry"_s, Item::Rabuta_Berry},
-			{"ragecandybar"_s, Item::Rage_Candy_Bar},
-			{"rarebone"_s, Item::Rare_Bone},
-			{"rarecandy"_s, Item::Rare_Candy},
-			{"rashmint"_s, Item::Rash_Mint},
-			{"rawstberry"_s, Item::Rawst_Berry},
-			{"razorclaw"_s, Item::Razor_Claw},
-			{"razorfang"_s, Item::Razor_Fang},
-			{"razzberry"_s, Item::Razz_Berry},
-			{"reapercloth"_s, Item::Reaper_Cloth},
-			{"redapricorn"_s, Item::Red_Apricorn},
-			{"redcard"_s, Item::Red_Card},
-			{"redflute"_s, Item::Red_Flute},
-			{"redorb"_s, Item::Red_Orb},
-			{"redscarf"_s, Item::Red_Scarf},
-			{"redshard"_s, Item::Red_Shard},
-			{"relaxedmint"_s, Item::Relaxed_Mint},
-			{"relicband"_s, Item::Relic_Band},
-			{"reliccopper"_s, Item::Relic_Copper},
-			{"reliccrown"_s, Item::Relic_Crown},
-			{"relicgold"_s, Item::Relic_Gold},
-			{"relicsilver"_s, Item::Relic_Silver},
-			{"relicstatue"_s, Item::Relic_Statue},
-			{"relicvase"_s, Item::Relic_Vase},
-			{"repeatball"_s, Item::Repeat_Ball},
-			{"repel"_s, Item::Repel},
-			{"replymail"_s, Item::Reply_Mail},
-			{"resistwing"_s, Item::Resist_Wing},
-			{"retromail"_s, Item::Retro_Mail},
-			{"revivalherb"_s, Item::Revival_Herb},
-			{"revive"_s, Item::Revive},
-			{"ribbonsweet"_s, Item::Ribbon_Sweet},
-			{"richmulch"_s, Item::Rich_Mulch},
-			{"rindoberry"_s, Item::Rindo_Berry},
-			{"ringtarget"_s, Item::Ring_Target},
-			{"rockgem"_s, Item::Rock_Gem},
-			{"rockincense"_s, Item::Rock_Incense},
-			{"rockiumz"_s, Item::Rockium_Z},
-			{"rockmemory"_s, Item::Rock_Memory},
-			{"rockyhelmet"_s, Item::Rocky_Helmet},
-			{"roomservice"_s, Item::Room_Service},
-			{"rootfossil"_s, Item::Root_Fossil},
-			{"roseincense"_s, Item::Rose_Incense},
-			{"roseliberry"_s, Item::Roseli_Berry},
-			{"rowapberry"_s, Item::Rowap_Berry},
-			{"rsvpmail"_s, Item::RSVP_Mail},
-			{"rustedshield"_s, Item::Rusted_Shield},
-			{"rustedsword"_s, Item::Rusted_Sword},
-			{"sablenite"_s, Item::Sablenite},
-			{"sachet"_s, Item::Sachet},
-			{"sacredash"_s, Item::Sacred_Ash},
-			{"safariball"_s, Item::Safari_Ball},
-			{"safetygoggles"_s, Item::Safety_Goggles},
-			{"sailfossil"_s, Item::Sail_Fossil},
-			{"salacberry"_s, Item::Salac_Berry},
-			{"saladmix"_s, Item::Salad_Mix},
-			{"salamencite"_s, Item::Salamencite},
-			{"sassymint"_s, Item::Sassy_Mint},
-			{"sausages"_s, Item::Sausages},
-			{"sceptilite"_s, Item::Sceptilite},
-			{"scizorite"_s, Item::Scizorite},
-			{"scopelens"_s, Item::Scope_Lens},
-			{"seaincense"_s, Item::Sea_Incense},
-			{"seriousmint"_s, Item::Serious_Mint},
-			{"shadowmail"_s, Item::Shadow_Mail},
-			{"shaloursable"_s, Item::Shalour_Sable},
-			{"sharpbeak"_s, Item::Sharp_Beak},
-			{"sharpedonite"_s, Item::Sharpedonite},
-			{"shedshell"_s, Item::Shed_Shell},
-			{"shellbell"_s, Item::Shell_Bell},
-			{"shinystone"_s, Item::Shiny_Stone},
-			{"shoalsalt"_s, Item::Shoal_Salt},
-			{"shoalshell"_s, Item::Shoal_Shell},
-			{"shockdrive"_s, Item::Shock_Drive},
-			{"shucaberry"_s, Item::Shuca_Berry},
-			{"silkscarf"_s, Item::Silk_Scarf},
-			{"silverleaf"_s, Item::Silver_Leaf},
-			{"silverpowder"_s, Item::Silver_Powder},
-			{"sitrusberry"_s, Item::Sitrus_Berry},
-			{"skullfossil"_s, Item::Skull_Fossil},
-			{"skyplate"_s, Item::Sky_Plate},
-			{"slowbronite"_s, Item::Slowbronite},
-			{"slowpoketail"_s, Item::Slowpoke_Tail},
-			{"smokeball"_s, Item::Smoke_Ball},
-			{"smokepoketail"_s, Item::Smoke_Poke_Tail},
-			{"smoothrock"_s, Item::Smooth_Rock},
-			{"snorliumz"_s, Item::Snorlium_Z},
-			{"snowball"_s, Item::Snowball},
-			{"snowmail"_s, Item::Snow_Mail},
-			{"sodapop"_s, Item::Soda_Pop},
-			{"softsand"_s, Item::Soft_Sand},
-			{"solganiumz"_s, Item::Solganium_Z},
-			{"soothebell"_s, Item::Soothe_Bell},
-			{"souldew"_s, Item::Soul_Dew},
-			{"spacemail"_s, Item::Space_Mail},
-			{"spelltag"_s, Item::Spell_Tag},
-			{"spelonberry"_s, Item::Spelon_Berry},
-			{"spicemix"_s, Item::Spice_Mix},
-			{"splashplate"_s, Item::Splash_Plate},
-			{"spookyplate"_s, Item::Spooky_Plate},
-			{"sportball"_s, Item::Sport_Ball},
-			{"stablemulch"_s, Item::Stable_Mulch},
-			{"stardust"_s, Item::Stardust},
-			{"starfberry"_s, Item::Starf_Berry},
-			{"starpiece"_s, Item::Star_Piece},
-			{"starsweet"_s, Item::Star_Sweet},
-			{"steelgem"_s, Item::Steel_Gem},
-			{"steeliumz"_s, Item::Steelium_Z},
-			{"steelixite"_s, Item::Steelixite},
-			{"steelmail"_s, Item::Steel_Mail},
-			{"steelmemory"_s, Item::Steel_Memory},
-			{"stick"_s, Item::Stick},
-			{"stickybarb"_s, Item::Sticky_Barb},
-			{"stoneplate"_s, Item::Stone_Plate},
-			{"strangesouvenir"_s, Item::Strange_Souvenir},
-			{"strawberrysweet"_s, Item::Strawberry_Sweet},
-			{"stribberry"_s, Item::Strib_Berry},
-			{"sunstone"_s, Item::Sun_Stone},
-			{"superpotion"_s, Item::Super_Potion},
-			{"superrepel"_s, Item::Super_Repel},
-			{"surfmail"_s, Item::Surf_Mail},
-			{"surprisemulch"_s, Item::Surprise_Mulch},
-			{"swampertite"_s, Item::Swampertite},
-			{"sweetapple"_s, Item::Sweet_Apple},
-			{"sweetheart"_s, Item::Sweet_Heart},
-			{"swiftwing"_s, Item::Swift_Wing},
-			{"tamatoberry"_s, Item::Tamato_Berry},
-			{"tangaberry"_s, Item::Tanga_Berry},
-			{"tapuniumz"_s, Item::Tapunium_Z},
-			{"tartapple"_s, Item::Tart_Apple},
-			{"terrainextender"_s, Item::Terrain_Extender},
-			{"thanksmail"_s, Item::Thanks_Mail},
-			{"thickclub"_s, Item::Thick_Club},
-			{"throatspray"_s, Item::Throat_Spray},
-			{"thunderstone"_s, Item::Thunder_Stone},
-			{"timerball"_s, Item::Timer_Ball},
-			{"timidmint"_s, Item::Timid_Mint},
-			{"tinofbeans"_s, Item::Tin_of_Beans},
-			{"tinymushroom"_s, Item::Tiny_Mushroom},
-			{"tm01"_s, Item::TM01},
-			{"tm02"_s, Item::TM02},
-			{"tm03"_s, Item::TM03},
-			{"tm04"_s, Item::TM04},
-			{"tm05"_s, Item::TM05},
-			{"tm06"_s, Item::TM06},
-			{"tm07"_s, Item::TM07},
-			{"tm08"_s, Item::TM08},
-			{"tm09"_s, Item::TM09},
-			{"tm10"_s, Item::TM10},
-			{"tm11"_s, Item::TM11},
-			{"tm12"_s, Item::TM12},
-			{"tm13"_s, Item::TM13},
-			{"tm14"_s, Item::TM14},
-			{"tm15"_s, Item::TM15},
-			{"tm16"_s, Item::TM16},
-			{"tm17"_s, Item::TM17},
-			{"tm18"_s, Item::TM18},
-			{"tm19"_s, Item::TM19},
-			{"tm20"_s, Item::TM20},
-			{"tm21"_s, Item::TM21},
-			{"tm22"_s, Item::TM22},
-			{"tm23"_s, Item::TM23},
-			{"tm24"_s, Item::TM24},
-			{"tm25"_s, Item::TM25},
-			{"tm26"_s, Item::TM26},
-			{"tm27"_s, Item::TM27},
-			{"tm28"_s, Item::TM28},
-			{"tm29"_s, Item::TM29},
-			{"tm30"_s, Item::TM30},
-			{"tm31"_s, Item::TM31},
-			{"tm32"_s, Item::TM32},
-			{"tm33"_s, Item::TM33},
-			{"tm34"_s, Item::TM34},
-			{"tm35"_s, Item::TM35},
-			{"tm36"_s, Item::TM36},
-			{"tm37"_s, Item::TM37},
-			{"tm38"_s, Item::TM38},
-			{"tm39"_s, Item::TM39},
-			{"tm40"_s, Item::TM40},
-			{"tm41"_s, Item::TM41},
-			{"tm42"_s, Item::TM42},
-			{"tm43"_s, Item::TM43},
-			{"tm44"_s, Item::TM44},
-			{"tm45"_s, Item::TM45},
-			{"tm46"_s, Item::TM46},
-			{"tm47"_s, Item::TM47},
-			{"tm48"_s, Item::TM48},
-			{"tm49"_s, Item::TM49},
-			{"tm50"_s, Item::TM50},
-			{"tm51"_s, Item::TM51},
-			{"tm52"_s, Item::TM52},
-			{"tm53"_s, Item::TM53},
-			{"tm54"_s, Item::TM54},
-			{"tm55"_s, Item::TM55},
-			{"tm56"_s, Item::TM56},
-			{"tm57"_s, Item::TM57},
-			{"tm58"_s, Item::TM58},
-			{"tm59"_s, Item::TM59},
-			{"tm60"_s, Item::TM60},
-			{"tm61"_s, Item::TM61},
-			{"tm62"_s, Item::TM62},
-			{"tm63"_s, Item::TM63},
-			{"tm64"_s, Item::TM64},
-			{"tm65"_s, Item::TM65},
-			{"tm66"_s, Item::TM66},
-			{"tm67"_s, Item::TM67},
-			{"tm68"_s, Item::TM68},
-			{"tm69"_s, Item::TM69},
-			{"tm70"_s, Item::TM70},
-			{"tm71"_s, Item::TM71},
-			{"tm72"_s, Item::TM72},
-			{"tm73"_s, Item::TM73},
-			{"tm74"_s, Item::TM74},
-			{"tm75"_s, Item::TM75},
-			{"tm76"_s, Item::TM76},
-			{"tm77"_s, Item::TM77},
-			{"tm78"_s, Item::TM78},
-			{"tm79"_s, Item::TM79},
-			{"tm80"_s, Item::TM80},
-			{"tm81"_s, Item::TM81},
-			{"tm82"_s, Item::TM82},
-			{"tm83"_s, Item::TM83},
-			{"tm84"_s, Item::TM84},
-			{"tm85"_s, Item::TM85},
-			{"tm86"_s, Item::TM86},
-			{"tm87"_s, Item::TM87},
-			{"tm88"_s, Item::TM88},
-			{"tm89"_s, Item::TM89},
-			{"tm90"_s, Item::TM90},
-			{"tm91"_s, Item::TM91},
-			{"tm92"_s, Item::TM92},
-			{"topoberry"_s, Item::Topo_Berry},
-			{"tougaberry"_s, Item::Touga_Berry},
-			{"toxicorb"_s, Item::Toxic_Orb},
-			{"toxicplate"_s, Item::Toxic_Plate},
-			{"tr00"_s, Item::TR00},
-			{"tr01"_s, Item::TR01},
-			{"tr02"_s, Item::TR02},
-			{"tr03"_s, Item::TR03},
-			{"tr04"_s, Item::TR04},
-			{"tr05"_s, Item::TR05},
-			{"tr06"_s, Item::TR06},
-			{"tr07"_s, Item::TR07},
-			{"tr08"_s, Item::TR08},
-			{"tr09"_s, Item::TR09},
-			{"tr10"_s, Item::TR10},
-			{"tr11"_s, Item::TR11},
-			{"tr12"_s, Item::TR12},
-			{"tr13"_s, Item::TR13},
-			{"tr14"_s, Item::TR14},
-			{"tr15"_s, Item::TR15},
-			{"tr16"_s, Item::TR16},
-			{"tr17"_s, Item::TR17},
-			{"tr18"_s, Item::TR18},
-			{"tr19"_s, Item::TR19},
-			{"tr20"_s, Item::TR20},
-			{"tr21"_s, Item::TR21},
-			{"tr22"_s, Item::TR22},
-			{"tr23"_s, Item::TR23},
-			{"tr24"_s, Item::TR24},
-			{"tr25"_s, Item::TR25},
-			{"tr26"_s, Item::TR26},
-			{"tr27"_s, Item::TR27},
-			{"tr28"_s, Item::TR28},
-			{"tr29"_s, Item::TR29},
-			{"tr30"_s, Item::TR30},
-			{"tr31"_s, Item::TR31},
-			{"tr32"_s, Item::TR32},
-			{"tr33"_s, Item::TR33},
-			{"tr34"_s, Item::TR34},
-			{"tr35"_s, Item::TR35},
-			{"tr36"_s, Item::TR36},
-			{"tr37"_s, Item::TR37},
-			{"tr38"_s, Item::TR38},
-			{"tr39"_s, Item::TR39},
-			{"tr40"_s, Item::TR40},
-			{"tr41"_s, Item::TR41},
-			{"tr42"_s, Item::TR42},
-			{"tr43"_s, Item::TR43},
-			{"tr44"_s, Item::TR44},
-			{"tr45"_s, Item::TR45},
-			{"tr46"_s, Item::TR46},
-			{"tr47"_s, Item::TR47},
-			{"tr48"_s, Item::TR48},
-			{"tr49"_s, Item::TR49},
-			{"tr50"_s, Item::TR50},
-			{"tr51"_s, Item::TR51},
-			{"tr52"_s, Item::TR52},
-			{"tr53"_s, Item::TR53},
-			{"tr54"_s, Item::TR54},
-			{"tr55"_s, Item::TR55},
-			{"tr56"_s, Item::TR56},
-			{"tr57"_s, Item::TR57},
-			{"tr58"_s, Item::TR58},
-			{"tr59"_s, Item::TR59},
-			{"tr60"_s, Item::TR60},
-			{"tr61"_s, Item::TR61},
-			{"tr62"_s, Item::TR62},
-			{"tr63"_s, Item::TR63},
-			{"tr64"_s, Item::TR64},
-			{"tr65"_s, Item::TR65},
-			{"tr66"_s, Item::TR66},
-			{"tr67"_s, Item::TR67},
-			{"tr68"_s, Item::TR68},
-			{"tr69"_s, Item::TR69},
-			{"tr70"_s, Item::TR70},
-			{"tr71"_s, Item::TR71},
-			{"tr72"_s, Item::TR72},
-			{"tr73"_s, Item::TR73},
-			{"tr74"_s, Item::TR74},
-			{"tr75"_s, Item::TR75},
-			{"tr76"_s, Item::TR76},
-			{"tr77"_s, Item::TR77},
-			{"tr78"_s, Item::TR78},
-			{"tr79"_s, Item::TR79},
-			{"tr80"_s, Item::TR80},
-			{"tr81"_s, Item::TR81},
-			{"tr82"_s, Item::TR82},
-			{"tr83"_s, Item::TR83},
-			{"tr84"_s, Item::TR84},
-			{"tr85"_s, Item::TR85},
-			{"tr86"_s, Item::TR86},
-			{"tr87"_s, Item::TR87},
-			{"tr88"_s, Item::TR88},
-			{"tr89"_s, Item::TR89},
-			{"tr90"_s, Item::TR90},
-			{"tr91"_s, Item::TR91},
-			{"tr92"_s, Item::TR92},
-			{"tr93"_s, Item::TR93},
-			{"tr94"_s, Item::TR94},
-			{"tr95"_s, Item::TR95},
-			{"tr96"_s, Item::TR96},
-			{"tr97"_s, Item::TR97},
-			{"tr98"_s, Item::TR98},
-			{"tr99"_s, Item::TR99},
-			{"tropicmail"_s, Item::Tropic_Mail},
-			{"tunnelmail"_s, Item::Tunnel_Mail},
-			{"twistedspoon"_s, Item::Twisted_Spoon},
-			{"tyranitarite"_s, Item::Tyranitarite},
-			{"ultraball"_s, Item::Ultra_Ball},
-			{"ultranecroziumz"_s, Item::Ultranecrozium_Z},
-			{"upgrade"_s, Item::Up_Grade},
-			{"utilityumbrella"_s, Item::Utility_Umbrella},
-			{"venusaurite"_s, Item::Venusaurite},
-			{"wacanberry"_s, Item::Wacan_Berry},
-			{"watergem"_s, Item::Water_Gem},
-			{"wateriumz"_s, Item::Waterium_Z},
-			{"watermemory"_s, Item::Water_Memory},
-			{"waterstone"_s, Item::Water_Stone},
-			{"watmelberry"_s, Item::Watmel_Berry},
-			{"waveincense"_s, Item::Wave_Incense},
-			{"wavemail"_s, Item::Wave_Mail},
-			{"weaknesspolicy"_s, Item::Weakness_Policy},
-			{"wepearberry"_s, Item::Wepear_Berry},
-			{"whippeddream"_s, Item::Whipped_Dream},
-			{"whiteapricorn"_s, Item::White_Apricorn},
-			{"whiteflute"_s, Item::White_Flute},
-			{"whiteherb"_s, Item::White_Herb},
-			{"widelens"_s, Item::Wide_Lens},
-			{"wikiberry"_s, Item::Wiki_Berry},
-			{"wiseglasses"_s, Item::Wise_Glasses},
-			{"woodmail"_s, Item::Wood_Mail},
-			{"xaccuracy"_s, Item::X_Accuracy},
-			{"xattack"_s, Item::X_Attack},
-			{"xdefend"_s, Item::X_Defend},
-			{"xdefense"_s, Item::X_Defense},
-			{"xspatk"_s, Item::X_Sp_Atk},
-			{"xspdef"_s, Item::X_Sp_Def},
-			{"xspecial"_s, Item::X_Special},
-			{"xspeed"_s, Item::X_Speed},
-			{"yacheberry"_s, Item::Yache_Berry},
-			{"yagoberry"_s, Item::Yago_Berry},
-			{"yellowapricorn"_s, Item::Yellow_Apricorn},
-			{"yellowflute"_s, Item::Yellow_Flute},
-			{"yellownectar"_s, Item::Yellow_Nectar},
-			{"yellowscarf"_s, Item::Yellow_Scarf},
-			{"yellowshard"_s, Item::Yellow_Shard},
-			{"zapplate"_s, Item::Zap_Plate},
-			{"zinc"_s, Item::Zinc},
-			{"zoomlens"_s, Item::Zoom_Lens},
-		})
-	);
-	auto const converted = fixed_capacity_lowercase_and_digit_string<15_bi>(str);
-	auto const result = containers::lookup(converter, converted);
+	static constexpr auto converter = make_perfect_hash_map<Item>({
+		{""_s, Item::None},
+		{"abilitycapsule"_s, Item::Ability_Capsule},
+		{"abomasite"_s, Item::Abomasite},
+		{"absolite"_s, Item::Absolite},
+		{"absorbbulb"_s, Item::Absorb_Bulb},
+		{"adamantmint"_s, Item::Adamant_Mint},
+		{"adamantorb"_s, Item::Adamant_Orb},
+		{"adrenalineorb"_s, Item::Adrenaline_Orb},
+		{"aerodactylite"_s, Item::Aerodactylite},
+		{"aggronite"_s, Item::Aggronite},
+		{"aguavberry"_s, Item::Aguav_Berry},
+		{"airballoon"_s, Item::Air_Balloon},
+		{"airmail"_s, Item::Air_Mail},
+		{"alakazite"_s, Item::Alakazite},
+		{"aloraichiumz"_s, Item::Aloraichium_Z},
+		{"altarianite"_s, Item::Altarianite},
+		{"amazemulch"_s, Item::Amaze_Mulch},
+		{"ampharosite"_s, Item::Ampharosite},
+		{"amuletcoin"_s, Item::Amulet_Coin},
+		{"antidote"_s, Item::Antidote},
+		{"apicotberry"_s, Item::Apicot_Berry},
+		{"armorfossil"_s, Item::Armor_Fossil},
+		{"aspearberry"_s, Item::Aspear_Berry},
+		{"assaultvest"_s, Item::Assault_Vest},
+		{"audinite"_s, Item::Audinite},
+		{"awakening"_s, Item::Awakening},
+		{"babiriberry"_s, Item::Babiri_Berry},
+		{"bachsfoodtin"_s, Item::Bachs_Food_Tin},
+		{"balmmushroom"_s, Item::Balm_Mushroom},
+		{"banettite"_s, Item::Banettite},
+		{"beadmail"_s, Item::Bead_Mail},
+		{"beastball"_s, Item::Beast_Ball},
+		{"beedrillite"_s, Item::Beedrillite},
+		{"belueberry"_s, Item::Belue_Berry},
+		{"berry"_s, Item::Berry},
+		{"berryjuice"_s, Item::Berry_Juice},
+		{"berrysweet"_s, Item::Berry_Sweet},
+		{"berserkgene"_s, Item::Berserk_Gene},
+		{"bigmalasada"_s, Item::Big_Malasada},
+		{"bigmushroom"_s, Item::Big_Mushroom},
+		{"bignugget"_s, Item::Big_Nugget},
+		{"bigpearl"_s, Item::Big_Pearl},
+		{"bigroot"_s, Item::Big_Root},
+		{"bindingband"_s, Item::Binding_Band},
+		{"bitterberry"_s, Item::Bitter_Berry},
+		{"blackapricorn"_s, Item::Black_Apricorn},
+		{"blackbelt"_s, Item::Black_Belt},
+		{"blackflute"_s, Item::Black_Flute},
+		{"blackglasses"_s, Item::Black_Glasses},
+		{"blacksludge"_s, Item::Black_Sludge},
+		{"blastoisinite"_s, Item::Blastoisinite},
+		{"blazikenite"_s, Item::Blazikenite},
+		{"bloommail"_s, Item::Bloom_Mail},
+		{"blueapricorn"_s, Item::Blue_Apricorn},
+		{"blueflute"_s, Item::Blue_Flute},
+		{"blueorb"_s, Item::Blue_Orb},
+		{"bluescarf"_s, Item::Blue_Scarf},
+		{"blueshard"_s, Item::Blue_Shard},
+		{"blueskymail"_s, Item::Bluesky_Mail},
+		{"blukberry"_s, Item::Bluk_Berry},
+		{"blunderpolicy"_s, Item::Blunder_Policy},
+		{"bobsfoodtin"_s, Item::Bobs_Food_Tin},
+		{"boiledegg"_s, Item::Boiled_Egg},
+		{"boldmint"_s, Item::Bold_Mint},
+		{"boostmulch"_s, Item::Boost_Mulch},
+		{"bottlecap"_s, Item::Bottle_Cap},
+		{"bravemint"_s, Item::Brave_Mint},
+		{"bread"_s, Item::Bread},
+		{"brickmail"_s, Item::Brick_Mail},
+		{"brickpiece"_s, Item::Brick_Piece},
+		{"bridgemaild"_s, Item::BridgeMail_D},
+		{"bridgemailm"_s, Item::BridgeMail_M},
+		{"bridgemails"_s, Item::BridgeMail_S},
+		{"bridgemailt"_s, Item::BridgeMail_T},
+		{"bridgemailv"_s, Item::BridgeMail_V},
+		{"brightpowder"_s, Item::Bright_Powder},
+		{"brittlebones"_s, Item::Brittle_Bones},
+		{"bubblemail"_s, Item::Bubble_Mail},
+		{"buggem"_s, Item::Bug_Gem},
+		{"buginiumz"_s, Item::Buginium_Z},
+		{"bugmemory"_s, Item::Bug_Memory},
+		{"burndrive"_s, Item::Burn_Drive},
+		{"burnheal"_s, Item::Burn_Heal},
+		{"burntberry"_s, Item::Burnt_Berry},
+		{"calcium"_s, Item::Calcium},
+		{"calmmint"_s, Item::Calm_Mint},
+		{"cameruptite"_s, Item::Cameruptite},
+		{"carbos"_s, Item::Carbos},
+		{"carefulmint"_s, Item::Careful_Mint},
+		{"casteliacone"_s, Item::Casteliacone},
+		{"cellbattery"_s, Item::Cell_Battery},
+		{"charcoal"_s, Item::Charcoal},
+		{"charizarditex"_s, Item::Charizardite_X},
+		{"charizarditey"_s, Item::Charizardite_Y},
+		{"chartiberry"_s, Item::Charti_Berry},
+		{"cheriberry"_s, Item::Cheri_Berry},
+		{"cherishball"_s, Item::Cherish_Ball},
+		{"chestoberry"_s, Item::Chesto_Berry},
+		{"chilanberry"_s, Item::Chilan_Berry},
+		{"chilldrive"_s, Item::Chill_Drive},
+		{"chippedpot"_s, Item::Chipped_Pot},
+		{"choiceband"_s, Item::Choice_Band},
+		{"choicescarf"_s, Item::Choice_Scarf},
+		{"choicespecs"_s, Item::Choice_Specs},
+		{"chopleberry"_s, Item::Chople_Berry},
+		{"clawfossil"_s, Item::Claw_Fossil},
+		{"cleansetag"_s, Item::Cleanse_Tag},
+		{"cleverwing"_s, Item::Clever_Wing},
+		{"cloversweet"_s, Item::Clover_Sweet},
+		{"cobaberry"_s, Item::Coba_Berry},
+		{"coconutmilk"_s, Item::Coconut_Milk},
+		{"colburberry"_s, Item::Colbur_Berry},
+		{"cometshard"_s, Item::Comet_Shard},
+		{"cornnberry"_s, Item::Cornn_Berry},
+		{"coverfossil"_s, Item::Cover_Fossil},
+		{"crackedpot"_s, Item::Cracked_Pot},
+		{"custapberry"_s, Item::Custap_Berry},
+		{"dampmulch"_s, Item::Damp_Mulch},
+		{"damprock"_s, Item::Damp_Rock},
+		{"darkgem"_s, Item::Dark_Gem},
+		{"darkiniumz"_s, Item::Darkinium_Z},
+		{"darkmemory"_s, Item::Dark_Memory},
+		{"dawnstone"_s, Item::Dawn_Stone},
+		{"decidiumz"_s, Item::Decidium_Z},
+		{"deepseascale"_s, Item::Deep_Sea_Scale},
+		{"deepseatooth"_s, Item::Deep_Sea_Tooth},
+		{"destinyknot"_s, Item::Destiny_Knot},
+		{"diancite"_s, Item::Diancite},
+		{"direhit"_s, Item::Dire_Hit},
+		{"discountcoupon"_s, Item::Discount_Coupon},
+		{"diveball"_s, Item::Dive_Ball},
+		{"domefossil"_s, Item::Dome_Fossil},
+		{"dousedrive"_s, Item::Douse_Drive},
+		{"dracoplate"_s, Item::Draco_Plate},
+		{"dragonfang"_s, Item::Dragon_Fang},
+		{"dragongem"_s, Item::Dragon_Gem},
+		{"dragoniumz"_s, Item::Dragonium_Z},
+		{"dragonmemory"_s, Item::Dragon_Memory},
+		{"dragonscale"_s, Item::Dragon_Scale},
+		{"drashberry"_s, Item::Drash_Berry},
+		{"dreadplate"_s, Item::Dread_Plate},
+		{"dreamball"_s, Item::Dream_Ball},
+		{"dreammail"_s, Item::Dream_Mail},
+		{"dubiousdisc"_s, Item::Dubious_Disc},
+		{"durinberry"_s, Item::Durin_Berry},
+		{"duskball"_s, Item::Dusk_Ball},
+		{"duskstone"_s, Item::Dusk_Stone},
+		{"earthplate"_s, Item::Earth_Plate},
+		{"eeviumz"_s, Item::Eevium_Z},
+		{"eggantberry"_s, Item::Eggant_Berry},
+		{"ejectbutton"_s, Item::Eject_Button},
+		{"ejectpack"_s, Item::Eject_Pack},
+		{"electirizer"_s, Item::Electirizer},
+		{"electricgem"_s, Item::Electric_Gem},
+		{"electricmemory"_s, Item::Electric_Memory},
+		{"electricseed"_s, Item::Electric_Seed},
+		{"electriumz"_s, Item::Electrium_Z},
+		{"elixir"_s, Item::Elixir},
+		{"energypowder"_s, Item::Energy_Powder},
+		{"energyroot"_s, Item::Energy_Root},
+		{"enigmaberry"_s, Item::Enigma_Berry},
+		{"eonmail"_s, Item::Eon_Mail},
+		{"escaperope"_s, Item::Escape_Rope},
+		{"ether"_s, Item::Ether},
+		{"everstone"_s, Item::Everstone},
+		{"eviolite"_s, Item::Eviolite},
+		{"expertbelt"_s, Item::Expert_Belt},
+		{"expshare"_s, Item::Exp_Share},
+		{"fabmail"_s, Item::Fab_Mail},
+		{"fairiumz"_s, Item::Fairium_Z},
+		{"fairygem"_s, Item::Fairy_Gem},
+		{"fairymemory"_s, Item::Fairy_Memory},
+		{"fancyapple"_s, Item::Fancy_Apple},
+		{"fastball"_s, Item::Fast_Ball},
+		{"favoredmail"_s, Item::Favored_Mail},
+		{"festivalticket"_s, Item::Festival_Ticket},
+		{"fightinggem"_s, Item::Fighting_Gem},
+		{"fightingmemory"_s, Item::Fighting_Memory},
+		{"fightiniumz"_s, Item::Fightinium_Z},
+		{"figyberry"_s, Item::Figy_Berry},
+		{"firegem"_s, Item::Fire_Gem},
+		{"firememory"_s, Item::Fire_Memory},
+		{"firestone"_s, Item::Fire_Stone},
+		{"firiumz"_s, Item::Firium_Z},
+		{"fistplate"_s, Item::Fist_Plate},
+		{"flamemail"_s, Item::Flame_Mail},
+		{"flameorb"_s, Item::Flame_Orb},
+		{"flameplate"_s, Item::Flame_Plate},
+		{"floatstone"_s, Item::Float_Stone},
+		{"flowermail"_s, Item::Flower_Mail},
+		{"flowersweet"_s, Item::Flower_Sweet},
+		{"fluffytail"_s, Item::Fluffy_Tail},
+		{"flyinggem"_s, Item::Flying_Gem},
+		{"flyingmemory"_s, Item::Flying_Memory},
+		{"flyiniumz"_s, Item::Flyinium_Z},
+		{"focusband"_s, Item::Focus_Band},
+		{"focussash"_s, Item::Focus_Sash},
+		{"fossilizedbird"_s, Item::Fossilized_Bird},
+		{"fossilizeddino"_s, Item::Fossilized_Dino},
+		{"fossilizeddrake"_s, Item::Fossilized_Drake},
+		{"fossilizedfish"_s, Item::Fossilized_Fish},
+		{"freshcream"_s, Item::Fresh_Cream},
+		{"freshwater"_s, Item::Fresh_Water},
+		{"friedfood"_s, Item::Fried_Food},
+		{"friendball"_s, Item::Friend_Ball},
+		{"fruitbunch"_s, Item::Fruit_Bunch},
+		{"fullheal"_s, Item::Full_Heal},
+		{"fullincense"_s, Item::Full_Incense},
+		{"fullrestore"_s, Item::Full_Restore},
+		{"galladite"_s, Item::Galladite},
+		{"ganlonberry"_s, Item::Ganlon_Berry},
+		{"garchompite"_s, Item::Garchompite},
+		{"gardevoirite"_s, Item::Gardevoirite},
+		{"gengarite"_s, Item::Gengarite},
+		{"geniuswing"_s, Item::Genius_Wing},
+		{"gentlemint"_s, Item::Gentle_Mint},
+		{"ghostgem"_s, Item::Ghost_Gem},
+		{"ghostiumz"_s, Item::Ghostium_Z},
+		{"ghostmemory"_s, Item::Ghost_Memory},
+		{"gigantamix"_s, Item::Gigantamix},
+		{"ginemaberry"_s, Item::Ginema_Berry},
+		{"glalitite"_s, Item::Glalitite},
+		{"glittermail"_s, Item::Glitter_Mail},
+		{"goldberry"_s, Item::Gold_Berry},
+		{"goldbottlecap"_s, Item::Gold_Bottle_Cap},
+		{"goldleaf"_s, Item::Gold_Leaf},
+		{"gooeymulch"_s, Item::Gooey_Mulch},
+		{"gorgeousbox"_s, Item::Gorgeous_Box},
+		{"grassgem"_s, Item::Grass_Gem},
+		{"grassiumz"_s, Item::Grassium_Z},
+		{"grassmail"_s, Item::Grass_Mail},
+		{"grassmemory"_s, Item::Grass_Memory},
+		{"grassyseed"_s, Item::Grassy_Seed},
+		{"greatball"_s, Item::Great_Ball},
+		{"greenapricorn"_s, Item::Green_Apricorn},
+		{"greenscarf"_s, Item::Green_Scarf},
+		{"greenshard"_s, Item::Green_Shard},
+		{"greetmail"_s, Item::Greet_Mail},
+		{"grepaberry"_s, Item::Grepa_Berry},
+		{"gripclaw"_s, Item::Grip_Claw},
+		{"griseousorb"_s, Item::Griseous_Orb},
+		{"groundgem"_s, Item::Ground_Gem},
+		{"groundiumz"_s, Item::Groundium_Z},
+		{"groundmemory"_s, Item::Ground_Memory},
+		{"growthmulch"_s, Item::Growth_Mulch},
+		{"guardspec"_s, Item::Guard_Spec},
+		{"gyaradosite"_s, Item::Gyaradosite},
+		{"habanberry"_s, Item::Haban_Berry},
+		{"harbormail"_s, Item::Harbor_Mail},
+		{"hardstone"_s, Item::Hard_Stone},
+		{"hastymint"_s, Item::Hasty_Mint},
+		{"healball"_s, Item::Heal_Ball},
+		{"healpowder"_s, Item::Heal_Powder},
+		{"healthwing"_s, Item::Health_Wing},
+		{"heartmail"_s, Item::Heart_Mail},
+		{"heartscale"_s, Item::Heart_Scale},
+		{"heatrock"_s, Item::Heat_Rock},
+		{"heavyball"_s, Item::Heavy_Ball},
+		{"heavydutyboots"_s, Item::Heavy_Duty_Boots},
+		{"helixfossil"_s, Item::Helix_Fossil},
+		{"heracronite"_s, Item::Heracronite},
+		{"hondewberry"_s, Item::Hondew_Berry},
+		{"honey"_s, Item::Honey},
+		{"houndoominite"_s, Item::Houndoominite},
+		{"hpup"_s, Item::HP_Up},
+		{"hyperpotion"_s, Item::Hyper_Potion},
+		{"iapapaberry"_s, Item::Iapapa_Berry},
+		{"iceberry"_s, Item::Ice_Berry},
+		{"icegem"_s, Item::Ice_Gem},
+		{"iceheal"_s, Item::Ice_Heal},
+		{"icememory"_s, Item::Ice_Memory},
+		{"icestone"_s, Item::Ice_Stone},
+		{"icicleplate"_s, Item::Icicle_Plate},
+		{"iciumz"_s, Item::Icium_Z},
+		{"icyrock"_s, Item::Icy_Rock},
+		{"impishmint"_s, Item::Impish_Mint},
+		{"inciniumz"_s, Item::Incinium_Z},
+		{"inquirymail"_s, Item::Inquiry_Mail},
+		{"insectplate"_s, Item::Insect_Plate},
+		{"instantnoodles"_s, Item::Instant_Noodles},
+		{"iron"_s, Item::Iron},
+		{"ironball"_s, Item::Iron_Ball},
+		{"ironplate"_s, Item::Iron_Plate},
+		{"jabocaberry"_s, Item::Jaboca_Berry},
+		{"jawfossil"_s, Item::Jaw_Fossil},
+		{"jollymint"_s, Item::Jolly_Mint},
+		{"kangaskhanite"_s, Item::Kangaskhanite},
+		{"kasibberry"_s, Item::Kasib_Berry},
+		{"kebiaberry"_s, Item::Kebia_Berry},
+		{"keeberry"_s, Item::Kee_Berry},
+		{"kelpsyberry"_s, Item::Kelpsy_Berry},
+		{"kingsrock"_s, Item::Kings_Rock},
+		{"kommoniumz"_s, Item::Kommonium_Z},
+		{"kuoberry"_s, Item::Kuo_Berry},
+		{"laggingtail"_s, Item::Lagging_Tail},
+		{"lansatberry"_s, Item::Lansat_Berry},
+		{"largeleek"_s, Item::Large_Leek},
+		{"latiasite"_s, Item::Latiasite},
+		{"latiosite"_s, Item::Latiosite},
+		{"lavacookie"_s, Item::Lava_Cookie},
+		{"laxincense"_s, Item::Lax_Incense},
+		{"laxmint"_s, Item::Lax_Mint},
+		{"leafstone"_s, Item::Leaf_Stone},
+		{"leek"_s, Item::Leek},
+		{"leftovers"_s, Item::Leftovers},
+		{"lemonade"_s, Item::Lemonade},
+		{"leppaberry"_s, Item::Leppa_Berry},
+		{"levelball"_s, Item::Level_Ball},
+		{"liechiberry"_s, Item::Liechi_Berry},
+		{"lifeorb"_s, Item::Life_Orb},
+		{"lightball"_s, Item::Light_Ball},
+		{"lightclay"_s, Item::Light_Clay},
+		{"likemail"_s, Item::Like_Mail},
+		{"litebluemail"_s, Item::Litebluemail},
+		{"lonelymint"_s, Item::Lonely_Mint},
+		{"lopunnite"_s, Item::Lopunnite},
+		{"loveball"_s, Item::Love_Ball},
+		{"lovelymail"_s, Item::Lovely_Mail},
+		{"lovesweet"_s, Item::Love_Sweet},
+		{"lucarionite"_s, Item::Lucarionite},
+		{"luckincense"_s, Item::Luck_Incense},
+		{"luckyegg"_s, Item::Lucky_Egg},
+		{"luckypunch"_s, Item::Lucky_Punch},
+		{"lumberry"_s, Item::Lum_Berry},
+		{"luminousmoss"_s, Item::Luminous_Moss},
+		{"lumiosegalette"_s, Item::Lumiose_Galette},
+		{"lunaliumz"_s, Item::Lunalium_Z},
+		{"lureball"_s, Item::Lure_Ball},
+		{"lustrousorb"_s, Item::Lustrous_Orb},
+		{"luxuryball"_s, Item::Luxury_Ball},
+		{"lycaniumz"_s, Item::Lycanium_Z},
+		{"machobrace"_s, Item::Macho_Brace},
+		{"magmarizer"_s, Item::Magmarizer},
+		{"magnet"_s, Item::Magnet},
+		{"magoberry"_s, Item::Mago_Berry},
+		{"magostberry"_s, Item::Magost_Berry},
+		{"mail"_s, Item::Eon_Mail},
+		{"manectite"_s, Item::Manectite},
+		{"marangaberry"_s, Item::Maranga_Berry},
+		{"marshadiumz"_s, Item::Marshadium_Z},
+		{"masterball"_s, Item::Master_Ball},
+		{"mawilite"_s, Item::Mawilite},
+		{"maxelixir"_s, Item::Max_Elixir},
+		{"maxether"_s, Item::Max_Ether},
+		{"maxpotion"_s, Item::Max_Potion},
+		{"maxrepel"_s, Item::Max_Repel},
+		{"maxrevive"_s, Item::Max_Revive},
+		{"meadowplate"_s, Item::Meadow_Plate},
+		{"mechmail"_s, Item::Mech_Mail},
+		{"medichamite"_s, Item::Medichamite},
+		{"mentalherb"_s, Item::Mental_Herb},
+		{"metagrossite"_s, Item::Metagrossite},
+		{"metalcoat"_s, Item::Metal_Coat},
+		{"metalpowder"_s, Item::Metal_Powder},
+		{"metronome"_s, Item::Metronome},
+		{"mewniumz"_s, Item::Mewnium_Z},
+		{"mewtwonitex"_s, Item::Mewtwonite_X},
+		{"mewtwonitey"_s, Item::Mewtwonite_Y},
+		{"micleberry"_s, Item::Micle_Berry},
+		{"mildmint"_s, Item::Mild_Mint},
+		{"mimikiumz"_s, Item::Mimikium_Z},
+		{"mindplate"_s, Item::Mind_Plate},
+		{"mintberry"_s, Item::Mint_Berry},
+		{"miracleberry"_s, Item::MiracleBerry},
+		{"miracleseed"_s, Item::Miracle_Seed},
+		{"miragemail"_s, Item::Mirage_Mail},
+		{"mistyseed"_s, Item::Misty_Seed},
+		{"mixedmushrooms"_s, Item::Mixed_Mushrooms},
+		{"modestmint"_s, Item::Modest_Mint},
+		{"moomoocheese"_s, Item::Moomoo_Cheese},
+		{"moomoomilk"_s, Item::Moomoo_Milk},
+		{"moonball"_s, Item::Moon_Ball},
+		{"moonstone"_s, Item::Moon_Stone},
+		{"morphmail"_s, Item::Morph_Mail},
+		{"mosaicmail"_s, Item::Mosaic_Mail},
+		{"muscleband"_s, Item::Muscle_Band},
+		{"musclewing"_s, Item::Muscle_Wing},
+		{"musicmail"_s, Item::Music_Mail},
+		{"mysteryberry"_s, Item::MysteryBerry},
+		{"mysticwater"_s, Item::Mystic_Water},
+		{"naivemint"_s, Item::Naive_Mint},
+		{"nanabberry"_s, Item::Nanab_Berry},
+		{"naughtymint"_s, Item::Naughty_Mint},
+		{"nestball"_s, Item::Nest_Ball},
+		{"netball"_s, Item::Net_Ball},
+		{"nevermeltice"_s, Item::Never_Melt_Ice},
+		{"ninikuberry"_s, Item::Niniku_Berry},
+		{"nomelberry"_s, Item::Nomel_Berry},
+		{"none"_s, Item::None},
+		{"normalbox"_s, Item::Normal_Box},
+		{"normalgem"_s, Item::Normal_Gem},
+		{"normaliumz"_s, Item::Normalium_Z},
+		{"nugget"_s, Item::Nugget},
+		{"nutpeaberry"_s, Item::Nutpea_Berry},
+		{"occaberry"_s, Item::Occa_Berry},
+		{"oddincense"_s, Item::Odd_Incense},
+		{"oddkeystone"_s, Item::Odd_Keystone},
+		{"oldamber"_s, Item::Old_Amber},
+		{"oldgateau"_s, Item::Old_Gateau},
+		{"oranberry"_s, Item::Oran_Berry},
+		{"orangemail"_s, Item::Orange_Mail},
+		{"ovalstone"_s, Item::Oval_Stone},
+		{"packagedcurry"_s, Item::Packaged_Curry},
+		{"packofpotatoes"_s, Item::Pack_of_Potatoes},
+		{"pamtreberry"_s, Item::Pamtre_Berry},
+		{"paralyzeheal"_s, Item::Paralyze_Heal},
+		{"parkball"_s, Item::Park_Ball},
+		{"parlyzheal"_s, Item::Paralyze_Heal},
+		{"passhoberry"_s, Item::Passho_Berry},
+		{"passorb"_s, Item::Pass_Orb},
+		{"pasta"_s, Item::Pasta},
+		{"payapaberry"_s, Item::Payapa_Berry},
+		{"pearl"_s, Item::Pearl},
+		{"pearlstring"_s, Item::Pearl_String},
+		{"pechaberry"_s, Item::Pecha_Berry},
+		{"persimberry"_s, Item::Persim_Berry},
+		{"petayaberry"_s, Item::Petaya_Berry},
+		{"pewtercrunchies"_s, Item::Pewter_Crunchies},
+		{"pidgeotite"_s, Item::Pidgeotite},
+		{"pikaniumz"_s, Item::Pikanium_Z},
+		{"pikashuniumz"_s, Item::Pikashunium_Z},
+		{"pinapberry"_s, Item::Pinap_Berry},
+		{"pinkapricorn"_s, Item::Pink_Apricorn},
+		{"pinkbow"_s, Item::Pink_Bow},
+		{"pinknectar"_s, Item::Pink_Nectar},
+		{"pinkscarf"_s, Item::Pink_Scarf},
+		{"pinsirite"_s, Item::Pinsirite},
+		{"pixieplate"_s, Item::Pixie_Plate},
+		{"plumefossil"_s, Item::Plume_Fossil},
+		{"poisonbarb"_s, Item::Poison_Barb},
+		{"poisongem"_s, Item::Poison_Gem},
+		{"poisoniumz"_s, Item::Poisonium_Z},
+		{"poisonmemory"_s, Item::Poison_Memory},
+		{"pokeball"_s, Item::Poke_Ball},
+		{"pokedoll"_s, Item::Poke_Doll},
+		{"poketoy"_s, Item::Poke_Toy},
+		{"polkadotbow"_s, Item::Polkadot_Bow},
+		{"pomegberry"_s, Item::Pomeg_Berry},
+		{"portraitmail"_s, Item::Portraitmail},
+		{"potion"_s, Item::Potion},
+		{"poweranklet"_s, Item::Power_Anklet},
+		{"powerband"_s, Item::Power_Band},
+		{"powerbelt"_s, Item::Power_Belt},
+		{"powerbracer"_s, Item::Power_Bracer},
+		{"powerherb"_s, Item::Power_Herb},
+		{"powerlens"_s, Item::Power_Lens},
+		{"powerweight"_s, Item::Power_Weight},
+		{"ppmax"_s, Item::PP_Max},
+		{"ppup"_s, Item::PP_Up},
+		{"precookedburger"_s, Item::Precooked_Burger},
+		{"premierball"_s, Item::Premier_Ball},
+		{"prettywing"_s, Item::Pretty_Wing},
+		{"primariumz"_s, Item::Primarium_Z},
+		{"prismscale"_s, Item::Prism_Scale},
+		{"protectivepads"_s, Item::Protective_Pads},
+		{"protector"_s, Item::Protector},
+		{"protein"_s, Item::Protein},
+		{"przcureberry"_s, Item::PRZCureBerry},
+		{"psncureberry"_s, Item::PSNCureBerry},
+		{"psychicgem"_s, Item::Psychic_Gem},
+		{"psychicmemory"_s, Item::Psychic_Memory},
+		{"psychicseed"_s, Item::Psychic_Seed},
+		{"psychiumz"_s, Item::Psychium_Z},
+		{"pumkinberry"_s, Item::Pumkin_Berry},
+		{"pungentroot"_s, Item::Pungent_Root},
+		{"pureincense"_s, Item::Pure_Incense},
+		{"purplenectar"_s, Item::Purple_Nectar},
+		{"qualotberry"_s, Item::Qualot_Berry},
+		{"quickball"_s, Item::Quick_Ball},
+		{"quickclaw"_s, Item::Quick_Claw},
+		{"quickpowder"_s, Item::Quick_Powder},
+		{"quietmint"_s, Item::Quiet_Mint},
+		{"rabutaberry"_s, Item::Rabuta_Berry},
+		{"ragecandybar"_s, Item::Rage_Candy_Bar},
+		{"rarebone"_s, Item::Rare_Bone},
+		{"rarecandy"_s, Item::Rare_Candy},
+		{"rashmint"_s, Item::Rash_Mint},
+		{"rawstberry"_s, Item::Rawst_Berry},
+		{"razorclaw"_s, Item::Razor_Claw},
+		{"razorfang"_s, Item::Razor_Fang},
+		{"razzberry"_s, Item::Razz_Berry},
+		{"reapercloth"_s, Item::Reaper_Cloth},
+		{"redapricorn"_s, Item::Red_Apricorn},
+		{"redcard"_s, Item::Red_Card},
+		{"redflute"_s, Item::Red_Flute},
+		{"redorb"_s, Item::Red_Orb},
+		{"redscarf"_s, Item::Red_Scarf},
+		{"redshard"_s, Item::Red_Shard},
+		{"relaxedmint"_s, Item::Relaxed_Mint},
+		{"relicband"_s, Item::Relic_Band},
+		{"reliccopper"_s, Item::Relic_Copper},
+		{"reliccrown"_s, Item::Relic_Crown},
+		{"relicgold"_s, Item::Relic_Gold},
+		{"relicsilver"_s, Item::Relic_Silver},
+		{"relicstatue"_s, Item::Relic_Statue},
+		{"relicvase"_s, Item::Relic_Vase},
+		{"repeatball"_s, Item::Repeat_Ball},
+		{"repel"_s, Item::Repel},
+		{"replymail"_s, Item::Reply_Mail},
+		{"resistwing"_s, Item::Resist_Wing},
+		{"retromail"_s, Item::Retro_Mail},
+		{"revivalherb"_s, Item::Revival_Herb},
+		{"revive"_s, Item::Revive},
+		{"ribbonsweet"_s, Item::Ribbon_Sweet},
+		{"richmulch"_s, Item::Rich_Mulch},
+		{"rindoberry"_s, Item::Rindo_Berry},
+		{"ringtarget"_s, Item::Ring_Target},
+		{"rockgem"_s, Item::Rock_Gem},
+		{"rockincense"_s, Item::Rock_Incense},
+		{"rockiumz"_s, Item::Rockium_Z},
+		{"rockmemory"_s, Item::Rock_Memory},
+		{"rockyhelmet"_s, Item::Rocky_Helmet},
+		{"roomservice"_s, Item::Room_Service},
+		{"rootfossil"_s, Item::Root_Fossil},
+		{"roseincense"_s, Item::Rose_Incense},
+		{"roseliberry"_s, Item::Roseli_Berry},
+		{"rowapberry"_s, Item::Rowap_Berry},
+		{"rsvpmail"_s, Item::RSVP_Mail},
+		{"rustedshield"_s, Item::Rusted_Shield},
+		{"rustedsword"_s, Item::Rusted_Sword},
+		{"sablenite"_s, Item::Sablenite},
+		{"sachet"_s, Item::Sachet},
+		{"sacredash"_s, Item::Sacred_Ash},
+		{"safariball"_s, Item::Safari_Ball},
+		{"safetygoggles"_s, Item::Safety_Goggles},
+		{"sailfossil"_s, Item::Sail_Fossil},
+		{"salacberry"_s, Item::Salac_Berry},
+		{"saladmix"_s, Item::Salad_Mix},
+		{"salamencite"_s, Item::Salamencite},
+		{"sassymint"_s, Item::Sassy_Mint},
+		{"sausages"_s, Item::Sausages},
+		{"sceptilite"_s, Item::Sceptilite},
+		{"scizorite"_s, Item::Scizorite},
+		{"scopelens"_s, Item::Scope_Lens},
+		{"seaincense"_s, Item::Sea_Incense},
+		{"seriousmint"_s, Item::Serious_Mint},
+		{"shadowmail"_s, Item::Shadow_Mail},
+		{"shaloursable"_s, Item::Shalour_Sable},
+		{"sharpbeak"_s, Item::Sharp_Beak},
+		{"sharpedonite"_s, Item::Sharpedonite},
+		{"shedshell"_s, Item::Shed_Shell},
+		{"shellbell"_s, Item::Shell_Bell},
+		{"shinystone"_s, Item::Shiny_Stone},
+		{"shoalsalt"_s, Item::Shoal_Salt},
+		{"shoalshell"_s, Item::Shoal_Shell},
+		{"shockdrive"_s, Item::Shock_Drive},
+		{"shucaberry"_s, Item::Shuca_Berry},
+		{"silkscarf"_s, Item::Silk_Scarf},
+		{"silverleaf"_s, Item::Silver_Leaf},
+		{"silverpowder"_s, Item::Silver_Powder},
+		{"sitrusberry"_s, Item::Sitrus_Berry},
+		{"skullfossil"_s, Item::Skull_Fossil},
+		{"skyplate"_s, Item::Sky_Plate},
+		{"slowbronite"_s, Item::Slowbronite},
+		{"slowpoketail"_s, Item::Slowpoke_Tail},
+		{"smokeball"_s, Item::Smoke_Ball},
+		{"smokepoketail"_s, Item::Smoke_Poke_Tail},
+		{"smoothrock"_s, Item::Smooth_Rock},
+		{"snorliumz"_s, Item::Snorlium_Z},
+		{"snowball"_s, Item::Snowball},
+		{"snowmail"_s, Item::Snow_Mail},
+		{"sodapop"_s, Item::Soda_Pop},
+		{"softsand"_s, Item::Soft_Sand},
+		{"solganiumz"_s, Item::Solganium_Z},
+		{"soothebell"_s, Item::Soothe_Bell},
+		{"souldew"_s, Item::Soul_Dew},
+		{"spacemail"_s, Item::Space_Mail},
+		{"spelltag"_s, Item::Spell_Tag},
+		{"spelonberry"_s, Item::Spelon_Berry},
+		{"spicemix"_s, Item::Spice_Mix},
+		{"splashplate"_s, Item::Splash_Plate},
+		{"spookyplate"_s, Item::Spooky_Plate},
+		{"sportball"_s, Item::Sport_Ball},
+		{"stablemulch"_s, Item::Stable_Mulch},
+		{"stardust"_s, Item::Stardust},
+		{"starfberry"_s, Item::Starf_Berry},
+		{"starpiece"_s, Item::Star_Piece},
+		{"starsweet"_s, Item::Star_Sweet},
+		{"steelgem"_s, Item::Steel_Gem},
+		{"steeliumz"_s, Item::Steelium_Z},
+		{"steelixite"_s, Item::Steelixite},
+		{"steelmail"_s, Item::Steel_Mail},
+		{"steelmemory"_s, Item::Steel_Memory},
+		{"stick"_s, Item::Stick},
+		{"stickybarb"_s, Item::Sticky_Barb},
+		{"stoneplate"_s, Item::Stone_Plate},
+		{"strangesouvenir"_s, Item::Strange_Souvenir},
+		{"strawberrysweet"_s, Item::Strawberry_Sweet},
+		{"stribberry"_s, Item::Strib_Berry},
+		{"sunstone"_s, Item::Sun_Stone},
+		{"superpotion"_s, Item::Super_Potion},
+		{"superrepel"_s, Item::Super_Repel},
+		{"surfmail"_s, Item::Surf_Mail},
+		{"surprisemulch"_s, Item::Surprise_Mulch},
+		{"swampertite"_s, Item::Swampertite},
+		{"sweetapple"_s, Item::Sweet_Apple},
+		{"sweetheart"_s, Item::Sweet_Heart},
+		{"swiftwing"_s, Item::Swift_Wing},
+		{"tamatoberry"_s, Item::Tamato_Berry},
+		{"tangaberry"_s, Item::Tanga_Berry},
+		{"tapuniumz"_s, Item::Tapunium_Z},
+		{"tartapple"_s, Item::Tart_Apple},
+		{"terrainextender"_s, Item::Terrain_Extender},
+		{"thanksmail"_s, Item::Thanks_Mail},
+		{"thickclub"_s, Item::Thick_Club},
+		{"throatspray"_s, Item::Throat_Spray},
+		{"thunderstone"_s, Item::Thunder_Stone},
+		{"timerball"_s, Item::Timer_Ball},
+		{"timidmint"_s, Item::Timid_Mint},
+		{"tinofbeans"_s, Item::Tin_of_Beans},
+		{"tinymushroom"_s, Item::Tiny_Mushroom},
+		{"tm01"_s, Item::TM01},
+		{"tm02"_s, Item::TM02},
+		{"tm03"_s, Item::TM03},
+		{"tm04"_s, Item::TM04},
+		{"tm05"_s, Item::TM05},
+		{"tm06"_s, Item::TM06},
+		{"tm07"_s, Item::TM07},
+		{"tm08"_s, Item::TM08},
+		{"tm09"_s, Item::TM09},
+		{"tm10"_s, Item::TM10},
+		{"tm11"_s, Item::TM11},
+		{"tm12"_s, Item::TM12},
+		{"tm13"_s, Item::TM13},
+		{"tm14"_s, Item::TM14},
+		{"tm15"_s, Item::TM15},
+		{"tm16"_s, Item::TM16},
+		{"tm17"_s, Item::TM17},
+		{"tm18"_s, Item::TM18},
+		{"tm19"_s, Item::TM19},
+		{"tm20"_s, Item::TM20},
+		{"tm21"_s, Item::TM21},
+		{"tm22"_s, Item::TM22},
+		{"tm23"_s, Item::TM23},
+		{"tm24"_s, Item::TM24},
+		{"tm25"_s, Item::TM25},
+		{"tm26"_s, Item::TM26},
+		{"tm27"_s, Item::TM27},
+		{"tm28"_s, Item::TM28},
+		{"tm29"_s, Item::TM29},
+		{"tm30"_s, Item::TM30},
+		{"tm31"_s, Item::TM31},
+		{"tm32"_s, Item::TM32},
+		{"tm33"_s, Item::TM33},
+		{"tm34"_s, Item::TM34},
+		{"tm35"_s, Item::TM35},
+		{"tm36"_s, Item::TM36},
+		{"tm37"_s, Item::TM37},
+		{"tm38"_s, Item::TM38},
+		{"tm39"_s, Item::TM39},
+		{"tm40"_s, Item::TM40},
+		{"tm41"_s, Item::TM41},
+		{"tm42"_s, Item::TM42},
+		{"tm43"_s, Item::TM43},
+		{"tm44"_s, Item::TM44},
+		{"tm45"_s, Item::TM45},
+		{"tm46"_s, Item::TM46},
+		{"tm47"_s, Item::TM47},
+		{"tm48"_s, Item::TM48},
+		{"tm49"_s, Item::TM49},
+		{"tm50"_s, Item::TM50},
+		{"tm51"_s, Item::TM51},
+		{"tm52"_s, Item::TM52},
+		{"tm53"_s, Item::TM53},
+		{"tm54"_s, Item::TM54},
+		{"tm55"_s, Item::TM55},
+		{"tm56"_s, Item::TM56},
+		{"tm57"_s, Item::TM57},
+		{"tm58"_s, Item::TM58},
+		{"tm59"_s, Item::TM59},
+		{"tm60"_s, Item::TM60},
+		{"tm61"_s, Item::TM61},
+		{"tm62"_s, Item::TM62},
+		{"tm63"_s, Item::TM63},
+		{"tm64"_s, Item::TM64},
+		{"tm65"_s, Item::TM65},
+		{"tm66"_s, Item::TM66},
+		{"tm67"_s, Item::TM67},
+		{"tm68"_s, Item::TM68},
+		{"tm69"_s, Item::TM69},
+		{"tm70"_s, Item::TM70},
+		{"tm71"_s, Item::TM71},
+		{"tm72"_s, Item::TM72},
+		{"tm73"_s, Item::TM73},
+		{"tm74"_s, Item::TM74},
+		{"tm75"_s, Item::TM75},
+		{"tm76"_s, Item::TM76},
+		{"tm77"_s, Item::TM77},
+		{"tm78"_s, Item::TM78},
+		{"tm79"_s, Item::TM79},
+		{"tm80"_s, Item::TM80},
+		{"tm81"_s, Item::TM81},
+		{"tm82"_s, Item::TM82},
+		{"tm83"_s, Item::TM83},
+		{"tm84"_s, Item::TM84},
+		{"tm85"_s, Item::TM85},
+		{"tm86"_s, Item::TM86},
+		{"tm87"_s, Item::TM87},
+		{"tm88"_s, Item::TM88},
+		{"tm89"_s, Item::TM89},
+		{"tm90"_s, Item::TM90},
+		{"tm91"_s, Item::TM91},
+		{"tm92"_s, Item::TM92},
+		{"topoberry"_s, Item::Topo_Berry},
+		{"tougaberry"_s, Item::Touga_Berry},
+		{"toxicorb"_s, Item::Toxic_Orb},
+		{"toxicplate"_s, Item::Toxic_Plate},
+		{"tr00"_s, Item::TR00},
+		{"tr01"_s, Item::TR01},
+		{"tr02"_s, Item::TR02},
+		{"tr03"_s, Item::TR03},
+		{"tr04"_s, Item::TR04},
+		{"tr05"_s, Item::TR05},
+		{"tr06"_s, Item::TR06},
+		{"tr07"_s, Item::TR07},
+		{"tr08"_s, Item::TR08},
+		{"tr09"_s, Item::TR09},
+		{"tr10"_s, Item::TR10},
+		{"tr11"_s, Item::TR11},
+		{"tr12"_s, Item::TR12},
+		{"tr13"_s, Item::TR13},
+		{"tr14"_s, Item::TR14},
+		{"tr15"_s, Item::TR15},
+		{"tr16"_s, Item::TR16},
+		{"tr17"_s, Item::TR17},
+		{"tr18"_s, Item::TR18},
+		{"tr19"_s, Item::TR19},
+		{"tr20"_s, Item::TR20},
+		{"tr21"_s, Item::TR21},
+		{"tr22"_s, Item::TR22},
+		{"tr23"_s, Item::TR23},
+		{"tr24"_s, Item::TR24},
+		{"tr25"_s, Item::TR25},
+		{"tr26"_s, Item::TR26},
+		{"tr27"_s, Item::TR27},
+		{"tr28"_s, Item::TR28},
+		{"tr29"_s, Item::TR29},
+		{"tr30"_s, Item::TR30},
+		{"tr31"_s, Item::TR31},
+		{"tr32"_s, Item::TR32},
+		{"tr33"_s, Item::TR33},
+		{"tr34"_s, Item::TR34},
+		{"tr35"_s, Item::TR35},
+		{"tr36"_s, Item::TR36},
+		{"tr37"_s, Item::TR37},
+		{"tr38"_s, Item::TR38},
+		{"tr39"_s, Item::TR39},
+		{"tr40"_s, Item::TR40},
+		{"tr41"_s, Item::TR41},
+		{"tr42"_s, Item::TR42},
+		{"tr43"_s, Item::TR43},
+		{"tr44"_s, Item::TR44},
+		{"tr45"_s, Item::TR45},
+		{"tr46"_s, Item::TR46},
+		{"tr47"_s, Item::TR47},
+		{"tr48"_s, Item::TR48},
+		{"tr49"_s, Item::TR49},
+		{"tr50"_s, Item::TR50},
+		{"tr51"_s, Item::TR51},
+		{"tr52"_s, Item::TR52},
+		{"tr53"_s, Item::TR53},
+		{"tr54"_s, Item::TR54},
+		{"tr55"_s, Item::TR55},
+		{"tr56"_s, Item::TR56},
+		{"tr57"_s, Item::TR57},
+		{"tr58"_s, Item::TR58},
+		{"tr59"_s, Item::TR59},
+		{"tr60"_s, Item::TR60},
+		{"tr61"_s, Item::TR61},
+		{"tr62"_s, Item::TR62},
+		{"tr63"_s, Item::TR63},
+		{"tr64"_s, Item::TR64},
+		{"tr65"_s, Item::TR65},
+		{"tr66"_s, Item::TR66},
+		{"tr67"_s, Item::TR67},
+		{"tr68"_s, Item::TR68},
+		{"tr69"_s, Item::TR69},
+		{"tr70"_s, Item::TR70},
+		{"tr71"_s, Item::TR71},
+		{"tr72"_s, Item::TR72},
+		{"tr73"_s, Item::TR73},
+		{"tr74"_s, Item::TR74},
+		{"tr75"_s, Item::TR75},
+		{"tr76"_s, Item::TR76},
+		{"tr77"_s, Item::TR77},
+		{"tr78"_s, Item::TR78},
+		{"tr79"_s, Item::TR79},
+		{"tr80"_s, Item::TR80},
+		{"tr81"_s, Item::TR81},
+		{"tr82"_s, Item::TR82},
+		{"tr83"_s, Item::TR83},
+		{"tr84"_s, Item::TR84},
+		{"tr85"_s, Item::TR85},
+		{"tr86"_s, Item::TR86},
+		{"tr87"_s, Item::TR87},
+		{"tr88"_s, Item::TR88},
+		{"tr89"_s, Item::TR89},
+		{"tr90"_s, Item::TR90},
+		{"tr91"_s, Item::TR91},
+		{"tr92"_s, Item::TR92},
+		{"tr93"_s, Item::TR93},
+		{"tr94"_s, Item::TR94},
+		{"tr95"_s, Item::TR95},
+		{"tr96"_s, Item::TR96},
+		{"tr97"_s, Item::TR97},
+		{"tr98"_s, Item::TR98},
+		{"tr99"_s, Item::TR99},
+		{"tropicmail"_s, Item::Tropic_Mail},
+		{"tunnelmail"_s, Item::Tunnel_Mail},
+		{"twistedspoon"_s, Item::Twisted_Spoon},
+		{"tyranitarite"_s, Item::Tyranitarite},
+		{"ultraball"_s, Item::Ultra_Ball},
+		{"ultranecroziumz"_s, Item::Ultranecrozium_Z},
+		{"upgrade"_s, Item::Up_Grade},
+		{"utilityumbrella"_s, Item::Utility_Umbrella},
+		{"venusaurite"_s, Item::Venusaurite},
+		{"wacanberry"_s, Item::Wacan_Berry},
+		{"watergem"_s, Item::Water_Gem},
+		{"wateriumz"_s, Item::Waterium_Z},
+		{"watermemory"_s, Item::Water_Memory},
+		{"waterstone"_s, Item::Water_Stone},
+		{"watmelberry"_s, Item::Watmel_Berry},
+		{"waveincense"_s, Item::Wave_Incense},
+		{"wavemail"_s, Item::Wave_Mail},
+		{"weaknesspolicy"_s, Item::Weakness_Policy},
+		{"wepearberry"_s, Item::Wepear_Berry},
+		{"whippeddream"_s, Item::Whipped_Dream},
+		{"whiteapricorn"_s, Item::White_Apricorn},
+		{"whiteflute"_s, Item::White_Flute},
+		{"whiteherb"_s, Item::White_Herb},
+		{"widelens"_s, Item::Wide_Lens},
+		{"wikiberry"_s, Item::Wiki_Berry},
+		{"wiseglasses"_s, Item::Wise_Glasses},
+		{"woodmail"_s, Item::Wood_Mail},
+		{"xaccuracy"_s, Item::X_Accuracy},
+		{"xattack"_s, Item::X_Attack},
+		{"xdefend"_s, Item::X_Defend},
+		{"xdefense"_s, Item::X_Defense},
+		{"xspatk"_s, Item::X_Sp_Atk},
+		{"xspdef"_s, Item::X_Sp_Def},
+		{"xspecial"_s, Item::X_Special},
+		{"xspeed"_s, Item::X_Speed},
+		{"yacheberry"_s, Item::Yache_Berry},
+		{"yagoberry"_s, Item::Yago_Berry},
+		{"yellowapricorn"_s, Item::Yellow_Apricorn},
+		{"yellowflute"_s, Item::Yellow_Flute},
+		{"yellownectar"_s, Item::Yellow_Nectar},
+		{"yellowscarf"_s, Item::Yellow_Scarf},
+		{"yellowshard"_s, Item::Yellow_Shard},
+		{"zapplate"_s, Item::Zap_Plate},
+		{"zinc"_s, Item::Zinc},
+		{"zoomlens"_s, Item::Zoom_Lens},
+	});
+	// Longer strings are truncated to the length of the longest key
+	auto const result = converter.lookup(containers::take(lowercase_alphanumeric(str), 15_bi));
 	if (!result) {
 		throw InvalidFromStringConversion("Item"_s, str);
 	}
@@ -11,6 +11,8 @@ import tm.string_conversions.lowercase_alphanumeric;
 
 import tm.move.move_name;
 
+import tm.perfect_hash_map;
+
 import bounded;
 import containers;
 import std_module;
@@ -880,906 +882,903 @@ export constexpr auto to_string(MoveName const move) -> containers::string_view
 
 export template<>
 constexpr auto from_string(containers::string_view const str) -> MoveName {
-	static constexpr auto converter = containers::basic_flat_map(
-		containers::assume_sorted_unique,
-		containers::to_array<containers::map_value_type<containers::string_view, MoveName>>({
-			{"10000000voltthunderbolt"_s, MoveName::m10000000_Volt_Thunderbolt},
-			{"absorb"_s, MoveName::Absorb},
-			{"accelerock"_s, MoveName::Accelerock},
-			{"acid"_s, MoveName::Acid},
-			{"acidarmor"_s, MoveName::Acid_Armor},
-			{"aciddownpour"_s, MoveName::Acid_Downpour},
-			{"acidspray"_s, MoveName::Acid_Spray},
-			{"acrobatics"_s, MoveName::Acrobatics},
-			{"acupressure"_s, MoveName::Acupressure},
-			{"aerialace"_s, MoveName::Aerial_Ace},
-			{"aeroblast"_s, MoveName::Aeroblast},
-			{"afteryou"_s, MoveName::After_You},
-			{"agility"_s, MoveName::Agility},
-			{"aircutter"_s, MoveName::Air_Cutter},
-			{"airslash"_s, MoveName::Air_Slash},
-			{"alloutpummeling"_s, MoveName::All_Out_Pummeling},
-			{"allyswitch"_s, MoveName::Ally_Switch},
-			{"amnesia"_s, MoveName::Amnesia},
-			{"anchorshot"_s, MoveName::Anchor_Shot},
-			{"ancientpower"_s, MoveName::Ancient_Power},
-			{"appleacid"_s, MoveName::Apple_Acid},
-			{"aquacutter"_s, MoveName::Aqua_Cutter},
-			{"aquajet"_s, MoveName::Aqua_Jet},
-			{"aquaring"_s, MoveName::Aqua_Ring},
-			{"aquastep"_s, MoveName::Aqua_Step},
-			{"aquatail"_s, MoveName::Aqua_Tail},
-			{"armorcannon"_s, MoveName::Armor_Cannon},
-			{"armthrust"_s, MoveName::Arm_Thrust},
-			{"aromatherapy"_s, MoveName::Aromatherapy},
-			{"aromaticmist"_s, MoveName::Aromatic_Mist},
-			{"assist"_s, MoveName::Assist},
-			{"assurance"_s, MoveName::Assurance},
-			{"astonish"_s, MoveName::Astonish},
-			{"astralbarrage"_s, MoveName::Astral_Barrage},
-			{"attackorder"_s, MoveName::Attack_Order},
-			{"attract"_s, MoveName::Attract},
-			{"aurasphere"_s, MoveName::Aura_Sphere},
-			{"aurawheel"_s, MoveName::Aura_Wheel},
-			{"aurorabeam"_s, MoveName::Aurora_Beam},
-			{"auroraveil"_s, MoveName::Aurora_Veil},
-			{"autotomize"_s, MoveName::Autotomize},
-			{"avalanche"_s, MoveName::Avalanche},
-			{"axekick"_s, MoveName::Axe_Kick},
-			{"babydolleyes"_s, MoveName::Baby_Doll_Eyes},
-			{"banefulbunker"_s, MoveName::Baneful_Bunker},
-			{"barrage"_s, MoveName::Barrage},
-			{"barrier"_s, MoveName::Barrier},
-			{"batonpass"_s, MoveName::Baton_Pass},
-			{"beakblast"_s, MoveName::Beak_Blast},
-			{"beatup"_s, MoveName::Beat_Up},
-			{"behemothbash"_s, MoveName::Behemoth_Bash},
-			{"behemothblade"_s, MoveName::Behemoth_Blade},
-			{"belch"_s, MoveName::Belch},
-			{"bellydrum"_s, MoveName::Belly_Drum},
-			{"bestow"_s, MoveName::Bestow},
-			{"bide"_s, MoveName::Bide},
-			{"bind"_s, MoveName::Bind},
-			{"bite"_s, MoveName::Bite},
-			{"bitterblade"_s, MoveName::Bitter_Blade},
-			{"blackholeeclipse"_s, MoveName::Black_Hole_Eclipse},
-			{"blastburn"_s, MoveName::Blast_Burn},
-			{"blazekick"_s, MoveName::Blaze_Kick},
-			{"blazingtorque"_s, MoveName::Blazing_Torque},
-			{"blizzard"_s, MoveName::Blizzard},
-			{"block"_s, MoveName::Block},
-			{"bloodmoon"_s, MoveName::Blood_Moon},
-			{"bloomdoom"_s, MoveName::Bloom_Doom},
-			{"blueflare"_s, MoveName::Blue_Flare},
-			{"bodypress"_s, MoveName::Body_Press},
-			{"bodyslam"_s, MoveName::Body_Slam},
-			{"boltbeak"_s, MoveName::Bolt_Beak},
-			{"boltstrike"_s, MoveName::Bolt_Strike},
-			{"boneclub"_s, MoveName::Bone_Club},
-			{"bonemerang"_s, MoveName::Bonemerang},
-			{"bonerush"_s, MoveName::Bone_Rush},
-			{"boomburst"_s, MoveName::Boomburst},
-			{"bounce"_s, MoveName::Bounce},
-			{"branchpoke"_s, MoveName::Branch_Poke},
-			{"bravebird"_s, MoveName::Brave_Bird},
-			{"breakingswipe"_s, MoveName::Breaking_Swipe},
-			{"breakneckblitz"_s, MoveName::Breakneck_Blitz},
-			{"brickbreak"_s, MoveName::Brick_Break},
-			{"brine"_s, MoveName::Brine},
-			{"brutalswing"_s, MoveName::Brutal_Swing},
-			{"bubble"_s, MoveName::Bubble},
-			{"bubblebeam"_s, MoveName::Bubble_Beam},
-			{"bugbite"_s, MoveName::Bug_Bite},
-			{"bugbuzz"_s, MoveName::Bug_Buzz},
-			{"bulkup"_s, MoveName::Bulk_Up},
-			{"bulldoze"_s, MoveName::Bulldoze},
-			{"bulletpunch"_s, MoveName::Bullet_Punch},
-			{"bulletseed"_s, MoveName::Bullet_Seed},
-			{"burningjealousy"_s, MoveName::Burning_Jealousy},
-			{"burnup"_s, MoveName::Burn_Up},
-			{"calmmind"_s, MoveName::Calm_Mind},
-			{"camouflage"_s, MoveName::Camouflage},
-			{"captivate"_s, MoveName::Captivate},
-			{"catastropika"_s, MoveName::Catastropika},
-			{"celebrate"_s, MoveName::Celebrate},
-			{"charge"_s, MoveName::Charge},
-			{"chargebeam"_s, MoveName::Charge_Beam},
-			{"charm"_s, MoveName::Charm},
-			{"chatter"_s, MoveName::Chatter},
-			{"chillingwater"_s, MoveName::Chilling_Water},
-			{"chillyreception"_s, MoveName::Chilly_Reception},
-			{"chipaway"_s, MoveName::Chip_Away},
-			{"circlethrow"_s, MoveName::Circle_Throw},
-			{"clamp"_s, MoveName::Clamp},
-			{"clangingscales"_s, MoveName::Clanging_Scales},
-			{"clangoroussoul"_s, MoveName::Clangorous_Soul},
-			{"clangoroussoulblaze"_s, MoveName::Clangorous_Soulblaze},
-			{"clearsmog"_s, MoveName::Clear_Smog},
-			{"closecombat"_s, MoveName::Close_Combat},
-			{"coaching"_s, MoveName::Coaching},
-			{"coil"_s, MoveName::Coil},
-			{"collisioncourse"_s, MoveName::Collision_Course},
-			{"combattorque"_s, MoveName::Combat_Torque},
-			{"cometpunch"_s, MoveName::Comet_Punch},
-			{"comeuppance"_s, MoveName::Comeuppance},
-			{"confide"_s, MoveName::Confide},
-			{"confuseray"_s, MoveName::Confuse_Ray},
-			{"confusion"_s, MoveName::Confusion},
-			{"constrict"_s, MoveName::Constrict},
-			{"continentalcrush"_s, MoveName::Continental_Crush},
-			{"conversion"_s, MoveName::Conversion},
-			{"conversion2"_s, MoveName::Conversion_2},
-			{"copycat"_s, MoveName::Copycat},
-			{"coreenforcer"_s, MoveName::Core_Enforcer},
-			{"corkscrewcrash"_s, MoveName::Corkscrew_Crash},
-			{"corrosivegas"_s, MoveName::Corrosive_Gas},
-			{"cosmicpower"_s, MoveName::Cosmic_Power},
-			{"cottonguard"_s, MoveName::Cotton_Guard},
-			{"cottonspore"_s, MoveName::Cotton_Spore},
-			{"counter"_s, MoveName::Counter},
-			{"courtchange"_s, MoveName::Court_Change},
-			{"covet"_s, MoveName::Covet},
-			{"crabhammer"_s, MoveName::Crabhammer},
-			{"craftyshield"_s, MoveName::Crafty_Shield},
-			{"crosschop"_s, MoveName::Cross_Chop},
-			{"crosspoison"_s, MoveName::Cross_Poison},
-			{"crunch"_s, MoveName::Crunch},
-			{"crushclaw"_s, MoveName::Crush_Claw},
-			{"crushgrip"_s, MoveName::Crush_Grip},
-			{"curse"_s, MoveName::Curse},
-			{"cut"_s, MoveName::Cut},
-			{"darkestlariat"_s, MoveName::Darkest_Lariat},
-			{"darkpulse"_s, MoveName::Dark_Pulse},
-			{"darkvoid"_s, MoveName::Dark_Void},
-			{"dazzlinggleam"_s, MoveName::Dazzling_Gleam},
-			{"decorate"_s, MoveName::Decorate},
-			{"defendorder"_s, MoveName::Defend_Order},
-			{"defensecurl"_s, MoveName::Defense_Curl},
-			{"defog"_s, MoveName::Defog},
-			{"destinybond"_s, MoveName::Destiny_Bond},
-			{"detect"_s, MoveName::Detect},
-			{"devastatingdrake"_s, MoveName::Devastating_Drake},
-			{"diamondstorm"_s, MoveName::Diamond_Storm},
-			{"dig"_s, MoveName::Dig},
-			{"disable"_s, MoveName::Disable},
-			{"disarmingvoice"_s, MoveName::Disarming_Voice},
-			{"discharge"_s, MoveName::Discharge},
-			{"dive"_s, MoveName::Dive},
-			{"dizzypunch"_s, MoveName::Dizzy_Punch},
-			{"doodle"_s, MoveName::Doodle},
-			{"doomdesire"_s, MoveName::Doom_Desire},
-			{"doubleedge"_s, MoveName::Double_Edge},
-			{"doublehit"_s, MoveName::Double_Hit},
-			{"doubleironbash"_s, MoveName::Double_Iron_Bash},
-			{"doublekick"_s, MoveName::Double_Kick},
-			{"doubleshock"_s, MoveName::Double_Shock},
-			{"doubleslap"_s, MoveName::Double_Slap},
-			{"doubleteam"_s, MoveName::Double_Team},
-			{"dracometeor"_s, MoveName::Draco_Meteor},
-			{"dragonascent"_s, MoveName::Dragon_Ascent},
-			{"dragonbreath"_s, MoveName::Dragon_Breath},
-			{"dragonclaw"_s, MoveName::Dragon_Claw},
-			{"dragondance"_s, MoveName::Dragon_Dance},
-			{"dragondarts"_s, MoveName::Dragon_Darts},
-			{"dragonenergy"_s, MoveName::Dragon_Energy},
-			{"dragonhammer"_s, MoveName::Dragon_Hammer},
-			{"dragonpulse"_s, MoveName::Dragon_Pulse},
-			{"dragonrage"_s, MoveName::Dragon_Rage},
-			{"dragonrush"_s, MoveName::Dragon_Rush},
-			{"dragontail"_s, MoveName::Dragon_Tail},
-			{"drainingkiss"_s, MoveName::Draining_Kiss},
-			{"drainpunch"_s, MoveName::Drain_Punch},
-			{"dreameater"_s, MoveName::Dream_Eater},
-			{"drillpeck"_s, MoveName::Drill_Peck},
-			{"drillrun"_s, MoveName::Drill_Run},
-			{"drumbeating"_s, MoveName::Drum_Beating},
-			{"dualchop"_s, MoveName::Dual_Chop},
-			{"dualwingbeat"_s, MoveName::Dual_Wingbeat},
-			{"dynamaxcannon"_s, MoveName::Dynamax_Cannon},
-			{"dynamicpunch"_s, MoveName::Dynamic_Punch},
-			{"earthpower"_s, MoveName::Earth_Power},
-			{"earthquake"_s, MoveName::Earthquake},
-			{"echoedvoice"_s, MoveName::Echoed_Voice},
-			{"eerieimpulse"_s, MoveName::Eerie_Impulse},
-			{"eeriespell"_s, MoveName::Eerie_Spell},
-			{"eggbomb"_s, MoveName::Egg_Bomb},
-			{"electricterrain"_s, MoveName::Electric_Terrain},
-			{"electrify"_s, MoveName::Electrify},
-			{"electroball"_s, MoveName::Electro_Ball},
-			{"electrodrift"_s, MoveName::Electro_Drift},
-			{"electroshot"_s, MoveName::Electro_Shot},
-			{"electroweb"_s, MoveName::Electroweb},
-			{"embargo"_s, MoveName::Embargo},
-			{"ember"_s, MoveName::Ember},
-			{"encore"_s, MoveName::Encore},
-			{"endeavor"_s, MoveName::Endeavor},
-			{"endure"_s, MoveName::Endure},
-			{"energyball"_s, MoveName::Energy_Ball},
-			{"entrainment"_s, MoveName::Entrainment},
-			{"eruption"_s, MoveName::Eruption},
-			{"eternabeam"_s, MoveName::Eternabeam},
-			{"expandingforce"_s, MoveName::Expanding_Force},
-			{"explosion"_s, MoveName::Explosion},
-			{"extrasensory"_s, MoveName::Extrasensory},
-			{"extremeevoboost"_s, MoveName::Extreme_Evoboost},
-			{"extremespeed"_s, MoveName::Extreme_Speed},
-			{"facade"_s, MoveName::Facade},
-			{"faintattack"_s, MoveName::Feint_Attack},
-			{"fairylock"_s, MoveName::Fairy_Lock},
-			{"fairywind"_s, MoveName::Fairy_Wind},
-			{"fakeout"_s, MoveName::Fake_Out},
-			{"faketears"_s, MoveName::Fake_Tears},
-			{"falsesurrender"_s, MoveName::False_Surrender},
-			{"falseswipe"_s, MoveName::False_Swipe},
-			{"featherdance"_s, MoveName::Feather_Dance},
-			{"feint"_s, MoveName::Feint},
-			{"feintattack"_s, MoveName::Feint_Attack},
-			{"fellstinger"_s, MoveName::Fell_Stinger},
-			{"fierydance"_s, MoveName::Fiery_Dance},
-			{"fierywrath"_s, MoveName::Fiery_Wrath},
-			{"filletaway"_s, MoveName::Fillet_Away},
-			{"finalgambit"_s, MoveName::Final_Gambit},
-			{"fireblast"_s, MoveName::Fire_Blast},
-			{"firefang"_s, MoveName::Fire_Fang},
-			{"firelash"_s, MoveName::Fire_Lash},
-			{"firepledge"_s, MoveName::Fire_Pledge},
-			{"firepunch"_s, MoveName::Fire_Punch},
-			{"firespin"_s, MoveName::Fire_Spin},
-			{"firstimpression"_s, MoveName::First_Impression},
-			{"fishiousrend"_s, MoveName::Fishious_Rend},
-			{"fissure"_s, MoveName::Fissure},
-			{"flail"_s, MoveName::Flail},
-			{"flameburst"_s, MoveName::Flame_Burst},
-			{"flamecharge"_s, MoveName::Flame_Charge},
-			{"flamethrower"_s, MoveName::Flamethrower},
-			{"flamewheel"_s, MoveName::Flame_Wheel},
-			{"flareblitz"_s, MoveName::Flare_Blitz},
-			{"flash"_s, MoveName::Flash},
-			{"flashcannon"_s, MoveName::Flash_Cannon},
-			{"flatter"_s, MoveName::Flatter},
-			{"fleurcannon"_s, MoveName::Fleur_Cannon},
-			{"fling"_s, MoveName::Fling},
-			{"flipturn"_s, MoveName::Flip_Turn},
-			{"floralhealing"_s, MoveName::Floral_Healing},
-			{"flowershield"_s, MoveName::Flower_Shield},
-			{"flowertrick"_s, MoveName::Flower_Trick},
-			{"fly"_s, MoveName::Fly},
-			{"flyingpress"_s, MoveName::Flying_Press},
-			{"focusblast"_s, MoveName::Focus_Blast},
-			{"focusenergy"_s, MoveName::Focus_Energy},
-			{"focuspunch"_s, MoveName::Focus_Punch},
-			{"followme"_s, MoveName::Follow_Me},
-			{"forcepalm"_s, MoveName::Force_Palm},
-			{"foresight"_s, MoveName::Foresight},
-			{"forestscurse"_s, MoveName::Forests_Curse},
-			{"foulplay"_s, MoveName::Foul_Play},
-			{"freezedry"_s, MoveName::Freeze_Dry},
-			{"freezeshock"_s, MoveName::Freeze_Shock},
-			{"freezingglare"_s, MoveName::Freezing_Glare},
-			{"frenzyplant"_s, MoveName::Frenzy_Plant},
-			{"frostbreath"_s, MoveName::Frost_Breath},
-			{"frustration"_s, MoveName::Frustration},
-			{"frustrationnull"_s, MoveName::Frustration}, // Pokemon Showdown
-			{"furyattack"_s, MoveName::Fury_Attack},
-			{"furycutter"_s, MoveName::Fury_Cutter},
-			{"furyswipes"_s, MoveName::Fury_Swipes},
-			{"fusionbolt"_s, MoveName::Fusion_Bolt},
-			{"fusionflare"_s, MoveName::Fusion_Flare},
-			{"futuresight"_s, MoveName::Future_Sight},
-			{"gastroacid"_s, MoveName::Gastro_Acid},
-			{"geargrind"_s, MoveName::Gear_Grind},
-			{"gearup"_s, MoveName::Gear_Up},
-			{"genesissupernova"_s, MoveName::Genesis_Supernova},
-			{"geomancy"_s, MoveName::Geomancy},
-			{"gigadrain"_s, MoveName::Giga_Drain},
-			{"gigaimpact"_s, MoveName::Giga_Impact},
-			{"gigatonhammer"_s, MoveName::Gigaton_Hammer},
-			{"gigavolthavoc"_s, MoveName::Gigavolt_Havoc},
-			{"glaciallance"_s, MoveName::Glacial_Lance},
-			{"glaciate"_s, MoveName::Glaciate},
-			{"glaiverush"_s, MoveName::Glaive_Rush},
-			{"glare"_s, MoveName::Glare},
-			{"grassknot"_s, MoveName::Grass_Knot},
-			{"grasspledge"_s, MoveName::Grass_Pledge},
-			{"grasswhistle"_s, MoveName::Grass_Whistle},
-			{"grassyglide"_s, MoveName::Grassy_Glide},
-			{"grassyterrain"_s, MoveName::Grassy_Terrain},
-			{"gravapple"_s, MoveName::Grav_Apple},
-			{"gravity"_s, MoveName::Gravity},
-			{"growl"_s, MoveName::Growl},
-			{"growth"_s, MoveName::Growth},
-			{"grudge"_s, MoveName::Grudge},
-			{"guardianofalola"_s, MoveName::Guardian_of_Alola},
-			{"guardsplit"_s, MoveName::Guard_Split},
-			{"guardswap"_s, MoveName::Guard_Swap},
-			{"guillotine"_s, MoveName::Guillotine},
-			{"gunkshot"_s, MoveName::Gunk_Shot},
-			{"gust"_s, MoveName::Gust},
-			{"gyroball"_s, MoveName::Gyro_Ball},
-			{"hail"_s, MoveName::Hail},
-			{"hammerarm"_s, MoveName::Hammer_Arm},
-			{"happyhour"_s, MoveName::Happy_Hour},
-			{"harden"_s, MoveName::Harden},
-			{"haze"_s, MoveName::Haze},
-			{"headbutt"_s, MoveName::Headbutt},
-			{"headcharge"_s, MoveName::Head_Charge},
-			{"headsmash"_s, MoveName::Head_Smash},
-			{"healbell"_s, MoveName::Heal_Bell},
-			{"healblock"_s, MoveName::Heal_Block},
-			{"healingwish"_s, MoveName::Healing_Wish},
-			{"healorder"_s, MoveName::Heal_Order},
-			{"healpulse"_s, MoveName::Heal_Pulse},
-			{"heartstamp"_s, MoveName::Heart_Stamp},
-			{"heartswap"_s, MoveName::Heart_Swap},
-			{"heatcrash"_s, MoveName::Heat_Crash},
-			{"heatwave"_s, MoveName::Heat_Wave},
-			{"heavyslam"_s, MoveName::Heavy_Slam},
-			{"helpinghand"_s, MoveName::Helping_Hand},
-			{"hex"_s, MoveName::Hex},
-			{"hiddenpower"_s, MoveName::Hidden_Power},
-			{"hiddenpowerbug"_s, MoveName::Hidden_Power},
-			{"hiddenpowerdark"_s, MoveName::Hidden_Power},
-			{"hiddenpowerdragon"_s, MoveName::Hidden_Power},
-			{"hiddenpowerelectric"_s, MoveName::Hidden_Power},
-			{"hiddenpowerfighting"_s, MoveName::Hidden_Power},
-			{"hiddenpowerfire"_s, MoveName::Hidden_Power},
-			{"hiddenpowerflying"_s, MoveName::Hidden_Power},
-			{"hiddenpowerghost"_s, MoveName::Hidden_Power},
-			{"hiddenpowergrass"_s, MoveName::Hidden_Power},
-			{"hiddenpowerground"_s, MoveName::Hidden_Power},
-			{"hiddenpowerice"_s, MoveName::Hidden_Power},
-			{"hiddenpowerpoison"_s, MoveName::Hidden_Power},
-			{"hiddenpowerpsychic"_s, MoveName::Hidden_Power},
-			{"hiddenpowerrock"_s, MoveName::Hidden_Power},
-			{"hiddenpowersteel"_s, MoveName::Hidden_Power},
-			{"hiddenpowerwater"_s, MoveName::Hidden_Power},
-			{"highhorsepower"_s, MoveName::High_Horsepower},
-			{"highjumpkick"_s, MoveName::High_Jump_Kick},
-			{"hijumpkick"_s, MoveName::High_Jump_Kick},
-			{"holdback"_s, MoveName::Hold_Back},
-			{"holdhands"_s, MoveName::Hold_Hands},
-			{"honeclaws"_s, MoveName::Hone_Claws},
-			{"hornattack"_s, MoveName::Horn_Attack},
-			{"horndrill"_s, MoveName::Horn_Drill},
-			{"hornleech"_s, MoveName::Horn_Leech},
-			{"howl"_s, MoveName::Howl},
-			{"hpbug"_s, MoveName::Hidden_Power},
-			{"hpdark"_s, MoveName::Hidden_Power},
-			{"hpdragon"_s, MoveName::Hidden_Power},
-			{"hpelectric"_s, MoveName::Hidden_Power},
-			{"hpfighting"_s, MoveName::Hidden_Power},
-			{"hpfire"_s, MoveName::Hidden_Power},
-			{"hpflying"_s, MoveName::Hidden_Power},
-			{"hpghost"_s, MoveName::Hidden_Power},
-			{"hpgrass"_s, MoveName::Hidden_Power},
-			{"hpground"_s, MoveName::Hidden_Power},
-			{"hpice"_s, MoveName::Hidden_Power},
-			{"hppoison"_s, MoveName::Hidden_Power},
-			{"hppsychic"_s, MoveName::Hidden_Power},
-			{"hprock"_s, MoveName::Hidden_Power},
-			{"hpsteel"_s, MoveName::Hidden_Power},
-			{"hpwater"_s, MoveName::Hidden_Power},
-			{"hurricane"_s, MoveName::Hurricane},
-			{"hydrocannon"_s, MoveName::Hydro_Cannon},
-			{"hydropump"_s, MoveName::Hydro_Pump},
-			{"hydrosteam"_s, MoveName::Hydro_Steam},
-			{"hydrovortex"_s, MoveName::Hydro_Vortex},
-			{"hyperbeam"_s, MoveName::Hyper_Beam},
-			{"hyperdrill"_s, MoveName::Hyper_Drill},
-			{"hyperfang"_s, MoveName::Hyper_Fang},
-			{"hyperspacefury"_s, MoveName::Hyperspace_Fury},
-			{"hyperspacehole"_s, MoveName::Hyperspace_Hole},
-			{"hypervoice"_s, MoveName::Hyper_Voice},
-			{"hypnosis"_s, MoveName::Hypnosis},
-			{"iceball"_s, MoveName::Ice_Ball},
-			{"icebeam"_s, MoveName::Ice_Beam},
-			{"iceburn"_s, MoveName::Ice_Burn},
-			{"icefang"_s, MoveName::Ice_Fang},
-			{"icehammer"_s, MoveName::Ice_Hammer},
-			{"icepunch"_s, MoveName::Ice_Punch},
-			{"iceshard"_s, MoveName::Ice_Shard},
-			{"icespinner"_s, MoveName::Ice_Spinner},
-			{"iciclecrash"_s, MoveName::Icicle_Crash},
-			{"iciclespear"_s, MoveName::Icicle_Spear},
-			{"icywind"_s, MoveName::Icy_Wind},
-			{"imprison"_s, MoveName::Imprison},
-			{"incinerate"_s, MoveName::Incinerate},
-			{"inferno"_s, MoveName::Inferno},
-			{"infernooverdrive"_s, MoveName::Inferno_Overdrive},
-			{"infestation"_s, MoveName::Infestation},
-			{"ingrain"_s, MoveName::Ingrain},
-			{"instruct"_s, MoveName::Instruct},
-			{"iondeluge"_s, MoveName::Ion_Deluge},
-			{"irondefense"_s, MoveName::Iron_Defense},
-			{"ironhead"_s, MoveName::Iron_Head},
-			{"irontail"_s, MoveName::Iron_Tail},
-			{"ivycudgel"_s, MoveName::Ivy_Cudgel},
-			{"jawlock"_s, MoveName::Jaw_Lock},
-			{"jetpunch"_s, MoveName::Jet_Punch},
-			{"judgment"_s, MoveName::Judgment},
-			{"jumpkick"_s, MoveName::Jump_Kick},
-			{"junglehealing"_s, MoveName::Jungle_Healing},
-			{"karatechop"_s, MoveName::Karate_Chop},
-			{"kinesis"_s, MoveName::Kinesis},
-			{"kingsshield"_s, MoveName::Kings_Shield},
-			{"knockoff"_s, MoveName::Knock_Off},
-			{"kowtowcleave"_s, MoveName::Kowtow_Cleave},
-			{"landswrath"_s, MoveName::Lands_Wrath},
-			{"laserfocus"_s, MoveName::Laser_Focus},
-			{"lashout"_s, MoveName::Lash_Out},
-			{"lastresort"_s, MoveName::Last_Resort},
-			{"lastrespects"_s, MoveName::Last_Respects},
-			{"lavaplume"_s, MoveName::Lava_Plume},
-			{"leafage"_s, MoveName::Leafage},
-			{"leafblade"_s, MoveName::Leaf_Blade},
-			{"leafstorm"_s, MoveName::Leaf_Storm},
-			{"leaftornado"_s, MoveName::Leaf_Tornado},
-			{"leechlife"_s, MoveName::Leech_Life},
-			{"leechseed"_s, MoveName::Leech_Seed},
-			{"leer"_s, MoveName::Leer},
-			{"letssnuggleforever"_s, MoveName::Lets_Snuggle_Forever},
-			{"lick"_s, MoveName::Lick},
-			{"lifedew"_s, MoveName::Life_Dew},
-			{"lightofruin"_s, MoveName::Light_of_Ruin},
-			{"lightscreen"_s, MoveName::Light_Screen},
-			{"lightthatburnsthesky"_s, MoveName::Light_That_Burns_the_Sky},
-			{"liquidation"_s, MoveName::Liquidation},
-			{"lockon"_s, MoveName::Lock_On},
-			{"lovelykiss"_s, MoveName::Lovely_Kiss},
-			{"lowkick"_s, MoveName::Low_Kick},
-			{"lowsweep"_s, MoveName::Low_Sweep},
-			{"luckychant"_s, MoveName::Lucky_Chant},
-			{"luminacrash"_s, MoveName::Lumina_Crash},
-			{"lunardance"_s, MoveName::Lunar_Dance},
-			{"lunge"_s, MoveName::Lunge},
-			{"lusterpurge"_s, MoveName::Luster_Purge},
-			{"machpunch"_s, MoveName::Mach_Punch},
-			{"magicalleaf"_s, MoveName::Magical_Leaf},
-			{"magicaltorque"_s, MoveName::Magical_Torque},
-			{"magiccoat"_s, MoveName::Magic_Coat},
-			{"magicpowder"_s, MoveName::Magic_Powder},
-			{"magicroom"_s, MoveName::Magic_Room},
-			{"magmastorm"_s, MoveName::Magma_Storm},
-			{"magnetbomb"_s, MoveName::Magnet_Bomb},
-			{"magneticflux"_s, MoveName::Magnetic_Flux},
-			{"magnetrise"_s, MoveName::Magnet_Rise},
-			{"magnitude"_s, MoveName::Magnitude},
-			{"makeitrain"_s, MoveName::Make_It_Rain},
-			{"maliciousmoonsault"_s, MoveName::Malicious_Moonsault},
-			{"matblock"_s, MoveName::Mat_Block},
-			{"matchagotcha"_s, MoveName::Matcha_Gotcha},
-			{"maxairstream"_s, MoveName::Max_Airstream},
-			{"maxdarkness"_s, MoveName::Max_Darkness},
-			{"maxflare"_s, MoveName::Max_Flare},
-			{"maxflutterby"_s, MoveName::Max_Flutterby},
-			{"maxgeyser"_s, MoveName::Max_Geyser},
-			{"maxguard"_s, MoveName::Max_Guard},
-			{"maxhailstorm"_s, MoveName::Max_Hailstorm},
-			{"maxknuckle"_s, MoveName::Max_Knuckle},
-			{"maxlightning"_s, MoveName::Max_Lightning},
-			{"maxmindstorm"_s, MoveName::Max_Mindstorm},
-			{"maxooze"_s, MoveName::Max_Ooze},
-			{"maxovergrowth"_s, MoveName::Max_Overgrowth},
-			{"maxphantasm"_s, MoveName::Max_Phantasm},
-			{"maxquake"_s, MoveName::Max_Quake},
-			{"maxrockfall"_s, MoveName::Max_Rockfall},
-			{"maxstarfall"_s, MoveName::Max_Starfall},
-			{"maxsteelspike"_s, MoveName::Max_Steelspike},
-			{"maxstrike"_s, MoveName::Max_Strike},
-			{"maxwyrmwind"_s, MoveName::Max_Wyrmwind},
-			{"meanlook"_s, MoveName::Mean_Look},
-			{"meditate"_s, MoveName::Meditate},
-			{"mefirst"_s, MoveName::Me_First},
-			{"megadrain"_s, MoveName::Mega_Drain},
-			{"megahorn"_s, MoveName::Megahorn},
-			{"megakick"_s, MoveName::Mega_Kick},
-			{"megapunch"_s, MoveName::Mega_Punch},
-			{"memento"_s, MoveName::Memento},
-			{"menacingmoonrazemaelstrom"_s, MoveName::Menacing_Moonraze_Maelstrom},
-			{"metalburst"_s, MoveName::Metal_Burst},
-			{"metalclaw"_s, MoveName::Metal_Claw},
-			{"metalsound"_s, MoveName::Metal_Sound},
-			{"meteorassault"_s, MoveName::Meteor_Assault},
-			{"meteorbeam"_s, MoveName::Meteor_Beam},
-			{"meteormash"_s, MoveName::Meteor_Mash},
-			{"metronome"_s, MoveName::Metronome},
-			{"milkdrink"_s, MoveName::Milk_Drink},
-			{"mimic"_s, MoveName::Mimic},
-			{"mindblown"_s, MoveName::Mind_Blown},
-			{"mindreader"_s, MoveName::Mind_Reader},
-			{"minimize"_s, MoveName::Minimize},
-			{"miracleeye"_s, MoveName::Miracle_Eye},
-			{"mirrorcoat"_s, MoveName::Mirror_Coat},
-			{"mirrormove"_s, MoveName::Mirror_Move},
-			{"mirrorshot"_s, MoveName::Mirror_Shot},
-			{"mist"_s, MoveName::Mist},
-			{"mistball"_s, MoveName::Mist_Ball},
-			{"mistyexplosion"_s, MoveName::Misty_Explosion},
-			{"mistyterrain"_s, MoveName::Misty_Terrain},
-			{"moonblast"_s, MoveName::Moonblast},
-			{"moongeistbeam"_s, MoveName::Moongeist_Beam},
-			{"moonlight"_s, MoveName::Moonlight},
-			{"morningsun"_s, MoveName::Morning_Sun},
-			{"mortalspin"_s, MoveName::Mortal_Spin},
-			{"mudbomb"_s, MoveName::Mud_Bomb},
-			{"muddywater"_s, MoveName::Muddy_Water},
-			{"mudshot"_s, MoveName::Mud_Shot},
-			{"mudslap"_s, MoveName::Mud_Slap},
-			{"mudsport"_s, MoveName::Mud_Sport},
-			{"multiattack"_s, MoveName::Multi_Attack},
-			{"mysticalfire"_s, MoveName::Mystical_Fire},
-			{"nastyplot"_s, MoveName::Nasty_Plot},
-			{"naturalgift"_s, MoveName::Natural_Gift},
-			{"naturepower"_s, MoveName::Nature_Power},
-			{"naturesmadness"_s, MoveName::Natures_Madness},
-			{"needlearm"_s, MoveName::Needle_Arm},
-			{"neverendingnightmare"_s, MoveName::Never_Ending_Nightmare},
-			{"nightdaze"_s, MoveName::Night_Daze},
-			{"nightmare"_s, MoveName::Nightmare},
-			{"nightshade"_s, MoveName::Night_Shade},
-			{"nightslash"_s, MoveName::Night_Slash},
-			{"nobleroar"_s, MoveName::Noble_Roar},
-			{"noretreat"_s, MoveName::No_Retreat},
-			{"noxioustorque"_s, MoveName::Noxious_Torque},
-			{"nuzzle"_s, MoveName::Nuzzle},
-			{"oblivionwing"_s, MoveName::Oblivion_Wing},
-			{"obstruct"_s, MoveName::Obstruct},
-			{"oceanicoperetta"_s, MoveName::Oceanic_Operetta},
-			{"octazooka"_s, MoveName::Octazooka},
-			{"octolock"_s, MoveName::Octolock},
-			{"odorsleuth"_s, MoveName::Odor_Sleuth},
-			{"ominouswind"_s, MoveName::Ominous_Wind},
-			{"orderup"_s, MoveName::Order_Up},
-			{"originpulse"_s, MoveName::Origin_Pulse},
-			{"outrage"_s, MoveName::Outrage},
-			{"overdrive"_s, MoveName::Overdrive},
-			{"overheat"_s, MoveName::Overheat},
-			{"painsplit"_s, MoveName::Pain_Split},
-			{"paraboliccharge"_s, MoveName::Parabolic_Charge},
-			{"partingshot"_s, MoveName::Parting_Shot},
-			{"payback"_s, MoveName::Payback},
-			{"payday"_s, MoveName::Pay_Day},
-			{"peck"_s, MoveName::Peck},
-			{"perishsong"_s, MoveName::Perish_Song},
-			{"petalblizzard"_s, MoveName::Petal_Blizzard},
-			{"petaldance"_s, MoveName::Petal_Dance},
-			{"phantomforce"_s, MoveName::Phantom_Force},
-			{"photongeyser"_s, MoveName::Photon_Geyser},
-			{"pinmissile"_s, MoveName::Pin_Missile},
-			{"plasmafists"_s, MoveName::Plasma_Fists},
-			{"playnice"_s, MoveName::Play_Nice},
-			{"playrough"_s, MoveName::Play_Rough},
-			{"pluck"_s, MoveName::Pluck},
-			{"poisonfang"_s, MoveName::Poison_Fang},
-			{"poisongas"_s, MoveName::Poison_Gas},
-			{"poisonjab"_s, MoveName::Poison_Jab},
-			{"poisonpowder"_s, MoveName::Poison_Powder},
-			{"poisonsting"_s, MoveName::Poison_Sting},
-			{"poisontail"_s, MoveName::Poison_Tail},
-			{"pollenpuff"_s, MoveName::Pollen_Puff},
-			{"poltergeist"_s, MoveName::Poltergeist},
-			{"populationbomb"_s, MoveName::Population_Bomb},
-			{"pounce"_s, MoveName::Pounce},
-			{"pound"_s, MoveName::Pound},
-			{"powder"_s, MoveName::Powder},
-			{"powdersnow"_s, MoveName::Powder_Snow},
-			{"powergem"_s, MoveName::Power_Gem},
-			{"powersplit"_s, MoveName::Power_Split},
-			{"powerswap"_s, MoveName::Power_Swap},
-			{"powertrick"_s, MoveName::Power_Trick},
-			{"powertrip"_s, MoveName::Power_Trip},
-			{"poweruppunch"_s, MoveName::Power_Up_Punch},
-			{"powerwhip"_s, MoveName::Power_Whip},
-			{"precipiceblades"_s, MoveName::Precipice_Blades},
-			{"present"_s, MoveName::Present},
-			{"prismaticlaser"_s, MoveName::Prismatic_Laser},
-			{"protect"_s, MoveName::Protect},
-			{"psybeam"_s, MoveName::Psybeam},
-			{"psyblade"_s, MoveName::Psyblade},
-			{"psychic"_s, MoveName::Psychic},
-			{"psychicfangs"_s, MoveName::Psychic_Fangs},
-			{"psychicnoise"_s, MoveName::Psychic_Noise},
-			{"psychicterrain"_s, MoveName::Psychic_Terrain},
-			{"psychoboost"_s, MoveName::Psycho_Boost},
-			{"psychocut"_s, MoveName::Psycho_Cut},
-			{"psychoshift"_s, MoveName::Psycho_Shift},
-			{"psychup"_s, MoveName::Psych_Up},
-			{"psyshock"_s, MoveName::Psyshock},
-			{"psystrike"_s, MoveName::Psystrike},
-			{"psywave"_s, MoveName::Psywave},
-			{"pulverizingpancake"_s, MoveName::Pulverizing_Pancake},
-			{"punishment"_s, MoveName::Punishment},
-			{"purify"_s, MoveName::Purify},
-			{"pursuit"_s, MoveName::Pursuit},
-			{"pyroball"_s, MoveName::Pyro_Ball},
-			{"quash"_s, MoveName::Quash},
-			{"quickattack"_s, MoveName::Quick_Attack},
-			{"quickguard"_s, MoveName::Quick_Guard},
-			{"quiverdance"_s, MoveName::Quiver_Dance},
-			{"rage"_s, MoveName::Rage},
-			{"ragefist"_s, MoveName::Rage_Fist},
-			{"ragepowder"_s, MoveName::Rage_Powder},
-			{"ragingbull"_s, MoveName::Raging_Bull},
-			{"raindance"_s, MoveName::Rain_Dance},
-			{"rapidspin"_s, MoveName::Rapid_Spin},
-			{"razorleaf"_s, MoveName::Razor_Leaf},
-			{"razorshell"_s, MoveName::Razor_Shell},
-			{"razorwind"_s, MoveName::Razor_Wind},
-			{"recharge"_s, MoveName::Hyper_Beam}, // TODO: fix
-			{"recover"_s, MoveName::Recover},
-			{"recycle"_s, MoveName::Recycle},
-			{"reflect"_s, MoveName::Reflect},
-			{"reflecttype"_s, MoveName::Reflect_Type},
-			{"refresh"_s, MoveName::Refresh},
-			{"relicsong"_s, MoveName::Relic_Song},
-			{"rest"_s, MoveName::Rest},
-			{"retaliate"_s, MoveName::Retaliate},
-			{"return"_s, MoveName::Return},
-			{"return102"_s, MoveName::Return},
-			{"revelationdance"_s, MoveName::Revelation_Dance},
-			{"revenge"_s, MoveName::Revenge},
-			{"reversal"_s, MoveName::Reversal},
-			{"revivalblessing"_s, MoveName::Revival_Blessing},
-			{"risingvoltage"_s, MoveName::Rising_Voltage},
-			{"roar"_s, MoveName::Roar},
-			{"roaroftime"_s, MoveName::Roar_of_Time},
-			{"rockblast"_s, MoveName::Rock_Blast},
-			{"rockclimb"_s, MoveName::Rock_Climb},
-			{"rockpolish"_s, MoveName::Rock_Polish},
-			{"rockslide"_s, MoveName::Rock_Slide},
-			{"rocksmash"_s, MoveName::Rock_Smash},
-			{"rockthrow"_s, MoveName::Rock_Throw},
-			{"rocktomb"_s, MoveName::Rock_Tomb},
-			{"rockwrecker"_s, MoveName::Rock_Wrecker},
-			{"roleplay"_s, MoveName::Role_Play},
-			{"rollingkick"_s, MoveName::Rolling_Kick},
-			{"rollout"_s, MoveName::Rollout},
-			{"roost"_s, MoveName::Roost},
-			{"rototiller"_s, MoveName::Rototiller},
-			{"round"_s, MoveName::Round},
-			{"ruination"_s, MoveName::Ruination},
-			{"sacredfire"_s, MoveName::Sacred_Fire},
-			{"sacredsword"_s, MoveName::Sacred_Sword},
-			{"safeguard"_s, MoveName::Safeguard},
-			{"saltcure"_s, MoveName::Salt_Cure},
-			{"sandattack"_s, MoveName::Sand_Attack},
-			{"sandstorm"_s, MoveName::Sandstorm},
-			{"sandtomb"_s, MoveName::Sand_Tomb},
-			{"savagespinout"_s, MoveName::Savage_Spin_Out},
-			{"scald"_s, MoveName::Scald},
-			{"scaleshot"_s, MoveName::Scale_Shot},
-			{"scaryface"_s, MoveName::Scary_Face},
-			{"scorchingsands"_s, MoveName::Scorching_Sands},
-			{"scratch"_s, MoveName::Scratch},
-			{"screech"_s, MoveName::Screech},
-			{"searingshot"_s, MoveName::Searing_Shot},
-			{"searingsunrazesmash"_s, MoveName::Searing_Sunraze_Smash},
-			{"secretpower"_s, MoveName::Secret_Power},
-			{"secretsword"_s, MoveName::Secret_Sword},
-			{"seedbomb"_s, MoveName::Seed_Bomb},
-			{"seedflare"_s, MoveName::Seed_Flare},
-			{"seismictoss"_s, MoveName::Seismic_Toss},
-			{"selfdestruct"_s, MoveName::Self_Destruct},
-			{"shadowball"_s, MoveName::Shadow_Ball},
-			{"shadowbone"_s, MoveName::Shadow_Bone},
-			{"shadowclaw"_s, MoveName::Shadow_Claw},
-			{"shadowforce"_s, MoveName::Shadow_Force},
-			{"shadowpunch"_s, MoveName::Shadow_Punch},
-			{"shadowsneak"_s, MoveName::Shadow_Sneak},
-			{"sharpen"_s, MoveName::Sharpen},
-			{"shatteredpsyche"_s, MoveName::Shattered_Psyche},
-			{"shedtail"_s, MoveName::Shed_Tail},
-			{"sheercold"_s, MoveName::Sheer_Cold},
-			{"shellsidearm"_s, MoveName::Shell_Side_Arm},
-			{"shellsmash"_s, MoveName::Shell_Smash},
-			{"shelltrap"_s, MoveName::Shell_Trap},
-			{"shiftgear"_s, MoveName::Shift_Gear},
-			{"shockwave"_s, MoveName::Shock_Wave},
-			{"shoreup"_s, MoveName::Shore_Up},
-			{"signalbeam"_s, MoveName::Signal_Beam},
-			{"silktrap"_s, MoveName::Silk_Trap},
-			{"silverwind"_s, MoveName::Silver_Wind},
-			{"simplebeam"_s, MoveName::Simple_Beam},
-			{"sing"_s, MoveName::Sing},
-			{"sinisterarrowraid"_s, MoveName::Sinister_Arrow_Raid},
-			{"sketch"_s, MoveName::Sketch},
-			{"skillswap"_s, MoveName::Skill_Swap},
-			{"skittersmack"_s, MoveName::Skitter_Smack},
-			{"skullbash"_s, MoveName::Skull_Bash},
-			{"skyattack"_s, MoveName::Sky_Attack},
-			{"skydrop"_s, MoveName::Sky_Drop},
-			{"skyuppercut"_s, MoveName::Sky_Uppercut},
-			{"slackoff"_s, MoveName::Slack_Off},
-			{"slam"_s, MoveName::Slam},
-			{"slash"_s, MoveName::Slash},
-			{"sleeppowder"_s, MoveName::Sleep_Powder},
-			{"sleeptalk"_s, MoveName::Sleep_Talk},
-			{"sludge"_s, MoveName::Sludge},
-			{"sludgebomb"_s, MoveName::Sludge_Bomb},
-			{"sludgewave"_s, MoveName::Sludge_Wave},
-			{"smackdown"_s, MoveName::Smack_Down},
-			{"smartstrike"_s, MoveName::Smart_Strike},
-			{"smellingsalt"_s, MoveName::Smelling_Salts},
-			{"smellingsalts"_s, MoveName::Smelling_Salts},
-			{"smog"_s, MoveName::Smog},
-			{"smokescreen"_s, MoveName::Smokescreen},
-			{"snaptrap"_s, MoveName::Snap_Trap},
-			{"snarl"_s, MoveName::Snarl},
-			{"snatch"_s, MoveName::Snatch},
-			{"snipeshot"_s, MoveName::Snipe_Shot},
-			{"snore"_s, MoveName::Snore},
-			{"snowscape"_s, MoveName::Snowscape},
-			{"soak"_s, MoveName::Soak},
-			{"softboiled"_s, MoveName::Soft_Boiled},
-			{"solarbeam"_s, MoveName::Solar_Beam},
-			{"solarblade"_s, MoveName::Solar_Blade},
-			{"sonicboom"_s, MoveName::Sonic_Boom},
-			{"soulstealing7starstrike"_s, MoveName::Soul_Stealing_7_Star_Strike},
-			{"spacialrend"_s, MoveName::Spacial_Rend},
-			{"spark"_s, MoveName::Spark},
-			{"sparklingaria"_s, MoveName::Sparkling_Aria},
-			{"spectralthief"_s, MoveName::Spectral_Thief},
-			{"speedswap"_s, MoveName::Speed_Swap},
-			{"spicyextract"_s, MoveName::Spicy_Extract},
-			{"spiderweb"_s, MoveName::Spider_Web},
-			{"spikecannon"_s, MoveName::Spike_Cannon},
-			{"spikes"_s, MoveName::Spikes},
-			{"spikyshield"_s, MoveName::Spiky_Shield},
-			{"spinout"_s, MoveName::Spin_Out},
-			{"spiritbreak"_s, MoveName::Spirit_Break},
-			{"spiritshackle"_s, MoveName::Spirit_Shackle},
-			{"spite"_s, MoveName::Spite},
-			{"spitup"_s, MoveName::Spit_Up},
-			{"splash"_s, MoveName::Splash},
-			{"splinteredstormshards"_s, MoveName::Splintered_Stormshards},
-			{"spore"_s, MoveName::Spore},
-			{"spotlight"_s, MoveName::Spotlight},
-			{"stealthrock"_s, MoveName::Stealth_Rock},
-			{"steameruption"_s, MoveName::Steam_Eruption},
-			{"steamroller"_s, MoveName::Steamroller},
-			{"steelbeam"_s, MoveName::Steel_Beam},
-			{"steelroller"_s, MoveName::Steel_Roller},
-			{"steelwing"_s, MoveName::Steel_Wing},
-			{"stickyweb"_s, MoveName::Sticky_Web},
-			{"stockpile"_s, MoveName::Stockpile},
-			{"stokedsparksurfer"_s, MoveName::Stoked_Sparksurfer},
-			{"stomp"_s, MoveName::Stomp},
-			{"stompingtantrum"_s, MoveName::Stomping_Tantrum},
-			{"stoneedge"_s, MoveName::Stone_Edge},
-			{"storedpower"_s, MoveName::Stored_Power},
-			{"stormthrow"_s, MoveName::Storm_Throw},
-			{"strangesteam"_s, MoveName::Strange_Steam},
-			{"strength"_s, MoveName::Strength},
-			{"strengthsap"_s, MoveName::Strength_Sap},
-			{"stringshot"_s, MoveName::String_Shot},
-			{"struggle"_s, MoveName::Struggle},
-			{"strugglebug"_s, MoveName::Struggle_Bug},
-			{"stuffcheeks"_s, MoveName::Stuff_Cheeks},
-			{"stunspore"_s, MoveName::Stun_Spore},
-			{"submission"_s, MoveName::Submission},
-			{"substitute"_s, MoveName::Substitute},
-			{"subzeroslammer"_s, MoveName::Subzero_Slammer},
-			{"suckerpunch"_s, MoveName::Sucker_Punch},
-			{"sunnyday"_s, MoveName::Sunny_Day},
-			{"sunsteelstrike"_s, MoveName::Sunsteel_Strike},
-			{"superfang"_s, MoveName::Super_Fang},
-			{"superpower"_s, MoveName::Superpower},
-			{"supersonic"_s, MoveName::Supersonic},
-			{"supersonicskystrike"_s, MoveName::Supersonic_Skystrike},
-			{"surf"_s, MoveName::Surf},
-			{"surgingstrikes"_s, MoveName::Surging_Strikes},
-			{"swagger"_s, MoveName::Swagger},
-			{"swallow"_s, MoveName::Swallow},
-			{"sweetkiss"_s, MoveName::Sweet_Kiss},
-			{"sweetscent"_s, MoveName::Sweet_Scent},
-			{"swift"_s, MoveName::Swift},
-			{"switcheroo"_s, MoveName::Switcheroo},
-			{"swordsdance"_s, MoveName::Swords_Dance},
-			{"synchronoise"_s, MoveName::Synchronoise},
-			{"synthesis"_s, MoveName::Synthesis},
-			{"syrupbomb"_s, MoveName::Syrup_Bomb},
-			{"tachyoncutter"_s, MoveName::Tachyon_Cutter},
-			{"tackle"_s, MoveName::Tackle},
-			{"tailglow"_s, MoveName::Tail_Glow},
-			{"tailslap"_s, MoveName::Tail_Slap},
-			{"tailwhip"_s, MoveName::Tail_Whip},
-			{"tailwind"_s, MoveName::Tailwind},
-			{"takedown"_s, MoveName::Take_Down},
-			{"tarshot"_s, MoveName::Tar_Shot},
-			{"taunt"_s, MoveName::Taunt},
-			{"tearfullook"_s, MoveName::Tearful_Look},
-			{"teatime"_s, MoveName::Teatime},
-			{"technoblast"_s, MoveName::Techno_Blast},
-			{"tectonicrage"_s, MoveName::Tectonic_Rage},
-			{"teeterdance"_s, MoveName::Teeter_Dance},
-			{"telekinesis"_s, MoveName::Telekinesis},
-			{"teleport"_s, MoveName::Teleport},
-			{"terablast"_s, MoveName::Tera_Blast},
-			{"terrainpulse"_s, MoveName::Terrain_Pulse},
-			{"thief"_s, MoveName::Thief},
-			{"thousandarrows"_s, MoveName::Thousand_Arrows},
-			{"thousandwaves"_s, MoveName::Thousand_Waves},
-			{"thrash"_s, MoveName::Thrash},
-			{"throatchop"_s, MoveName::Throat_Chop},
-			{"thunder"_s, MoveName::Thunder},
-			{"thunderbolt"_s, MoveName::Thunderbolt},
-			{"thundercage"_s, MoveName::Thunder_Cage},
-			{"thunderclap"_s, MoveName::Thunderclap},
-			{"thunderfang"_s, MoveName::Thunder_Fang},
-			{"thunderouskick"_s, MoveName::Thunderous_Kick},
-			{"thunderpunch"_s, MoveName::Thunder_Punch},
-			{"thundershock"_s, MoveName::Thunder_Shock},
-			{"thunderwave"_s, MoveName::Thunder_Wave},
-			{"tickle"_s, MoveName::Tickle},
-			{"tidyup"_s, MoveName::Tidy_Up},
-			{"topsyturvy"_s, MoveName::Topsy_Turvy},
-			{"torchsong"_s, MoveName::Torch_Song},
-			{"torment"_s, MoveName::Torment},
-			{"toxic"_s, MoveName::Toxic},
-			{"toxicspikes"_s, MoveName::Toxic_Spikes},
-			{"toxicthread"_s, MoveName::Toxic_Thread},
-			{"trailblaze"_s, MoveName::Trailblaze},
-			{"transform"_s, MoveName::Transform},
-			{"triattack"_s, MoveName::Tri_Attack},
-			{"trick"_s, MoveName::Trick},
-			{"trickortreat"_s, MoveName::Trick_or_Treat},
-			{"trickroom"_s, MoveName::Trick_Room},
-			{"tripleaxel"_s, MoveName::Triple_Axel},
-			{"tripledive"_s, MoveName::Triple_Dive},
-			{"triplekick"_s, MoveName::Triple_Kick},
-			{"tropkick"_s, MoveName::Trop_Kick},
-			{"trumpcard"_s, MoveName::Trump_Card},
-			{"twinbeam"_s, MoveName::Twin_Beam},
-			{"twineedle"_s, MoveName::Twineedle},
-			{"twinkletackle"_s, MoveName::Twinkle_Tackle},
-			{"twister"_s, MoveName::Twister},
-			{"upperhand"_s, MoveName::Upper_Hand},
-			{"uproar"_s, MoveName::Uproar},
-			{"uturn"_s, MoveName::U_turn},
-			{"vacuumwave"_s, MoveName::Vacuum_Wave},
-			{"vcreate"_s, MoveName::V_create},
-			{"venomdrench"_s, MoveName::Venom_Drench},
-			{"venoshock"_s, MoveName::Venoshock},
-			{"vicegrip"_s, MoveName::Vise_Grip},
-			{"vinewhip"_s, MoveName::Vine_Whip},
-			{"visegrip"_s, MoveName::Vise_Grip},
-			{"vitalthrow"_s, MoveName::Vital_Throw},
-			{"voltswitch"_s, MoveName::Volt_Switch},
-			{"volttackle"_s, MoveName::Volt_Tackle},
-			{"wakeupslap"_s, MoveName::Wake_Up_Slap},
-			{"waterfall"_s, MoveName::Waterfall},
-			{"watergun"_s, MoveName::Water_Gun},
-			{"waterpledge"_s, MoveName::Water_Pledge},
-			{"waterpulse"_s, MoveName::Water_Pulse},
-			{"watershuriken"_s, MoveName::Water_Shuriken},
-			{"watersport"_s, MoveName::Water_Sport},
-			{"waterspout"_s, MoveName::Water_Spout},
-			{"weatherball"_s, MoveName::Weather_Ball},
-			{"whirlpool"_s, MoveName::Whirlpool},
-			{"whirlwind"_s, MoveName::Whirlwind},
-			{"wickedblow"_s, MoveName::Wicked_Blow},
-			{"wickedtorque"_s, MoveName::Wicked_Torque},
-			{"wideguard"_s, MoveName::Wide_Guard},
-			{"wildcharge"_s, MoveName::Wild_Charge},
-			{"willowisp"_s, MoveName::Will_O_Wisp},
-			{"wingattack"_s, MoveName::Wing_Attack},
-			{"wish"_s, MoveName::Wish},
-			{"withdraw"_s, MoveName::Withdraw},
-			{"wonderroom"_s, MoveName::Wonder_Room},
-			{"woodhammer"_s, MoveName::Wood_Hammer},
-			{"workup"_s, MoveName::Work_Up},
-			{"worryseed"_s, MoveName::Worry_Seed},
-			{"wrap"_s, MoveName::Wrap},
-			{"wringout"_s, MoveName::Wring_Out},
-			{"xscissor"_s, MoveName::X_Scissor},
-			{"yawn"_s, MoveName::Yawn},
-			{"zapcannon"_s, MoveName::Zap_Cannon},
-			{"zenheadbutt"_s, MoveName::Zen_Headbutt},
-			{"zingzap"_s, MoveName::Zing_Zap},
-		})
-	);
-	auto const converted = fixed_capacity_lowercase_and_digit_string<25_bi>(str);
-	auto const result = containers::lookup(converter, converted);
+	static constexpr auto converter = make_perfect_hash_map<MoveName>({
+		{"10000000voltthunderbolt"_s, MoveName::m10000000_Volt_Thunderbolt},
+		{"absorb"_s, MoveName::Absorb},
+		{"accelerock"_s, MoveName::Accelerock},
+		{"acid"_s, MoveName::Acid},
+		{"acidarmor"_s, MoveName::Acid_Armor},
+		{"aciddownpour"_s, MoveName::Acid_Downpour},
+		{"acidspray"_s, MoveName::Acid_Spray},
+		{"acrobatics"_s, MoveName::Acrobatics},
+		{"acupressure"_s, MoveName::Acupressure},
+		{"aerialace"_s, MoveName::Aerial_Ace},
+		{"aeroblast"_s, MoveName::Aeroblast},
+		{"afteryou"_s, MoveName::After_You},
+		{"agility"_s, MoveName::Agility},
+		{"aircutter"_s, MoveName::Air_Cutter},
+		{"airslash"_s, MoveName::Air_Slash},
+		{"alloutpummeling"_s, MoveName::All_Out_Pummeling},
+		{"allyswitch"_s, MoveName::Ally_Switch},
+		{"amnesia"_s, MoveName::Amnesia},
+		{"anchorshot"_s, MoveName::Anchor_Shot},
+		{"ancientpower"_s, MoveName::Ancient_Power},
+		{"appleacid"_s, MoveName::Apple_Acid},
+		{"aquacutter"_s, MoveName::Aqua_Cutter},
+		{"aquajet"_s, MoveName::Aqua_Jet},
+		{"aquaring"_s, MoveName::Aqua_Ring},
+		{"aquastep"_s, MoveName::Aqua_Step},
+		{"aquatail"_s, MoveName::Aqua_Tail},
+		{"armorcannon"_s, MoveName::Armor_Cannon},
+		{"armthrust"_s, MoveName::Arm_Thrust},
+		{"aromatherapy"_s, MoveName::Aromatherapy},
+		{"aromaticmist"_s, MoveName::Aromatic_Mist},
+		{"assist"_s, MoveName::Assist},
+		{"assurance"_s, MoveName::Assurance},
+		{"astonish"_s, MoveName::Astonish},
+		{"astralbarrage"_s, MoveName::Astral_Barrage},
+		{"attackorder"_s, MoveName::Attack_Order},
+		{"attract"_s, MoveName::Attract},
+		{"aurasphere"_s, MoveName::Aura_Sphere},
+		{"aurawheel"_s, MoveName::Aura_Wheel},
+		{"aurorabeam"_s, MoveName::Aurora_Beam},
+		{"auroraveil"_s, MoveName::Aurora_Veil},
+		{"autotomize"_s, MoveName::Autotomize},
+		{"avalanche"_s, MoveName::Avalanche},
+		{"axekick"_s, MoveName::Axe_Kick},
+		{"babydolleyes"_s, MoveName::Baby_Doll_Eyes},
+		{"banefulbunker"_s, MoveName::Baneful_Bunker},
+		{"barrage"_s, MoveName::Barrage},
+		{"barrier"_s, MoveName::Barrier},
+		{"batonpass"_s, MoveName::Baton_Pass},
+		{"beakblast"_s, MoveName::Beak_Blast},
+		{"beatup"_s, MoveName::Beat_Up},
+		{"behemothbash"_s, MoveName::Behemoth_Bash},
+		{"behemothblade"_s, MoveName::Behemoth_Blade},
+		{"belch"_s, MoveName::Belch},
+		{"bellydrum"_s, MoveName::Belly_Drum},
+		{"bestow"_s, MoveName::Bestow},
+		{"bide"_s, MoveName::Bide},
+		{"bind"_s, MoveName::Bind},
+		{"bite"_s, MoveName::Bite},
+		{"bitterblade"_s, MoveName::Bitter_Blade},
+		{"blackholeeclipse"_s, MoveName::Black_Hole_Eclipse},
+		{"blastburn"_s, MoveName::Blast_Burn},
+		{"blazekick"_s, MoveName::Blaze_Kick},
+		{"blazingtorque"_s, MoveName::Blazing_Torque},
+		{"blizzard"_s, MoveName::Blizzard},
+		{"block"_s, MoveName::Block},
+		{"bloodmoon"_s, MoveName::Blood_Moon},
+		{"bloomdoom"_s, MoveName::Bloom_Doom},
+		{"blueflare"_s, MoveName::Blue_Flare},
+		{"bodypress"_s, MoveName::Body_Press},
+		{"bodyslam"_s, MoveName::Body_Slam},
+		{"boltbeak"_s, MoveName::Bolt_Beak},
+		{"boltstrike"_s, MoveName::Bolt_Strike},
+		{"boneclub"_s, MoveName::Bone_Club},
+		{"bonemerang"_s, MoveName::Bonemerang},
+		{"bonerush"_s, MoveName::Bone_Rush},
+		{"boomburst"_s, MoveName::Boomburst},
+		{"bounce"_s, MoveName::Bounce},
+		{"branchpoke"_s, MoveName::Branch_Poke},
+		{"bravebird"_s, MoveName::Brave_Bird},
+		{"breakingswipe"_s, MoveName::Breaking_Swipe},
+		{"breakneckblitz"_s, MoveName::Breakneck_Blitz},
+		{"brickbreak"_s, MoveName::Brick_Break},
+		{"brine"_s, MoveName::Brine},
+		{"brutalswing"_s, MoveName::Brutal_Swing},
+		{"bubble"_s, MoveName::Bubble},
+		{"bubblebeam"_s, MoveName::Bubble_Beam},
+		{"bugbite"_s, MoveName::Bug_Bite},
+		{"bugbuzz"_s, MoveName::Bug_Buzz},
+		{"bulkup"_s, MoveName::Bulk_Up},
+		{"bulldoze"_s, MoveName::Bulldoze},
+		{"bulletpunch"_s, MoveName::Bullet_Punch},
+		{"bulletseed"_s, MoveName::Bullet_Seed},
+		{"burningjealousy"_s, MoveName::Burning_Jealousy},
+		{"burnup"_s, MoveName::Burn_Up},
+		{"calmmind"_s, MoveName::Calm_Mind},
+		{"camouflage"_s, MoveName::Camouflage},
+		{"captivate"_s, MoveName::Captivate},
+		{"catastropika"_s, MoveName::Catastropika},
+		{"celebrate"_s, MoveName::Celebrate},
+		{"charge"_s, MoveName::Charge},
+		{"chargebeam"_s, MoveName::Charge_Beam},
+		{"charm"_s, MoveName::Charm},
+		{"chatter"_s, MoveName::Chatter},
+		{"chillingwater"_s, MoveName::Chilling_Water},
+		{"chillyreception"_s, MoveName::Chilly_Reception},
+		{"chipaway"_s, MoveName::Chip_Away},
+		{"circlethrow"_s, MoveName::Circle_Throw},
+		{"clamp"_s, MoveName::Clamp},
+		{"clangingscales"_s, MoveName::Clanging_Scales},
+		{"clangoroussoul"_s, MoveName::Clangorous_Soul},
+		{"clangoroussoulblaze"_s, MoveName::Clangorous_Soulblaze},
+		{"clearsmog"_s, MoveName::Clear_Smog},
+		{"closecombat"_s, MoveName::Close_Combat},
+		{"coaching"_s, MoveName::Coaching},
+		{"coil"_s, MoveName::Coil},
+		{"collisioncourse"_s, MoveName::Collision_Course},
+		{"combattorque"_s, MoveName::Combat_Torque},
+		{"cometpunch"_s, MoveName::Comet_Punch},
+		{"comeuppance"_s, MoveName::Comeuppance},
+		{"confide"_s, MoveName::Confide},
+		{"confuseray"_s, MoveName::Confuse_Ray},
+		{"confusion"_s, MoveName::Confusion},
+		{"constrict"_s, MoveName::Constrict},
+		{"continentalcrush"_s, MoveName::Continental_Crush},
+		{"conversion"_s, MoveName::Conversion},
+		{"conversion2"_s, MoveName::Conversion_2},
+		{"copycat"_s, MoveName::Copycat},
+		{"coreenforcer"_s, MoveName::Core_Enforcer},
+		{"corkscrewcrash"_s, MoveName::Corkscrew_Crash},
+		{"corrosivegas"_s, MoveName::Corrosive_Gas},
+		{"cosmicpower"_s, MoveName::Cosmic_Power},
+		{"cottonguard"_s, MoveName::Cotton_Guard},
+		{"cottonspore"_s, MoveName::Cotton_Spore},
+		{"counter"_s, MoveName::Counter},
+		{"courtchange"_s, MoveName::Court_Change},
+		{"covet"_s, MoveName::Covet},
+		{"crabhammer"_s, MoveName::Crabhammer},
+		{"craftyshield"_s, MoveName::Crafty_Shield},
+		{"crosschop"_s, MoveName::Cross_Chop},
+		{"crosspoison"_s, MoveName::Cross_Poison},
+		{"crunch"_s, MoveName::Crunch},
+		{"crushclaw"_s, MoveName::Crush_Claw},
+		{"crushgrip"_s, MoveName::Crush_Grip},
+		{"curse"_s, MoveName::Curse},
+		{"cut"_s, MoveName::Cut},
+		{"darkestlariat"_s, MoveName::Darkest_Lariat},
+		{"darkpulse"_s, MoveName::Dark_Pulse},
+		{"darkvoid"_s, MoveName::Dark_Void},
+		{"dazzlinggleam"_s, MoveName::Dazzling_Gleam},
+		{"decorate"_s, MoveName::Decorate},
+		{"defendorder"_s, MoveName::Defend_Order},
+		{"defensecurl"_s, MoveName::Defense_Curl},
+		{"defog"_s, MoveName::Defog},
+		{"destinybond"_s, MoveName::Destiny_Bond},
+		{"detect"_s, MoveName::Detect},
+		{"devastatingdrake"_s, MoveName::Devastating_Drake},
+		{"diamondstorm"_s, MoveName::Diamond_Storm},
+		{"dig"_s, MoveName::Dig},
+		{"disable"_s, MoveName::Disable},
+		{"disarmingvoice"_s, MoveName::Disarming_Voice},
+		{"discharge"_s, MoveName::Discharge},
+		{"dive"_s, MoveName::Dive},
+		{"dizzypunch"_s, MoveName::Dizzy_Punch},
+		{"doodle"_s, MoveName::Doodle},
+		{"doomdesire"_s, MoveName::Doom_Desire},
+		{"doubleedge"_s, MoveName::Double_Edge},
+		{"doublehit"_s, MoveName::Double_Hit},
+		{"doubleironbash"_s, MoveName::Double_Iron_Bash},
+		{"doublekick"_s, MoveName::Double_Kick},
+		{"doubleshock"_s, MoveName::Double_Shock},
+		{"doubleslap"_s, MoveName::Double_Slap},
+		{"doubleteam"_s, MoveName::Double_Team},
+		{"dracometeor"_s, MoveName::Draco_Meteor},
+		{"dragonascent"_s, MoveName::Dragon_Ascent},
+		{"dragonbreath"_s, MoveName::Dragon_Breath},
+		{"dragonclaw"_s, MoveName::Dragon_Claw},
+		{"dragondance"_s, MoveName::Dragon_Dance},
+		{"dragondarts"_s, MoveName::Dragon_Darts},
+		{"dragonenergy"_s, MoveName::Dragon_Energy},
+		{"dragonhammer"_s, MoveName::Dragon_Hammer},
+		{"dragonpulse"_s, MoveName::Dragon_Pulse},
+		{"dragonrage"_s, MoveName::Dragon_Rage},
+		{"dragonrush"_s, MoveName::Dragon_Rush},
+		{"dragontail"_s, MoveName::Dragon_Tail},
+		{"drainingkiss"_s, MoveName::Draining_Kiss},
+		{"drainpunch"_s, MoveName::Drain_Punch},
+		{"dreameater"_s, MoveName::Dream_Eater},
+		{"drillpeck"_s, MoveName::Drill_Peck},
+		{"drillrun"_s, MoveName::Drill_Run},
+		{"drumbeating"_s, MoveName::Drum_Beating},
+		{"dualchop"_s, MoveName::Dual_Chop},
+		{"dualwingbeat"_s, MoveName::Dual_Wingbeat},
+		{"dynamaxcannon"_s, MoveName::Dynamax_Cannon},
+		{"dynamicpunch"_s, MoveName::Dynamic_Punch},
+		{"earthpower"_s, MoveName::Earth_Power},
+		{"earthquake"_s, MoveName::Earthquake},
+		{"echoedvoice"_s, MoveName::Echoed_Voice},
+		{"eerieimpulse"_s, MoveName::Eerie_Impulse},
+		{"eeriespell"_s, MoveName::Eerie_Spell},
+		{"eggbomb"_s, MoveName::Egg_Bomb},
+		{"electricterrain"_s, MoveName::Electric_Terrain},
+		{"electrify"_s, MoveName::Electrify},
+		{"electroball"_s, MoveName::Electro_Ball},
+		{"electrodrift"_s, MoveName::Electro_Drift},
+		{"electroshot"_s, MoveName::Electro_Shot},
+		{"electroweb"_s, MoveName::Electroweb},
+		{"embargo"_s, MoveName::Embargo},
+		{"ember"_s, MoveName::Ember},
+		{"encore"_s, MoveName::Encore},
+		{"endeavor"_s, MoveName::Endeavor},
+		{"endure"_s, MoveName::Endure},
+		{"energyball"_s, MoveName::Energy_Ball},
+		{"entrainment"_s, MoveName::Entrainment},
+		{"eruption"_s, MoveName::Eruption},
+		{"eternabeam"_s, MoveName::Eternabeam},
+		{"expandingforce"_s, MoveName::Expanding_Force},
+		{"explosion"_s, MoveName::Explosion},
+		{"extrasensory"_s, MoveName::Extrasensory},
+		{"extremeevoboost"_s, MoveName::Extreme_Evoboost},
+		{"extremespeed"_s, MoveName::Extreme_Speed},
+		{"facade"_s, MoveName::Facade},
+		{"faintattack"_s, MoveName::Feint_Attack},
+		{"fairylock"_s, MoveName::Fairy_Lock},
+		{"fairywind"_s, MoveName::Fairy_Wind},
+		{"fakeout"_s, MoveName::Fake_Out},
+		{"faketears"_s, MoveName::Fake_Tears},
+		{"falsesurrender"_s, MoveName::False_Surrender},
+		{"falseswipe"_s, MoveName::False_Swipe},
+		{"featherdance"_s, MoveName::Feather_Dance},
+		{"feint"_s, MoveName::Feint},
+		{"feintattack"_s, MoveName::Feint_Attack},
+		{"fellstinger"_s, MoveName::Fell_Stinger},
+		{"fierydance"_s, MoveName::Fiery_Dance},
+		{"fierywrath"_s, MoveName::Fiery_Wrath},
+		{"filletaway"_s, MoveName::Fillet_Away},
+		{"finalgambit"_s, MoveName::Final_Gambit},
+		{"fireblast"_s, MoveName::Fire_Blast},
+		{"firefang"_s, MoveName::Fire_Fang},
+		{"firelash"_s, MoveName::Fire_Lash},
+		{"firepledge"_s, MoveName::Fire_Pledge},
+		{"firepunch"_s, MoveName::Fire_Punch},
+		{"firespin"_s, MoveName::Fire_Spin},
+		{"firstimpression"_s, MoveName::First_Impression},
+		{"fishiousrend"_s, MoveName::Fishious_Rend},
+		{"fissure"_s, MoveName::Fissure},
+		{"flail"_s, MoveName::Flail},
+		{"flameburst"_s, MoveName::Flame_Burst},
+		{"flamecharge"_s, MoveName::Flame_Charge},
+		{"flamethrower"_s, MoveName::Flamethrower},
+		{"flamewheel"_s, MoveName::Flame_Wheel},
+		{"flareblitz"_s, MoveName::Flare_Blitz},
+		{"flash"_s, MoveName::Flash},
+		{"flashcannon"_s, MoveName::Flash_Cannon},
+		{"flatter"_s, MoveName::Flatter},
+		{"fleurcannon"_s, MoveName::Fleur_Cannon},
+		{"fling"_s, MoveName::Fling},
+		{"flipturn"_s, MoveName::Flip_Turn},
+		{"floralhealing"_s, MoveName::Floral_Healing},
+		{"flowershield"_s, MoveName::Flower_Shield},
+		{"flowertrick"_s, MoveName::Flower_Trick},
+		{"fly"_s, MoveName::Fly},
+		{"flyingpress"_s, MoveName::Flying_Press},
+		{"focusblast"_s, MoveName::Focus_Blast},
+		{"focusenergy"_s, MoveName::Focus_Energy},
+		{"focuspunch"_s, MoveName::Focus_Punch},
+		{"followme"_s, MoveName::Follow_Me},
+		{"forcepalm"_s, MoveName::Force_Palm},
+		{"foresight"_s, MoveName::Foresight},
+		{"forestscurse"_s, MoveName::Forests_Curse},
+		{"foulplay"_s, MoveName::Foul_Play},
+		{"freezedry"_s, MoveName::Freeze_Dry},
+		{"freezeshock"_s, MoveName::Freeze_Shock},
+		{"freezingglare"_s, MoveName::Freezing_Glare},
+		{"frenzyplant"_s, MoveName::Frenzy_Plant},
+		{"frostbreath"_s, MoveName::Frost_Breath},
+		{"frustration"_s, MoveName::Frustration},
+		{"frustrationnull"_s, MoveName::Frustration}, // Pokemon Showdown
+		{"furyattack"_s, MoveName::Fury_Attack},
+		{"furycutter"_s, MoveName::Fury_Cutter},
+		{"furyswipes"_s, MoveName::Fury_Swipes},
+		{"fusionbolt"_s, MoveName::Fusion_Bolt},
+		{"fusionflare"_s, MoveName::Fusion_Flare},
+		{"futuresight"_s, MoveName::Future_Sight},
+		{"gastroacid"_s, MoveName::Gastro_Acid},
+		{"geargrind"_s, MoveName::Gear_Grind},
+		{"gearup"_s, MoveName::Gear_Up},
+		{"genesissupernova"_s, MoveName::Genesis_Supernova},
+		{"geomancy"_s, MoveName::Geomancy},
+		{"gigadrain"_s, MoveName::Giga_Drain},
+		{"gigaimpact"_s, MoveName::Giga_Impact},
+		{"gigatonhammer"_s, MoveName::Gigaton_Hammer},
+		{"gigavolthavoc"_s, MoveName::Gigavolt_Havoc},
+		{"glaciallance"_s, MoveName::Glacial_Lance},
+		{"glaciate"_s, MoveName::Glaciate},
+		{"glaiverush"_s, MoveName::Glaive_Rush},
+		{"glare"_s, MoveName::Glare},
+		{"grassknot"_s, MoveName::Grass_Knot},
+		{"grasspledge"_s, MoveName::Grass_Pledge},
+		{"grasswhistle"_s, MoveName::Grass_Whistle},
+		{"grassyglide"_s, MoveName::Grassy_Glide},
+		{"grassyterrain"_s, MoveName::Grassy_Terrain},
+		{"gravapple"_s, MoveName::Grav_Apple},
+		{"gravity"_s, MoveName::Gravity},
+		{"growl"_s, MoveName::Growl},
+		{"growth"_s, MoveName::Growth},
+		{"grudge"_s, MoveName::Grudge},
+		{"guardianofalola"_s, MoveName::Guardian_of_Alola},
+		{"guardsplit"_s, MoveName::Guard_Split},
+		{"guardswap"_s, MoveName::Guard_Swap},
+		{"guillotine"_s, MoveName::Guillotine},
+		{"gunkshot"_s, MoveName::Gunk_Shot},
+		{"gust"_s, MoveName::Gust},
+		{"gyroball"_s, MoveName::Gyro_Ball},
+		{"hail"_s, MoveName::Hail},
+		{"hammerarm"_s, MoveName::Hammer_Arm},
+		{"happyhour"_s, MoveName::Happy_Hour},
+		{"harden"_s, MoveName::Harden},
+		{"haze"_s, MoveName::Haze},
+		{"headbutt"_s, MoveName::Headbutt},
+		{"headcharge"_s, MoveName::Head_Charge},
+		{"headsmash"_s, MoveName::Head_Smash},
+		{"healbell"_s, MoveName::Heal_Bell},
+		{"healblock"_s, MoveName::Heal_Block},
+		{"healingwish"_s, MoveName::Healing_Wish},
+		{"healorder"_s, MoveName::Heal_Order},
+		{"healpulse"_s, MoveName::Heal_Pulse},
+		{"heartstamp"_s, MoveName::Heart_Stamp},
+		{"heartswap"_s, MoveName::Heart_Swap},
+		{"heatcrash"_s, MoveName::Heat_Crash},
+		{"heatwave"_s, MoveName::Heat_Wave},
+		{"heavyslam"_s, MoveName::Heavy_Slam},
+		{"helpinghand"_s, MoveName::Helping_Hand},
+		{"hex"_s, MoveName::Hex},
+		{"hiddenpower"_s, MoveName::Hidden_Power},
+		{"hiddenpowerbug"_s, MoveName::Hidden_Power},
+		{"hiddenpowerdark"_s, MoveName::Hidden_Power},
+		{"hiddenpowerdragon"_s, MoveName::Hidden_Power},
+		{"hiddenpowerelectric"_s, MoveName::Hidden_Power},
+		{"hiddenpowerfighting"_s, MoveName::Hidden_Power},
+		{"hiddenpowerfire"_s, MoveName::Hidden_Power},
+		{"hiddenpowerflying"_s, MoveName::Hidden_Power},
+		{"hiddenpowerghost"_s, MoveName::Hidden_Power},
+		{"hiddenpowergrass"_s, MoveName::Hidden_Power},
+		{"hiddenpowerground"_s, MoveName::Hidden_Power},
+		{"hiddenpowerice"_s, MoveName::Hidden_Power},
+		{"hiddenpowerpoison"_s, MoveName::Hidden_Power},
+		{"hiddenpowerpsychic"_s, MoveName::Hidden_Power},
+		{"hiddenpowerrock"_s, MoveName::Hidden_Power},
+		{"hiddenpowersteel"_s, MoveName::Hidden_Power},
+		{"hiddenpowerwater"_s, MoveName::Hidden_Power},
+		{"highhorsepower"_s, MoveName::High_Horsepower},
+		{"highjumpkick"_s, MoveName::High_Jump_Kick},
+		{"hijumpkick"_s, MoveName::High_Jump_Kick},
+		{"holdback"_s, MoveName::Hold_Back},
+		{"holdhands"_s, MoveName::Hold_Hands},
+		{"honeclaws"_s, MoveName::Hone_Claws},
+		{"hornattack"_s, MoveName::Horn_Attack},
+		{"horndrill"_s, MoveName::Horn_Drill},
+		{"hornleech"_s, MoveName::Horn_Leech},
+		{"howl"_s, MoveName::Howl},
+		{"hpbug"_s, MoveName::Hidden_Power},
+		{"hpdark"_s, MoveName::Hidden_Power},
+		{"hpdragon"_s, MoveName::Hidden_Power},
+		{"hpelectric"_s, MoveName::Hidden_Power},
+		{"hpfighting"_s, MoveName::Hidden_Power},
+		{"hpfire"_s, MoveName::Hidden_Power},
+		{"hpflying"_s, MoveName::Hidden_Power},
+		{"hpghost"_s, MoveName::Hidden_Power},
+		{"hpgrass"_s, MoveName::Hidden_Power},
+		{"hpground"_s, MoveName::Hidden_Power},
+		{"hpice"_s, MoveName::Hidden_Power},
+		{"hppoison"_s, MoveName::Hidden_Power},
+		{"hppsychic"_s, MoveName::Hidden_Power},
+		{"hprock"_s, MoveName::Hidden_Power},
+		{"hpsteel"_s, MoveName::Hidden_Power},
+		{"hpwater"_s, MoveName::Hidden_Power},
+		{"hurricane"_s, MoveName::Hurricane},
+		{"hydrocannon"_s, MoveName::Hydro_Cannon},
+		{"hydropump"_s, MoveName::Hydro_Pump},
+		{"hydrosteam"_s, MoveName::Hydro_Steam},
+		{"hydrovortex"_s, MoveName::Hydro_Vortex},
+		{"hyperbeam"_s, MoveName::Hyper_Beam},
+		{"hyperdrill"_s, MoveName::Hyper_Drill},
+		{"hyperfang"_s, MoveName::Hyper_Fang},
+		{"hyperspacefury"_s, MoveName::Hyperspace_Fury},
+		{"hyperspacehole"_s, MoveName::Hyperspace_Hole},
+		{"hypervoice"_s, MoveName::Hyper_Voice},
+		{"hypnosis"_s, MoveName::Hypnosis},
+		{"iceball"_s, MoveName::Ice_Ball},
+		{"icebeam"_s, MoveName::Ice_Beam},
+		{"iceburn"_s, MoveName::Ice_Burn},
+		{"icefang"_s, MoveName::Ice_Fang},
+		{"icehammer"_s, MoveName::Ice_Hammer},
+		{"icepunch"_s, MoveName::Ice_Punch},
+		{"iceshard"_s, MoveName::Ice_Shard},
+		{"icespinner"_s, MoveName::Ice_Spinner},
+		{"iciclecrash"_s, MoveName::Icicle_Crash},
+		{"iciclespear"_s, MoveName::Icicle_Spear},
+		{"icywind"_s, MoveName::Icy_Wind},
+		{"imprison"_s, MoveName::Imprison},
+		{"incinerate"_s, MoveName::Incinerate},
+		{"inferno"_s, MoveName::Inferno},
+		{"infernooverdrive"_s, MoveName::Inferno_Overdrive},
+		{"infestation"_s, MoveName::Infestation},
+		{"ingrain"_s, MoveName::Ingrain},
+		{"instruct"_s, MoveName::Instruct},
+		{"iondeluge"_s, MoveName::Ion_Deluge},
+		{"irondefense"_s, MoveName::Iron_Defense},
+		{"ironhead"_s, MoveName::Iron_Head},
+		{"irontail"_s, MoveName::Iron_Tail},
+		{"ivycudgel"_s, MoveName::Ivy_Cudgel},
+		{"jawlock"_s, MoveName::Jaw_Lock},
+		{"jetpunch"_s, MoveName::Jet_Punch},
+		{"judgment"_s, MoveName::Judgment},
+		{"jumpkick"_s, MoveName::Jump_Kick},
+		{"junglehealing"_s, MoveName::Jungle_Healing},
+		{"karatechop"_s, MoveName::Karate_Chop},
+		{"kinesis"_s, MoveName::Kinesis},
+		{"kingsshield"_s, MoveName::Kings_Shield},
+		{"knockoff"_s, MoveName::Knock_Off},
+		{"kowtowcleave"_s, MoveName::Kowtow_Cleave},
+		{"landswrath"_s, MoveName::Lands_Wrath},
+		{"laserfocus"_s, MoveName::Laser_Focus},
+		{"lashout"_s, MoveName::Lash_Out},
+		{"lastresort"_s, MoveName::Last_Resort},
+		{"lastrespects"_s, MoveName::Last_Respects},
+		{"lavaplume"_s, MoveName::Lava_Plume},
+		{"leafage"_s, MoveName::Leafage},
+		{"leafblade"_s, MoveName::Leaf_Blade},
+		{"leafstorm"_s, MoveName::Leaf_Storm},
+		{"leaftornado"_s, MoveName::Leaf_Tornado},
+		{"leechlife"_s, MoveName::Leech_Life},
+		{"leechseed"_s, MoveName::Leech_Seed},
+		{"leer"_s, MoveName::Leer},
+		{"letssnuggleforever"_s, MoveName::Lets_Snuggle_Forever},
+		{"lick"_s, MoveName::Lick},
+		{"lifedew"_s, MoveName::Life_Dew},
+		{"lightofruin"_s, MoveName::Light_of_Ruin},
+		{"lightscreen"_s, MoveName::Light_Screen},
+		{"lightthatburnsthesky"_s, MoveName::Light_That_Burns_the_Sky},
+		{"liquidation"_s, MoveName::Liquidation},
+		{"lockon"_s, MoveName::Lock_On},
+		{"lovelykiss"_s, MoveName::Lovely_Kiss},
+		{"lowkick"_s, MoveName::Low_Kick},
+		{"lowsweep"_s, MoveName::Low_Sweep},
+		{"luckychant"_s, MoveName::Lucky_Chant},
+		{"luminacrash"_s, MoveName::Lumina_Crash},
+		{"lunardance"_s, MoveName::Lunar_Dance},
+		{"lunge"_s, MoveName::Lunge},
+		{"lusterpurge"_s, MoveName::Luster_Purge},
+		{"machpunch"_s, MoveName::Mach_Punch},
+		{"magicalleaf"_s, MoveName::Magical_Leaf},
+		{"magicaltorque"_s, MoveName::Magical_Torque},
+		{"magiccoat"_s, MoveName::Magic_Coat},
+		{"magicpowder"_s, MoveName::Magic_Powder},
+		{"magicroom"_s, MoveName::Magic_Room},
+		{"magmastorm"_s, MoveName::Magma_Storm},
+		{"magnetbomb"_s, MoveName::Magnet_Bomb},
+		{"magneticflux"_s, MoveName::Magnetic_Flux},
+		{"magnetrise"_s, MoveName::Magnet_Rise},
+		{"magnitude"_s, MoveName::Magnitude},
+		{"makeitrain"_s, MoveName::Make_It_Rain},
+		{"maliciousmoonsault"_s, MoveName::Malicious_Moonsault},
+		{"matblock"_s, MoveName::Mat_Block},
+		{"matchagotcha"_s, MoveName::Matcha_Gotcha},
+		{"maxairstream"_s, MoveName::Max_Airstream},
+		{"maxdarkness"_s, MoveName::Max_Darkness},
+		{"maxflare"_s, MoveName::Max_Flare},
+		{"maxflutterby"_s, MoveName::Max_Flutterby},
+		{"maxgeyser"_s, MoveName::Max_Geyser},
+		{"maxguard"_s, MoveName::Max_Guard},
+		{"maxhailstorm"_s, MoveName::Max_Hailstorm},
+		{"maxknuckle"_s, MoveName::Max_Knuckle},
+		{"maxlightning"_s, MoveName::Max_Lightning},
+		{"maxmindstorm"_s, MoveName::Max_Mindstorm},
+		{"maxooze"_s, MoveName::Max_Ooze},
+		{"maxovergrowth"_s, MoveName::Max_Overgrowth},
+		{"maxphantasm"_s, MoveName::Max_Phantasm},
+		{"maxquake"_s, MoveName::Max_Quake},
+		{"maxrockfall"_s, MoveName::Max_Rockfall},
+		{"maxstarfall"_s, MoveName::Max_Starfall},
+		{"maxsteelspike"_s, MoveName::Max_Steelspike},
+		{"maxstrike"_s, MoveName::Max_Strike},
+		{"maxwyrmwind"_s, MoveName::Max_Wyrmwind},
+		{"meanlook"_s, MoveName::Mean_Look},
+		{"meditate"_s, MoveName::Meditate},
+		{"mefirst"_s, MoveName::Me_First},
+		{"megadrain"_s, MoveName::Mega_Drain},
+		{"megahorn"_s, MoveName::Megahorn},
+		{"megakick"_s, MoveName::Mega_Kick},
+		{"megapunch"_s, MoveName::Mega_Punch},
+		{"memento"_s, MoveName::Memento},
+		{"menacingmoonrazemaelstrom"_s, MoveName::Menacing_Moonraze_Maelstrom},
+		{"metalburst"_s, MoveName::Metal_Burst},
+		{"metalclaw"_s, MoveName::Metal_Claw},
+		{"metalsound"_s, MoveName::Metal_Sound},
+		{"meteorassault"_s, MoveName::Meteor_Assault},
+		{"meteorbeam"_s, MoveName::Meteor_Beam},
+		{"meteormash"_s, MoveName::Meteor_Mash},
+		{"metronome"_s, MoveName::Metronome},
+		{"milkdrink"_s, MoveName::Milk_Drink},
+		{"mimic"_s, MoveName::Mimic},
+		{"mindblown"_s, MoveName::Mind_Blown},
+		{"mindreader"_s, MoveName::Mind_Reader},
+		{"minimize"_s, MoveName::Minimize},
+		{"miracleeye"_s, MoveName::Miracle_Eye},
+		{"mirrorcoat"_s, MoveName::Mirror_Coat},
+		{"mirrormove"_s, MoveName::Mirror_Move},
+		{"mirrorshot"_s, MoveName::Mirror_Shot},
+		{"mist"_s, MoveName::Mist},
+		{"mistball"_s, MoveName::Mist_Ball},
+		{"mistyexplosion"_s, MoveName::Misty_Explosion},
+		{"mistyterrain"_s, MoveName::Misty_Terrain},
+		{"moonblast"_s, MoveName::Moonblast},
+		{"moongeistbeam"_s, MoveName::Moongeist_Beam},
+		{"moonlight"_s, MoveName::Moonlight},
+		{"morningsun"_s, MoveName::Morning_Sun},
+		{"mortalspin"_s, MoveName::Mortal_Spin},
+		{"mudbomb"_s, MoveName::Mud_Bomb},
+		{"muddywater"_s, MoveName::Muddy_Water},
+		{"mudshot"_s, MoveName::Mud_Shot},
+		{"mudslap"_s, MoveName::Mud_Slap},
+		{"mudsport"_s, MoveName::Mud_Sport},
+		{"multiattack"_s, MoveName::Multi_Attack},
+		{"mysticalfire"_s, MoveName::Mystical_Fire},
+		{"nastyplot"_s, MoveName::Nasty_Plot},
+		{"naturalgift"_s, MoveName::Natural_Gift},
+		{"naturepower"_s, MoveName::Nature_Power},
+		{"naturesmadness"_s, MoveName::Natures_Madness},
+		{"needlearm"_s, MoveName::Needle_Arm},
+		{"neverendingnightmare"_s, MoveName::Never_Ending_Nightmare},
+		{"nightdaze"_s, MoveName::Night_Daze},
+		{"nightmare"_s, MoveName::Nightmare},
+		{"nightshade"_s, MoveName::Night_Shade},
+		{"nightslash"_s, MoveName::Night_Slash},
+		{"nobleroar"_s, MoveName::Noble_Roar},
+		{"noretreat"_s, MoveName::No_Retreat},
+		{"noxioustorque"_s, MoveName::Noxious_Torque},
+		{"nuzzle"_s, MoveName::Nuzzle},
+		{"oblivionwing"_s, MoveName::Oblivion_Wing},
+		{"obstruct"_s, MoveName::Obstruct},
+		{"oceanicoperetta"_s, MoveName::Oceanic_Operetta},
+		{"octazooka"_s, MoveName::Octazooka},
+		{"octolock"_s, MoveName::Octolock},
+		{"odorsleuth"_s, MoveName::Odor_Sleuth},
+		{"ominouswind"_s, MoveName::Ominous_Wind},
+		{"orderup"_s, MoveName::Order_Up},
+		{"originpulse"_s, MoveName::Origin_Pulse},
+		{"outrage"_s, MoveName::Outrage},
+		{"overdrive"_s, MoveName::Overdrive},
+		{"overheat"_s, MoveName::Overheat},
+		{"painsplit"_s, MoveName::Pain_Split},
+		{"paraboliccharge"_s, MoveName::Parabolic_Charge},
+		{"partingshot"_s, MoveName::Parting_Shot},
+		{"payback"_s, MoveName::Payback},
+		{"payday"_s, MoveName::Pay_Day},
+		{"peck"_s, MoveName::Peck},
+		{"perishsong"_s, MoveName::Perish_Song},
+		{"petalblizzard"_s, MoveName::Petal_Blizzard},
+		{"petaldance"_s, MoveName::Petal_Dance},
+		{"phantomforce"_s, MoveName::Phantom_Force},
+		{"photongeyser"_s, MoveName::Photon_Geyser},
+		{"pinmissile"_s, MoveName::Pin_Missile},
+		{"plasmafists"_s, MoveName::Plasma_Fists},
+		{"playnice"_s, MoveName::Play_Nice},
+		{"playrough"_s, MoveName::Play_Rough},
+		{"pluck"_s, MoveName::Pluck},
+		{"poisonfang"_s, MoveName::Poison_Fang},
+		{"poisongas"_s, MoveName::Poison_Gas},
+		{"poisonjab"_s, MoveName::Poison_Jab},
+		{"poisonpowder"_s, MoveName::Poison_Powder},
+		{"poisonsting"_s, MoveName::Poison_Sting},
+		{"poisontail"_s, MoveName::Poison_Tail},
+		{"pollenpuff"_s, MoveName::Pollen_Puff},
+		{"poltergeist"_s, MoveName::Poltergeist},
+		{"populationbomb"_s, MoveName::Population_Bomb},
+		{"pounce"_s, MoveName::Pounce},
+		{"pound"_s, MoveName::Pound},
+		{"powder"_s, MoveName::Powder},
+		{"powdersnow"_s, MoveName::Powder_Snow},
+		{"powergem"_s, MoveName::Power_Gem},
+		{"powersplit"_s, MoveName::Power_Split},
+		{"powerswap"_s, MoveName::Power_Swap},
+		{"powertrick"_s, MoveName::Power_Trick},
+		{"powertrip"_s, MoveName::Power_Trip},
+		{"poweruppunch"_s, MoveName::Power_Up_Punch},
+		{"powerwhip"_s, MoveName::Power_Whip},
+		{"precipiceblades"_s, MoveName::Precipice_Blades},
+		{"present"_s, MoveName::Present},
+		{"prismaticlaser"_s, MoveName::Prismatic_Laser},
+		{"protect"_s, MoveName::Protect},
+		{"psybeam"_s, MoveName::Psybeam},
+		{"psyblade"_s, MoveName::Psyblade},
+		{"psychic"_s, MoveName::Psychic},
+		{"psychicfangs"_s, MoveName::Psychic_Fangs},
+		{"psychicnoise"_s, MoveName::Psychic_Noise},
+		{"psychicterrain"_s, MoveName::Psychic_Terrain},
+		{"psychoboost"_s, MoveName::Psycho_Boost},
+		{"psychocut"_s, MoveName::Psycho_Cut},
+		{"psychoshift"_s, MoveName::Psycho_Shift},
+		{"psychup"_s, MoveName::Psych_Up},
+		{"psyshock"_s, MoveName::Psyshock},
+		{"psystrike"_s, MoveName::Psystrike},
+		{"psywave"_s, MoveName::Psywave},
+		{"pulverizingpancake"_s, MoveName::Pulverizing_Pancake},
+		{"punishment"_s, MoveName::Punishment},
+		{"purify"_s, MoveName::Purify},
+		{"pursuit"_s, MoveName::Pursuit},
+		{"pyroball"_s, MoveName::Pyro_Ball},
+		{"quash"_s, MoveName::Quash},
+		{"quickattack"_s, MoveName::Quick_Attack},
+		{"quickguard"_s, MoveName::Quick_Guard},
+		{"quiverdance"_s, MoveName::Quiver_Dance},
+		{"rage"_s, MoveName::Rage},
+		{"ragefist"_s, MoveName::Rage_Fist},
+		{"ragepowder"_s, MoveName::Rage_Powder},
+		{"ragingbull"_s, MoveName::Raging_Bull},
+		{"raindance"_s, MoveName::Rain_Dance},
+		{"rapidspin"_s, MoveName::Rapid_Spin},
+		{"razorleaf"_s, MoveName::Razor_Leaf},
+		{"razorshell"_s, MoveName::Razor_Shell},
+		{"razorwind"_s, MoveName::Razor_Wind},
+		{"recharge"_s, MoveName::Hyper_Beam}, // TODO: fix
+		{"recover"_s, MoveName::Recover},
+		{"recycle"_s, MoveName::Recycle},
+		{"reflect"_s, MoveName::Reflect},
+		{"reflecttype"_s, MoveName::Reflect_Type},
+		{"refresh"_s, MoveName::Refresh},
+		{"relicsong"_s, MoveName::Relic_Song},
+		{"rest"_s, MoveName::Rest},
+		{"retaliate"_s, MoveName::Retaliate},
+		{"return"_s, MoveName::Return},
+		{"return102"_s, MoveName::Return},
+		{"revelationdance"_s, MoveName::Revelation_Dance},
+		{"revenge"_s, MoveName::Revenge},
+		{"reversal"_s, MoveName::Reversal},
+		{"revivalblessing"_s, MoveName::Revival_Blessing},
+		{"risingvoltage"_s, MoveName::Rising_Voltage},
+		{"roar"_s, MoveName::Roar},
+		{"roaroftime"_s, MoveName::Roar_of_Time},
+		{"rockblast"_s, MoveName::Rock_Blast},
+		{"rockclimb"_s, MoveName::Rock_Climb},
+		{"rockpolish"_s, MoveName::Rock_Polish},
+		{"rockslide"_s, MoveName::Rock_Slide},
+		{"rocksmash"_s, MoveName::Rock_Smash},
+		{"rockthrow"_s, MoveName::Rock_Throw},
+		{"rocktomb"_s, MoveName::Rock_Tomb},
+		{"rockwrecker"_s, MoveName::Rock_Wrecker},
+		{"roleplay"_s, MoveName::Role_Play},
+		{"rollingkick"_s, MoveName::Rolling_Kick},
+		{"rollout"_s, MoveName::Rollout},
+		{"roost"_s, MoveName::Roost},
+		{"rototiller"_s, MoveName::Rototiller},
+		{"round"_s, MoveName::Round},
+		{"ruination"_s, MoveName::Ruination},
+		{"sacredfire"_s, MoveName::Sacred_Fire},
+		{"sacredsword"_s, MoveName::Sacred_Sword},
+		{"safeguard"_s, MoveName::Safeguard},
+		{"saltcure"_s, MoveName::Salt_Cure},
+		{"sandattack"_s, MoveName::Sand_Attack},
+		{"sandstorm"_s, MoveName::Sandstorm},
+		{"sandtomb"_s, MoveName::Sand_Tomb},
+		{"savagespinout"_s, MoveName::Savage_Spin_Out},
+		{"scald"_s, MoveName::Scald},
+		{"scaleshot"_s, MoveName::Scale_Shot},
+		{"scaryface"_s, MoveName::Scary_Face},
+		{"scorchingsands"_s, MoveName::Scorching_Sands},
+		{"scratch"_s, MoveName::Scratch},
+		{"screech"_s, MoveName::Screech},
+		{"searingshot"_s, MoveName::Searing_Shot},
+		{"searingsunrazesmash"_s, MoveName::Searing_Sunraze_Smash},
+		{"secretpower"_s, MoveName::Secret_Power},
+		{"secretsword"_s, MoveName::Secret_Sword},
+		{"seedbomb"_s, MoveName::Seed_Bomb},
+		{"seedflare"_s, MoveName::Seed_Flare},
+		{"seismictoss"_s, MoveName::Seismic_Toss},
+		{"selfdestruct"_s, MoveName::Self_Destruct},
+		{"shadowball"_s, MoveName::Shadow_Ball},
+		{"shadowbone"_s, MoveName::Shadow_Bone},
+		{"shadowclaw"_s, MoveName::Shadow_Claw},
+		{"shadowforce"_s, MoveName::Shadow_Force},
+		{"shadowpunch"_s, MoveName::Shadow_Punch},
+		{"shadowsneak"_s, MoveName::Shadow_Sneak},
+		{"sharpen"_s, MoveName::Sharpen},
+		{"shatteredpsyche"_s, MoveName::Shattered_Psyche},
+		{"shedtail"_s, MoveName::Shed_Tail},
+		{"sheercold"_s, MoveName::Sheer_Cold},
+		{"shellsidearm"_s, MoveName::Shell_Side_Arm},
+		{"shellsmash"_s, MoveName::Shell_Smash},
+		{"shelltrap"_s, MoveName::Shell_Trap},
+		{"shiftgear"_s, MoveName::Shift_Gear},
+		{"shockwave"_s, MoveName::Shock_Wave},
+		{"shoreup"_s, MoveName::Shore_Up},
+		{"signalbeam"_s, MoveName::Signal_Beam},
+		{"silktrap"_s, MoveName::Silk_Trap},
+		{"silverwind"_s, MoveName::Silver_Wind},
+		{"simplebeam"_s, MoveName::Simple_Beam},
+		{"sing"_s, MoveName::Sing},
+		{"sinisterarrowraid"_s, MoveName::Sinister_Arrow_Raid},
+		{"sketch"_s, MoveName::Sketch},
+		{"skillswap"_s, MoveName::Skill_Swap},
+		{"skittersmack"_s, MoveName::Skitter_Smack},
+		{"skullbash"_s, MoveName::Skull_Bash},
+		{"skyattack"_s, MoveName::Sky_Attack},
+		{"skydrop"_s, MoveName::Sky_Drop},
+		{"skyuppercut"_s, MoveName::Sky_Uppercut},
+		{"slackoff"_s, MoveName::Slack_Off},
+		{"slam"_s, MoveName::Slam},
+		{"slash"_s, MoveName::Slash},
+		{"sleeppowder"_s, MoveName::Sleep_Powder},
+		{"sleeptalk"_s, MoveName::Sleep_Talk},
+		{"sludge"_s, MoveName::Sludge},
+		{"sludgebomb"_s, MoveName::Sludge_Bomb},
+		{"sludgewave"_s, MoveName::Sludge_Wave},
+		{"smackdown"_s, MoveName::Smack_Down},
+		{"smartstrike"_s, MoveName::Smart_Strike},
+		{"smellingsalt"_s, MoveName::Smelling_Salts},
+		{"smellingsalts"_s, MoveName::Smelling_Salts},
+		{"smog"_s, MoveName::Smog},
+		{"smokescreen"_s, MoveName::Smokescreen},
+		{"snaptrap"_s, MoveName::Snap_Trap},
+		{"snarl"_s, MoveName::Snarl},
+		{"snatch"_s, MoveName::Snatch},
+		{"snipeshot"_s, MoveName::Snipe_Shot},
+		{"snore"_s, MoveName::Snore},
+		{"snowscape"_s, MoveName::Snowscape},
+		{"soak"_s, MoveName::Soak},
+		{"softboiled"_s, MoveName::Soft_Boiled},
+		{"solarbeam"_s, MoveName::Solar_Beam},
+		{"solarblade"_s, MoveName::Solar_Blade},
+		{"sonicboom"_s, MoveName::Sonic_Boom},
+		{"soulstealing7starstrike"_s, MoveName::Soul_Stealing_7_Star_Strike},
+		{"spacialrend"_s, MoveName::Spacial_Rend},
+		{"spark"_s, MoveName::Spark},
+		{"sparklingaria"_s, MoveName::Sparkling_Aria},
+		{"spectralthief"_s, MoveName::Spectral_Thief},
+		{"speedswap"_s, MoveName::Speed_Swap},
+		{"spicyextract"_s, MoveName::Spicy_Extract},
+		{"spiderweb"_s, MoveName::Spider_Web},
+		{"spikecannon"_s, MoveName::Spike_Cannon},
+		{"spikes"_s, MoveName::Spikes},
+		{"spikyshield"_s, MoveName::Spiky_Shield},
+		{"spinout"_s, MoveName::Spin_Out},
+		{"spiritbreak"_s, MoveName::Spirit_Break},
+		{"spiritshackle"_s, MoveName::Spirit_Shackle},
+		{"spite"_s, MoveName::Spite},
+		{"spitup"_s, MoveName::Spit_Up},
+		{"splash"_s, MoveName::Splash},
+		{"splinteredstormshards"_s, MoveName::Splintered_Stormshards},
+		{"spore"_s, MoveName::Spore},
+		{"spotlight"_s, MoveName::Spotlight},
+		{"stealthrock"_s, MoveName::Stealth_Rock},
+		{"steameruption"_s, MoveName::Steam_Eruption},
+		{"steamroller"_s, MoveName::Steamroller},
+		{"steelbeam"_s, MoveName::Steel_Beam},
+		{"steelroller"_s, MoveName::Steel_Roller},
+		{"steelwing"_s, MoveName::Steel_Wing},
+		{"stickyweb"_s, MoveName::Sticky_Web},
+		{"stockpile"_s, MoveName::Stockpile},
+		{"stokedsparksurfer"_s, MoveName::Stoked_Sparksurfer},
+		{"stomp"_s, MoveName::Stomp},
+		{"stompingtantrum"_s, MoveName::Stomping_Tantrum},
+		{"stoneedge"_s, MoveName::Stone_Edge},
+		{"storedpower"_s, MoveName::Stored_Power},
+		{"stormthrow"_s, MoveName::Storm_Throw},
+		{"strangesteam"_s, MoveName::Strange_Steam},
+		{"strength"_s, MoveName::Strength},
+		{"strengthsap"_s, MoveName::Strength_Sap},
+		{"stringshot"_s, MoveName::String_Shot},
+		{"struggle"_s, MoveName::Struggle},
+		{"strugglebug"_s, MoveName::Struggle_Bug},
+		{"stuffcheeks"_s, MoveName::Stuff_Cheeks},
+		{"stunspore"_s, MoveName::Stun_Spore},
+		{"submission"_s, MoveName::Submission},
+		{"substitute"_s, MoveName::Substitute},
+		{"subzeroslammer"_s, MoveName::Subzero_Slammer},
+		{"suckerpunch"_s, MoveName::Sucker_Punch},
+		{"sunnyday"_s, MoveName::Sunny_Day},
+		{"sunsteelstrike"_s, MoveName::Sunsteel_Strike},
+		{"superfang"_s, MoveName::Super_Fang},
+		{"superpower"_s, MoveName::Superpower},
+		{"supersonic"_s, MoveName::Supersonic},
+		{"supersonicskystrike"_s, MoveName::Supersonic_Skystrike},
+		{"surf"_s, MoveName::Surf},
+		{"surgingstrikes"_s, MoveName::Surging_Strikes},
+		{"swagger"_s, MoveName::Swagger},
+		{"swallow"_s, MoveName::Swallow},
+		{"sweetkiss"_s, MoveName::Sweet_Kiss},
+		{"sweetscent"_s, MoveName::Sweet_Scent},
+		{"swift"_s, MoveName::Swift},
+		{"switcheroo"_s, MoveName::Switcheroo},
+		{"swordsdance"_s, MoveName::Swords_Dance},
+		{"synchronoise"_s, MoveName::Synchronoise},
+		{"synthesis"_s, MoveName::Synthesis},
+		{"syrupbomb"_s, MoveName::Syrup_Bomb},
+		{"tachyoncutter"_s, MoveName::Tachyon_Cutter},
+		{"tackle"_s, MoveName::Tackle},
+		{"tailglow"_s, MoveName::Tail_Glow},
+		{"tailslap"_s, MoveName::Tail_Slap},
+		{"tailwhip"_s, MoveName::Tail_Whip},
+		{"tailwind"_s, MoveName::Tailwind},
+		{"takedown"_s, MoveName::Take_Down},
+		{"tarshot"_s, MoveName::Tar_Shot},
+		{"taunt"_s, MoveName::Taunt},
+		{"tearfullook"_s, MoveName::Tearful_Look},
+		{"teatime"_s, MoveName::Teatime},
+		{"technoblast"_s, MoveName::Techno_Blast},
+		{"tectonicrage"_s, MoveName::Tectonic_Rage},
+		{"teeterdance"_s, MoveName::Teeter_Dance},
+		{"telekinesis"_s, MoveName::Telekinesis},
+		{"teleport"_s, MoveName::Teleport},
+		{"terablast"_s, MoveName::Tera_Blast},
+		{"terrainpulse"_s, MoveName::Terrain_Pulse},
+		{"thief"_s, MoveName::Thief},
+		{"thousandarrows"_s, MoveName::Thousand_Arrows},
+		{"thousandwaves"_s, MoveName::Thousand_Waves},
+		{"thrash"_s, MoveName::Thrash},
+		{"throatchop"_s, MoveName::Throat_Chop},
+		{"thunder"_s, MoveName::Thunder},
+		{"thunderbolt"_s, MoveName::Thunderbolt},
+		{"thundercage"_s, MoveName::Thunder_Cage},
+		{"thunderclap"_s, MoveName::Thunderclap},
+		{"thunderfang"_s, MoveName::Thunder_Fang},
+		{"thunderouskick"_s, MoveName::Thunderous_Kick},
+		{"thunderpunch"_s, MoveName::Thunder_Punch},
+		{"thundershock"_s, MoveName::Thunder_Shock},
+		{"thunderwave"_s, MoveName::Thunder_Wave},
+		{"tickle"_s, MoveName::Tickle},
+		{"tidyup"_s, MoveName::Tidy_Up},
+		{"topsyturvy"_s, MoveName::Topsy_Turvy},
+		{"torchsong"_s, MoveName::Torch_Song},
+		{"torment"_s, MoveName::Torment},
+		{"toxic"_s, MoveName::Toxic},
+		{"toxicspikes"_s, MoveName::Toxic_Spikes},
+		{"toxicthread"_s, MoveName::Toxic_Thread},
+		{"trailblaze"_s, MoveName::Trailblaze},
+		{"transform"_s, MoveName::Transform},
+		{"triattack"_s, MoveName::Tri_Attack},
+		{"trick"_s, MoveName::Trick},
+		{"trickortreat"_s, MoveName::Trick_or_Treat},
+		{"trickroom"_s, MoveName::Trick_Room},
+		{"tripleaxel"_s, MoveName::Triple_Axel},
+		{"tripledive"_s, MoveName::Triple_Dive},
+		{"triplekick"_s, MoveName::Triple_Kick},
+		{"tropkick"_s, MoveName::Trop_Kick},
+		{"trumpcard"_s, MoveName::Trump_Card},
+		{"twinbeam"_s, MoveName::Twin_Beam},
+		{"twineedle"_s, MoveName::Twineedle},
+		{"twinkletackle"_s, MoveName::Twinkle_Tackle},
+		{"twister"_s, MoveName::Twister},
+		{"upperhand"_s, MoveName::Upper_Hand},
+		{"uproar"_s, MoveName::Uproar},
+		{"uturn"_s, MoveName::U_turn},
+		{"vacuumwave"_s, MoveName::Vacuum_Wave},
+		{"vcreate"_s, MoveName::V_create},
+		{"venomdrench"_s, MoveName::Venom_Drench},
+		{"venoshock"_s, MoveName::Venoshock},
+		{"vicegrip"_s, MoveName::Vise_Grip},
+		{"vinewhip"_s, MoveName::Vine_Whip},
+		{"visegrip"_s, MoveName::Vise_Grip},
+		{"vitalthrow"_s, MoveName::Vital_Throw},
+		{"voltswitch"_s, MoveName::Volt_Switch},
+		{"volttackle"_s, MoveName::Volt_Tackle},
+		{"wakeupslap"_s, MoveName::Wake_Up_Slap},
+		{"waterfall"_s, MoveName::Waterfall},
+		{"watergun"_s, MoveName::Water_Gun},
+		{"waterpledge"_s, MoveName::Water_Pledge},
+		{"waterpulse"_s, MoveName::Water_Pulse},
+		{"watershuriken"_s, MoveName::Water_Shuriken},
+		{"watersport"_s, MoveName::Water_Sport},
+		{"waterspout"_s, MoveName::Water_Spout},
+		{"weatherball"_s, MoveName::Weather_Ball},
+		{"whirlpool"_s, MoveName::Whirlpool},
+		{"whirlwind"_s, MoveName::Whirlwind},
+		{"wickedblow"_s, MoveName::Wicked_Blow},
+		{"wickedtorque"_s, MoveName::Wicked_Torque},
+		{"wideguard"_s, MoveName::Wide_Guard},
+		{"wildcharge"_s, MoveName::Wild_Charge},
+		{"willowisp"_s, MoveName::Will_O_Wisp},
+		{"wingattack"_s, MoveName::Wing_Attack},
+		{"wish"_s, MoveName::Wish},
+		{"withdraw"_s, MoveName::Withdraw},
+		{"wonderroom"_s, MoveName::Wonder_Room},
+		{"woodhammer"_s, MoveName::Wood_Hammer},
+		{"workup"_s, MoveName::Work_Up},
+		{"worryseed"_s, MoveName::Worry_Seed},
+		{"wrap"_s, MoveName::Wrap},
+		{"wringout"_s, MoveName::Wring_Out},
+		{"xscissor"_s, MoveName::X_Scissor},
+		{"yawn"_s, MoveName::Yawn},
+		{"zapcannon"_s, MoveName::Zap_Cannon},
+		{"zenheadbutt"_s, MoveName::Zen_Headbutt},
+		{"zingzap"_s, MoveName::Zing_Zap},
+	});
+	// Longer strings are truncated to the length of the longest key
+	auto const result = converter.lookup(containers::take(lowercase_alphanumeric(str), 25_bi));
 	if (!result) {
 		throw InvalidFromStringConversion("Move"_s, str);
 	}
@@ -0,0 +1,90 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <benchmark/benchmark.h>
+
+import tm.move.move_name;
+
+import tm.pokemon.species;
+
+import tm.string_conversions.ability;
+import tm.string_conversions.item;
+import tm.string_conversions.lowercase_alphanumeric;
+import tm.string_conversions.move_name;
+import tm.string_conversions.species;
+
+import tm.ability;
+import tm.item;
+
+import bounded;
+import containers;
+import std_module;
+
+namespace technicalmachine {
+namespace {
+using namespace bounded::literal;
+
+template<typename Enum>
+auto names() -> std::vector<std::string> {
+	auto result = std::vector<std::string>();
+	for (auto const value : containers::enum_range<Enum>()) {
+		auto const str = to_string(value);
+		result.emplace_back(containers::data(str), static_cast<std::size_t>(containers::size(str)));
+	}
+	return result;
+}
+
+template<typename Enum>
+auto from_string_perfect_hash(benchmark::State & state) -> void {
+	auto const inputs = names<Enum>();
+	for (auto _ : state) {
+		for (auto const & input : inputs) {
+			benchmark::DoNotOptimize(from_string<Enum>(containers::string_view(input)));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+}
+
+// What `from_string` did before it used a perfect hash: copy the normalized
+// input into a fixed capacity string and binary search a sorted table.
+template<typename Enum, auto max_size>
+auto from_string_binary_search(benchmark::State & state) -> void {
+	auto const inputs = names<Enum>();
+	auto table = std::vector<std::pair<std::string, Enum>>();
+	for (auto const value : containers::enum_range<Enum>()) {
+		auto const normalized = fixed_capacity_lowercase_and_digit_string<max_size>(to_string(value));
+		auto const view = containers::string_view(normalized);
+		table.emplace_back(std::string(containers::data(view), static_cast<std::size_t>(containers::size(view))), value);
+	}
+	std::ranges::sort(table);
+	for (auto _ : state) {
+		for (auto const & input : inputs) {
+			auto const converted = fixed_capacity_lowercase_and_digit_string<max_size>(containers::string_view(input));
+			auto const view = containers::string_view(converted);
+			auto const key = std::string_view(containers::data(view), static_cast<std::size_t>(containers::size(view)));
+			auto const it = std::ranges::lower_bound(table, key, {}, [](auto const & element) -> std::string_view {
+				return element.first;
+			});
+			if (it == table.end() or it->first != key) {
+				state.SkipWithError("Missing key");
+				return;
+			}
+			benchmark::DoNotOptimize(it->second);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputs.size()));
+}
+
+BENCHMARK(from_string_perfect_hash<Species>);
+BENCHMARK(from_string_binary_search<Species, 22_bi>);
+BENCHMARK(from_string_perfect_hash<MoveName>);
+BENCHMARK(from_string_binary_search<MoveName, 25_bi>);
+BENCHMARK(from_string_perfect_hash<Item>);
+BENCHMARK(from_string_binary_search<Item, 15_bi>);
+BENCHMARK(from_string_perfect_hash<Ability>);
+BENCHMARK(from_string_binary_search<Ability, 15_bi>);
+
+} // namespace
+} // namespace technicalmachine
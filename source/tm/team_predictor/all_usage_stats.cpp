@@ -14,8 +14,8 @@ import tm.get_directory;
 import tm.open_file;
 
 import bounded;
+import concurrent;
 import containers;
-import numeric_traits;
 import std_module;
 
 namespace technicalmachine {
@@ -32,31 +32,149 @@ export using StatsForGeneration = containers::trivial_inplace_function<
 	0
 >;
 
+export using LoadedUsageStats = std::shared_ptr<UsageStats const>;
+
+// Usage stats for a generation are loaded the first time they are requested.
+// If more than `max_loaded` generations are loaded, the least recently used
+// generation is unloaded. Anyone still holding a `LoadedUsageStats` for it
+// keeps it alive. All member functions are safe to call concurrently.
 export struct AllUsageStats {
-	explicit AllUsageStats(StatsForGeneration const make):
-		m_all_stats{
-			make(Generation::one),
-			make(Generation::two),
-			make(Generation::three),
-			make(Generation::four),
-			make(Generation::five),
-			make(Generation::six),
-			make(Generation::seven),
-			make(Generation::eight)
-		}
+	static constexpr auto all_generations = static_cast<std::size_t>(bounded::number_of<Generation>);
+
+	explicit AllUsageStats(StatsForGeneration const make, std::size_t const max_loaded = all_generations):
+		m_state(std::make_unique<State>(make, max_loaded))
 	{
-		static_assert(numeric_traits::max_value<Generation> == Generation::eight);
+		if (max_loaded == 0U) {
+			throw std::runtime_error("Must allow at least one generation of usage stats to be loaded");
+		}
 	}
 	AllUsageStats():
 		AllUsageStats(stats_for_generation)
 	{
 	}
-	auto operator[](Generation const generation) const -> UsageStats const & {
-		return m_all_stats[bounded::integer(generation) - 1_bi];
+
+	auto operator[](Generation const generation) const -> LoadedUsageStats {
+		return m_state->get(generation);
+	}
+
+	// Starts loading in the background. Generations that are already loaded
+	// or waiting to load are skipped. Errors are not reported here, they are
+	// reported by the next call to `operator[]` for that generation.
+	auto prefetch(Generation const generation) const -> void {
+		m_state->prefetch(generation);
 	}
 
 private:
-	containers::array<UsageStats, bounded::number_of<Generation>> m_all_stats;
+	struct Slot {
+		std::mutex load_mutex;
+		LoadedUsageStats stats;
+		std::uint64_t last_used = 0U;
+		bool prefetching = false;
+	};
+
+	struct State {
+		State(StatsForGeneration const make_, std::size_t const max_loaded_):
+			make(make_),
+			max_loaded(max_loaded_)
+		{
+		}
+
+		auto get(Generation const generation) -> LoadedUsageStats {
+			auto & slot = slots[bounded::integer(generation) - 1_bi];
+			if (auto stats = find(slot)) {
+				return stats;
+			}
+			// Only one thread loads any given generation, but different
+			// generations can load at the same time
+			auto const load_lock = std::scoped_lock(slot.load_mutex);
+			if (auto stats = find(slot)) {
+				return stats;
+			}
+			auto stats = std::make_shared<UsageStats const>(make(generation));
+			auto const lock = std::scoped_lock(mutex);
+			slot.stats = stats;
+			slot.last_used = ++clock;
+			evict();
+			return stats;
+		}
+
+		auto prefetch(Generation const generation) -> void {
+			{
+				auto const lock = std::scoped_lock(mutex);
+				auto & slot = slots[bounded::integer(generation) - 1_bi];
+				if (slot.stats or slot.prefetching) {
+					return;
+				}
+				slot.prefetching = true;
+				// There is one loader thread, started by the first prefetch
+				if (!loader.joinable()) {
+					loader = std::jthread([this](std::stop_token token) {
+						auto buffer = typename Queue::container_type();
+						while (!token.stop_requested()) {
+							buffer = queue.pop_all(token, std::move(buffer));
+							for (auto const queued : buffer) {
+								load_in_background(queued);
+							}
+							buffer.clear();
+						}
+					});
+				}
+			}
+			queue.push(generation);
+		}
+
+		StatsForGeneration make;
+		std::size_t max_loaded;
+		std::mutex mutex;
+		containers::array<Slot, bounded::number_of<Generation>> slots;
+		std::uint64_t clock = 0U;
+		// Each generation is in the queue at most once
+		using Queue = concurrent::blocking_queue<Generation>;
+		Queue queue = Queue(static_cast<std::size_t>(bounded::number_of<Generation>));
+		// Declared last so the thread is joined before anything it uses is
+		// destroyed
+		std::jthread loader;
+
+	private:
+		auto load_in_background(Generation const generation) -> void {
+			try {
+				get(generation);
+			} catch (...) {
+			}
+			auto const lock = std::scoped_lock(mutex);
+			slots[bounded::integer(generation) - 1_bi].prefetching = false;
+		}
+
+		auto find(Slot & slot) -> LoadedUsageStats {
+			auto const lock = std::scoped_lock(mutex);
+			if (slot.stats) {
+				slot.last_used = ++clock;
+			}
+			return slot.stats;
+		}
+
+		auto evict() -> void {
+			while (true) {
+				auto loaded = std::size_t(0);
+				Slot * oldest = nullptr;
+				for (auto & slot : slots) {
+					if (!slot.stats) {
+						continue;
+					}
+					++loaded;
+					if (!oldest or slot.last_used < oldest->last_used) {
+						oldest = std::addressof(slot);
+					}
+				}
+				if (loaded <= max_loaded) {
+					return;
+				}
+				oldest->stats.reset();
+			}
+		}
+	};
+
+	std::unique_ptr<State> m_state;
 };
 
 } // namespace technicalmachine
@@ -0,0 +1,113 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+import tm.team_predictor.batch.predict_teams;
+
+import tm.team_predictor.server.parse_predictor_inputs;
+import tm.team_predictor.server.predictor_inputs;
+import tm.team_predictor.server.style;
+
+import tm.team_predictor.all_usage_stats;
+
+import tm.string_conversions.generation;
+
+import tm.generation;
+import tm.open_file;
+
+import bounded;
+import containers;
+import std_module;
+
+using namespace technicalmachine;
+using namespace bounded::literal;
+using namespace containers::string_literals;
+
+namespace {
+
+constexpr auto usage =
+	"Usage is one of\n"
+	"\tteam_predictor_batch text|packed seed input_file\n"
+	"\tteam_predictor_batch text|packed seed random generation count\n"
+	"input_file has one team per line, in the same JSON format the predictor server accepts\n";
+
+using Seed = bounded::integer<0, 2'147'483'647>;
+using TeamCount = bounded::integer<0, 100'000'000>;
+
+struct ParsedArgs {
+	BatchOutputFormat format;
+	std::uint32_t seed;
+	containers::vector<PredictorInputs> inputs;
+};
+
+auto parse_format(std::string_view const str) -> BatchOutputFormat {
+	if (str == "text") {
+		return BatchOutputFormat::text;
+	} else if (str == "packed") {
+		return BatchOutputFormat::packed;
+	} else {
+		throw std::runtime_error(usage);
+	}
+}
+
+auto read_inputs(std::filesystem::path const & path) -> containers::vector<PredictorInputs> {
+	auto file = open_text_file_for_reading(path);
+	auto result = containers::vector<PredictorInputs>();
+	auto line = std::string();
+	while (std::getline(file, line)) {
+		if (line.empty()) {
+			continue;
+		}
+		containers::push_back(result, parse_predictor_inputs(line));
+	}
+	return result;
+}
+
+auto random_inputs(Generation const generation, TeamCount const count) -> containers::vector<PredictorInputs> {
+	return containers::vector<PredictorInputs>(containers::repeat_n(
+		count,
+		PredictorInputs(generation, Style::random, PredictorTeam())
+	));
+}
+
+auto parse_args(int argc, char const * const * argv) -> ParsedArgs {
+	if (argc != 4 and argc != 6) {
+		throw std::runtime_error(usage);
+	}
+	auto const format = parse_format(argv[1]);
+	auto const seed = static_cast<std::uint32_t>(bounded::to_integer<Seed>(containers::string_view(argv[2])));
+	if (argc == 4) {
+		return ParsedArgs(format, seed, read_inputs(argv[3]));
+	}
+	if (std::string_view(argv[3]) != "random") {
+		throw std::runtime_error(usage);
+	}
+	return ParsedArgs(
+		format,
+		seed,
+		random_inputs(
+			from_string<Generation>(containers::string_view(argv[4])),
+			bounded::to_integer<TeamCount>(containers::string_view(argv[5]))
+		)
+	);
+}
+
+} // namespace
+
+auto main(int argc, char ** argv) -> int {
+	auto const args = parse_args(argc, argv);
+	auto const all_usage_stats = AllUsageStats();
+	auto const teams = predict_teams(
+		all_usage_stats,
+		args.inputs,
+		args.seed,
+		args.format,
+		std::max(std::thread::hardware_concurrency(), 1U)
+	);
+	auto const separator = args.format == BatchOutputFormat::text ? "\n\n" : "\n";
+	for (auto const & team : teams) {
+		std::cout << std::string_view(team) << separator;
+	}
+	return 0;
+}
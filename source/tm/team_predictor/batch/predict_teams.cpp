@@ -0,0 +1,107 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.team_predictor.batch.predict_teams;
+
+import tm.clients.ps.to_packed_format;
+
+import tm.ps_usage_stats.parallel_for_each;
+import tm.ps_usage_stats.thread_count;
+
+import tm.string_conversions.team;
+
+import tm.team_predictor.server.predicted_team_string;
+import tm.team_predictor.server.predictor_inputs;
+
+import tm.team_predictor.all_usage_stats;
+import tm.team_predictor.usage_stats;
+
+import tm.constant_generation;
+import tm.generation;
+import tm.generation_generic;
+import tm.team;
+
+import bounded;
+import containers;
+import std_module;
+
+namespace technicalmachine {
+using namespace containers::string_literals;
+
+export enum class BatchOutputFormat {
+	// The same format the predictor server responds with
+	text,
+	// https://github.com/smogon/pokemon-showdown/blob/master/sim/TEAMS.md#packed-format
+	packed
+};
+
+auto predict_one(
+	PredictorInputs const & inputs,
+	UsageStats const & usage_stats,
+	std::mt19937 & random_engine,
+	BatchOutputFormat const format
+) -> containers::string {
+	return constant_generation(inputs.generation, [&]<Generation g>(constant_gen_t<g>) -> containers::string {
+		auto const team = predicted_team<g>(inputs, usage_stats, random_engine);
+		switch (format) {
+			case BatchOutputFormat::text: {
+				constexpr auto include_active_marker = false;
+				return to_string(team, include_active_marker);
+			}
+			case BatchOutputFormat::packed:
+				return ps::to_packed_format(GenerationGeneric<KnownTeam>(KnownTeam<g>(team)));
+		}
+	});
+}
+
+// Each team gets its own random engine, seeded from `seed` and its index, so
+// the results do not depend on how many threads there are or how the work was
+// split between them. If any prediction fails, the remaining teams are skipped
+// and the first error is thrown once every thread has stopped.
+export auto predict_teams(
+	AllUsageStats const & all_usage_stats,
+	containers::vector<PredictorInputs> const & inputs,
+	std::uint32_t const seed,
+	BatchOutputFormat const format,
+	std::size_t const thread_count
+) -> containers::vector<containers::string> {
+	auto results = containers::vector<containers::string>(containers::repeat_default_n<containers::string>(containers::size(inputs)));
+	auto failed = std::atomic<bool>(false);
+	auto error_mutex = std::mutex();
+	auto error = std::exception_ptr();
+	ps_usage_stats::parallel_for_each(
+		bounded::check_in_range<ps_usage_stats::ThreadCount>(std::max(thread_count, std::size_t(1))),
+		containers::integer_range(containers::size(inputs)),
+		[&](auto const index) {
+			if (failed) {
+				return;
+			}
+			try {
+				auto const & input = containers::at(inputs, index);
+				auto const value = static_cast<std::uint64_t>(index);
+				auto seeds = std::seed_seq({seed, static_cast<std::uint32_t>(value), static_cast<std::uint32_t>(value >> 32U)});
+				auto random_engine = std::mt19937(seeds);
+				containers::at(results, index) = predict_one(input, *all_usage_stats[input.generation], random_engine, format);
+			} catch (std::exception const & ex) {
+				auto const lock = std::scoped_lock(error_mutex);
+				if (!error) {
+					error = std::make_exception_ptr(std::runtime_error(containers::concatenate<std::string>(
+						"Error predicting team "_s,
+						containers::to_string(index),
+						": "_s,
+						containers::string_view(ex.what())
+					)));
+				}
+				failed = true;
+			}
+		}
+	);
+	if (error) {
+		std::rethrow_exception(error);
+	}
+	return results;
+}
+
+} // namespace technicalmachine
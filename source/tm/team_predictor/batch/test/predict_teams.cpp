@@ -0,0 +1,91 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <doctest/doctest.h>
+
+export module tm.team_predictor.batch.test.predict_teams;
+
+import tm.team_predictor.batch.predict_teams;
+
+import tm.team_predictor.server.predictor_inputs;
+import tm.team_predictor.server.style;
+
+import tm.team_predictor.all_usage_stats;
+
+import tm.test.usage_bytes;
+
+import tm.generation;
+
+import bounded;
+import containers;
+import std_module;
+
+namespace technicalmachine {
+namespace {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+
+auto make_all_usage_stats() -> AllUsageStats {
+	return AllUsageStats([](Generation const generation) {
+		return bytes_to_usage_stats(several_species_bytes(generation));
+	});
+}
+
+auto random_inputs(Generation const generation) -> containers::vector<PredictorInputs> {
+	return containers::vector<PredictorInputs>(containers::repeat_n(
+		50_bi,
+		PredictorInputs(generation, Style::random, PredictorTeam())
+	));
+}
+
+TEST_CASE("predict_teams does not depend on the number of threads") {
+	auto const all_usage_stats = make_all_usage_stats();
+	for (auto const generation : {Generation::one, Generation::four}) {
+		auto const inputs = random_inputs(generation);
+		auto const single = predict_teams(all_usage_stats, inputs, 1U, BatchOutputFormat::text, 1U);
+		CHECK(containers::size(single) == containers::size(inputs));
+		// Every input is the same, so this only passes if each prediction
+		// gets its own random engine
+		CHECK(containers::any(single, [&](auto const & team) { return team != containers::front(single); }));
+		for (auto const thread_count : {2U, 3U, 8U}) {
+			CHECK(predict_teams(all_usage_stats, inputs, 1U, BatchOutputFormat::text, thread_count) == single);
+		}
+	}
+}
+
+TEST_CASE("predict_teams depends on the seed") {
+	auto const all_usage_stats = make_all_usage_stats();
+	auto const inputs = random_inputs(Generation::four);
+	auto const first = predict_teams(all_usage_stats, inputs, 1U, BatchOutputFormat::text, 4U);
+	auto const second = predict_teams(all_usage_stats, inputs, 2U, BatchOutputFormat::text, 4U);
+	CHECK(first != second);
+}
+
+TEST_CASE("predict_teams packed format") {
+	auto const all_usage_stats = make_all_usage_stats();
+	auto const teams = predict_teams(all_usage_stats, random_inputs(Generation::one), 1U, BatchOutputFormat::packed, 2U);
+	auto const starts_with_species = [](containers::string const & team) {
+		return
+			containers::starts_with(team, "Alakazam|"_s) or
+			containers::starts_with(team, "Starmie|"_s) or
+			containers::starts_with(team, "Tauros|"_s) or
+			containers::starts_with(team, "Snorlax|"_s);
+	};
+	for (auto const & team : teams) {
+		CHECK(starts_with_species(team));
+	}
+}
+
+TEST_CASE("predict_teams reports errors") {
+	auto const all_usage_stats = AllUsageStats([](Generation) -> UsageStats {
+		throw std::runtime_error("No usage stats");
+	});
+	CHECK_THROWS(predict_teams(all_usage_stats, random_inputs(Generation::one), 1U, BatchOutputFormat::text, 2U));
+}
+
+} // namespace
+} // namespace technicalmachine
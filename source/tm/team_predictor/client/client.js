@@ -1,17 +1,28 @@
 const socket = new WebSocket('ws://' + window.location.hostname + ':46924');
 
-let data = null;
+// Dictionaries are requested one generation at a time, as they are needed
+const data = {};
+const busy_retry_milliseconds = 1000;
 socket.onmessage = function(event) {
 	const parsed = JSON.parse(event.data);
 
 	if (parsed.generations) {
-		data = parsed.generations;
-		populate_generation();
-		send_most_likely_data();
+		populate_generation(parsed.generations);
+	}
+	if (parsed.dictionary) {
+		data[parsed.generation] = parsed.dictionary;
+		if (parsed.generation === selected_generation()) {
+			send_most_likely_data();
+		}
 	}
 	if (parsed.predicted) {
 		display_predicted(parsed.predicted);
 	}
+	// The busy reply does not say which request it answers, so ask again for
+	// the dictionary if we are still waiting on it
+	if (parsed.busy) {
+		setTimeout(request_dictionary, busy_retry_milliseconds);
+	}
 };
 
 const max_pokemon = 6;
@@ -26,7 +37,19 @@ function clear_team() {
 	add_pokemon_button.style.display = 'inline-block';
 }
 
+function selected_generation() {
+	return document.getElementById('generation').value;
+}
+
+function request_dictionary() {
+	const generation = selected_generation();
+	if (!data[generation]) {
+		socket.send(JSON.stringify({ dictionary: generation }));
+	}
+}
+
 document.getElementById('generation').addEventListener('change', clear_team);
+document.getElementById('generation').addEventListener('change', request_dictionary);
 
 function add_elements_to_select(select, object) {
 	for (const element of object) {
@@ -41,12 +64,13 @@ function add_keys_to_select(select, object) {
 	add_elements_to_select(select, Object.keys(object));
 }
 
-function populate_generation() {
+function populate_generation(generations) {
 	const generation = document.getElementById('generation');
 	generation.innerHTML = '';
-	add_keys_to_select(generation, data);
+	add_elements_to_select(generation, generations);
 	generation.value = "1";
 	generate_most_likely_on_change(generation);
+	request_dictionary();
 }
 
 function create_species_input(pokemon, pokemon_data) {
@@ -155,9 +179,11 @@ function create_pokemon_inputs(generation_data) {
 }
 
 add_pokemon_button.addEventListener('click', () => {
-	const generation = document.getElementById('generation').value;
-	const generation_data = data[generation];
-	
+	const generation_data = data[selected_generation()];
+	if (!generation_data) {
+		return;
+	}
+
 	if (get_team().childElementCount < max_pokemon) {
 		get_team().appendChild(create_pokemon_inputs(generation_data));
 	}
@@ -185,6 +211,9 @@ document.addEventListener('keydown', (event) => {
 document.getElementById('generate-most-likely').addEventListener('click', send_most_likely_data);
 
 function send_data(style) {
+	if (!data[selected_generation()]) {
+		return;
+	}
 	socket.send(JSON.stringify(team_to_json(style)));
 }
 
@@ -6,7 +6,6 @@
 module;
 
 #include <bounded/assert.hpp>
-#include <bounded/conditional.hpp>
 
 export module tm.team_predictor.estimate;
 
@@ -14,6 +13,7 @@ import tm.move.move_name;
 
 import tm.pokemon.species;
 
+import tm.team_predictor.key_columns;
 import tm.team_predictor.usage_stats_probabilities;
 import tm.team_predictor.usage_stats;
 
@@ -28,92 +28,180 @@ import std_module;
 
 namespace technicalmachine {
 
-struct PerSpecies {
-	double usage;
-	containers::flat_map<MoveName, double> moves;
-	containers::flat_map<Item, double> items;
-	containers::flat_map<Ability, double> abilities;
+// Walks one species' sorted keys and a sorted map in step. Each value in
+// `dense` is multiplied by `transform(weight)` for the matching key in the
+// map, or by 0 if the map does not have that key.
+constexpr auto scatter_multiply(auto const keys, auto const dense, auto const & map, auto const transform) -> void {
+	auto element = containers::begin(map);
+	auto const last = containers::end(map);
+	for (auto const & [key, value] : containers::zip_smallest(keys, dense)) {
+		while (element != last and element->key < key) {
+			++element;
+		}
+		value *= element != last and element->key == key ? transform(element->mapped) : 0.0;
+	}
+}
+
+constexpr auto to_numerator = [](Weight<float> const weight) {
+	return static_cast<double>(weight);
+};
+constexpr auto to_inverse_base = [](Weight<float> const weight) {
+	return weight == Weight(0.0F) ? 0.0 : 1.0 / static_cast<double>(weight);
 };
 
-constexpr auto update_per_species(auto & data, auto const & per_species, auto const base_per_species) {
-	for (auto & element : data) {
-		auto const base = base_per_species(element.key);
+// How much to scale each value of a column by, laid out like the column. This
+// is 1 for species that are not being updated.
+struct Multipliers {
+	constexpr auto reset(auto const size) & -> void {
+		if (containers::size(values) != size) {
+			values = containers::vector<double>(containers::repeat_n(size, 1.0));
+			return;
+		}
+		for (auto & value : values) {
+			value = 1.0;
+		}
+	}
+
+	// A key with no weight in either map is scaled by the minimum multiplier
+	template<typename Key>
+	constexpr auto scatter_species(KeyColumn<Key> const & column, Slice const slice, auto const & weights, auto const * const base_weights) & -> void {
+		auto const keys = slice_of(column.keys, slice);
+		auto const multipliers = slice_of(values, slice);
+		scatter_multiply(keys, multipliers, weights, to_numerator);
+		if (base_weights) {
+			scatter_multiply(keys, multipliers, *base_weights, to_inverse_base);
+		} else {
+			for (auto & value : multipliers) {
+				value = 0.0;
+			}
+		}
+	}
+
+	// No branches, so this is a single pass of multiplies over dense arrays
+	constexpr auto apply(containers::vector<double> & column_values) const -> void {
 		// If users do something very surprising, we don't want to lower the
 		// odds of everything to 0.
-		auto const multiplier = bounded::max(
-			base == Weight(0.0F) ? 0.0 : static_cast<double>(per_species(element.key) / base),
-			1.0 / 1'000'000.0
-		);
-		element.mapped *= multiplier;
+		constexpr auto minimum_multiplier = 1.0 / 1'000'000.0;
+		for (auto const index : containers::integer_range(containers::size(column_values))) {
+			column_values[index] *= bounded::max(values[index], minimum_multiplier);
+		}
 	}
-}
 
-constexpr auto make_per_species(UsageStatsProbabilities::Inner const & probabilities) -> PerSpecies {
-	auto const transformer = [](auto const element) {
-		return containers::map_value_type{element.key, static_cast<double>(element.mapped)};
-	};
-	return PerSpecies{
-		containers::sum(containers::transform(probabilities.moves.map(), [](auto const & element) { return static_cast<double>(element.mapped); })),
-		containers::flat_map<MoveName, double>(containers::transform(probabilities.moves.map(), transformer)),
-		containers::flat_map<Item, double>(containers::transform(probabilities.items.map(), transformer)),
-		containers::flat_map<Ability, double>(containers::transform(probabilities.abilities.map(), transformer))
-	};
-}
+	containers::vector<double> values;
+};
+
+// Reused by every update so that updating does not allocate. Nothing in it
+// is kept between updates, so copying an `Estimate` does not copy it. A copy
+// allocates its own the first time it is updated.
+struct UpdateScratch {
+	constexpr UpdateScratch() = default;
+	constexpr UpdateScratch(UpdateScratch const &):
+		UpdateScratch()
+	{
+	}
+	constexpr UpdateScratch(UpdateScratch &&) = default;
+	constexpr auto operator=(UpdateScratch const &) & -> UpdateScratch & {
+		return *this;
+	}
+	constexpr auto operator=(UpdateScratch &&) & -> UpdateScratch & = default;
+
+	Multipliers moves;
+	Multipliers items;
+	Multipliers abilities;
+};
 
-constexpr auto get_most_likely(containers::range auto const & range) {
-	auto const it = containers::max_element(range);
-	return BOUNDED_CONDITIONAL(it == containers::end(range), tv::none, it.base()->key);
+template<typename Key>
+constexpr auto get_most_likely(auto const keys, auto const values) -> tv::optional<Key> {
+	auto const it = containers::max_element(values);
+	if (it == containers::end(values) or *it <= 0.0) {
+		return tv::none;
+	}
+	return *(containers::begin(keys) + (it - containers::begin(values)));
 }
 
-template<typename T, containers::range Range>
-constexpr auto select_random_by_weight(Range const & range, std::mt19937 & random_engine, auto const transform) -> tv::optional<T> {
-	if (containers::is_empty(range)) {
+template<typename Key>
+constexpr auto select_random_by_weight(auto const keys, auto const values, std::mt19937 & random_engine) -> tv::optional<Key> {
+	auto const total = containers::sum(values);
+	if (total == 0.0) {
 		return tv::none;
 	}
-	auto const total = containers::sum(containers::transform(range, transform));
 	auto distribution = std::uniform_real_distribution(0.0, total);
 	auto usage_threshold = distribution(random_engine);
-	for (auto const & value : range) {
-		usage_threshold -= transform(value);
+	auto result = tv::optional<Key>();
+	for (auto const [key, value] : containers::zip_smallest(keys, values)) {
+		if (value == 0.0) {
+			continue;
+		}
+		result = key;
+		usage_threshold -= value;
 		if (usage_threshold <= 0.0) {
-			return value.key;
+			break;
 		}
 	}
-	// In case rounding leads to a minor error
-	return containers::back(range).key;
+	// In case rounding leads to a minor error, this is the last possible value
+	return result;
 }
 
-constexpr auto per_species_to_usage = [](auto const & value) {
-	return value.mapped.usage;
+export template<typename Key>
+struct WeightedChoice {
+	Key key;
+	// Share of the total weight of all choices
+	double probability;
 };
 
-export struct Estimate {
-	using Map = containers::flat_map<Species, PerSpecies>;
+// Every choice with a nonzero weight, most likely first
+template<typename Key>
+constexpr auto get_weighted_choices(auto const keys, auto const values) -> containers::vector<WeightedChoice<Key>> {
+	auto result = containers::vector<WeightedChoice<Key>>();
+	auto const total = containers::sum(values);
+	if (total <= 0.0) {
+		return result;
+	}
+	for (auto const [key, value] : containers::zip_smallest(keys, values)) {
+		if (value > 0.0) {
+			containers::push_back(result, WeightedChoice<Key>(key, value / total));
+		}
+	}
+	containers::sort(result, [](WeightedChoice<Key> const lhs, WeightedChoice<Key> const rhs) {
+		return lhs.probability > rhs.probability;
+	});
+	return result;
+}
+
+// The value of `key` within one species' part of a column
+template<typename Key>
+constexpr auto find_value(KeyColumn<Key> const & column, auto & values, Slice const slice, Key const key) -> decltype(std::addressof(*containers::begin(values))) {
+	auto const keys = slice_of(column.keys, slice);
+	auto const it = containers::find(keys, key);
+	if (it == containers::end(keys)) {
+		return nullptr;
+	}
+	return std::addressof(*(containers::begin(slice_of(values, slice)) + (it - containers::begin(keys))));
+}
+
+constexpr auto species_key = [](auto const & value) {
+	return value.key;
+};
 
+// The keys come from `UsageStats`, which must outlive this. Copying an
+// `Estimate` copies only the values.
+export struct Estimate {
 	explicit constexpr Estimate(UsageStats const & usage_stats):
-		m_estimate(containers::transform(usage_stats.assuming().map(), [](auto const & value) {
-			return containers::map_value_type{value.key, make_per_species(value.mapped)};
-		}))
+		m_columns(std::addressof(usage_stats.columns())),
+		m_usage(containers::transform(m_columns->species, [](auto const & value) {
+			return value.mapped.initial_usage;
+		})),
+		m_moves(m_columns->moves.initial_values),
+		m_items(m_columns->items.initial_values),
+		m_abilities(m_columns->abilities.initial_values)
 	{
-		auto check = [](auto const & range) {
-			for (auto const & element : range) {
-				BOUNDED_ASSERT(element.mapped > 0.0);
-			}
-		};
-		for (auto const & per_species : m_estimate) {
-			BOUNDED_ASSERT(per_species.mapped.usage > 0.0);
-			BOUNDED_ASSERT(!containers::is_empty(per_species.mapped.moves));
-			check(per_species.mapped.moves);
-			check(per_species.mapped.items);
-			check(per_species.mapped.abilities);
-		}
 	}
 	constexpr auto update(UsageStats const & usage_stats, Species const species) -> void {
 		if (auto const probabilities = usage_stats.assuming(species)) {
 			do_update(*probabilities, usage_stats.assuming());
 		}
-		if (auto const species_data = containers::lookup(m_estimate, species)) {
-			species_data->usage = 0.0;
+		if (auto const usage = find_usage(species)) {
+			*usage = 0.0;
 		}
 	}
 	constexpr auto update(UsageStats const & usage_stats, Species const species, MoveName const move) -> void {
@@ -122,8 +210,10 @@ export struct Estimate {
 			BOUNDED_ASSERT(base_probabilities);
 			do_update(*probabilities, *base_probabilities);
 		}
-		if (auto const species_data = containers::lookup(m_estimate, species)) {
-			containers::keyed_erase(species_data->moves, move);
+		if (auto const keys = containers::lookup(m_columns->species, species)) {
+			if (auto const value = find_value(m_columns->moves, m_moves, keys->moves, move)) {
+				*value = 0.0;
+			}
 		}
 	}
 	constexpr auto update(UsageStats const &, Species, Item) -> void {
@@ -132,103 +222,167 @@ export struct Estimate {
 	}
 
 	constexpr auto most_likely_species() const -> tv::optional<Species> {
-		return get_most_likely(containers::transform(m_estimate, per_species_to_usage));
+		return get_most_likely<Species>(species_keys(), m_usage);
 	}
 	constexpr auto random_species(std::mt19937 & random_engine) const -> tv::optional<Species> {
-		return select_random_by_weight<Species>(m_estimate, random_engine, per_species_to_usage);
+		return select_random_by_weight<Species>(species_keys(), m_usage, random_engine);
+	}
+
+	constexpr auto species_choices() const -> containers::vector<WeightedChoice<Species>> {
+		return get_weighted_choices<Species>(species_keys(), m_usage);
 	}
 
 	constexpr auto most_likely_move(Species const species) const -> tv::optional<MoveName> {
-		auto const ptr = containers::lookup(m_estimate, species);
-		if (!ptr) {
-			return tv::none;
-		}
-		return get_most_likely(containers::transform(ptr->moves, containers::get_mapped));
+		return most_likely(m_columns->moves, m_moves, species, &SpeciesKeys::moves);
 	}
 	constexpr auto random_move(std::mt19937 & random_engine, Species const species) const -> tv::optional<MoveName> {
-		auto const element = containers::lookup(m_estimate, species);
-		if (!element) {
-			return tv::none;
-		}
-		return select_random_by_weight<MoveName>(element->moves, random_engine, containers::get_mapped);
+		return random(m_columns->moves, m_moves, random_engine, species, &SpeciesKeys::moves);
+	}
+
+	constexpr auto move_choices(Species const species) const -> containers::vector<WeightedChoice<MoveName>> {
+		return choices(m_columns->moves, m_moves, species, &SpeciesKeys::moves);
 	}
 
 	constexpr auto most_likely_item(Species const species) const -> tv::optional<Item> {
-		auto const ptr = containers::lookup(m_estimate, species);
-		if (!ptr) {
-			return tv::none;
-		}
-		return get_most_likely(containers::transform(ptr->items, containers::get_mapped));
+		return most_likely(m_columns->items, m_items, species, &SpeciesKeys::items);
 	}
 	constexpr auto random_item(std::mt19937 & random_engine, Species const species) const -> tv::optional<Item> {
-		auto const element = containers::lookup(m_estimate, species);
-		if (!element) {
-			return tv::none;
-		}
-		return select_random_by_weight<Item>(element->items, random_engine, containers::get_mapped);
+		return random(m_columns->items, m_items, random_engine, species, &SpeciesKeys::items);
+	}
+
+	constexpr auto item_choices(Species const species) const -> containers::vector<WeightedChoice<Item>> {
+		return choices(m_columns->items, m_items, species, &SpeciesKeys::items);
 	}
 
 	constexpr auto most_likely_ability(Species const species) const -> tv::optional<Ability> {
-		auto const ptr = containers::lookup(m_estimate, species);
-		if (!ptr) {
-			return tv::none;
-		}
-		return get_most_likely(containers::transform(ptr->abilities, containers::get_mapped));
+		return most_likely(m_columns->abilities, m_abilities, species, &SpeciesKeys::abilities);
 	}
 	constexpr auto random_ability(std::mt19937 & random_engine, Species const species) const -> tv::optional<Ability> {
-		auto const element = containers::lookup(m_estimate, species);
-		if (!element) {
-			return tv::none;
-		}
-		return select_random_by_weight<Ability>(element->abilities, random_engine, containers::get_mapped);
+		return random(m_columns->abilities, m_abilities, random_engine, species, &SpeciesKeys::abilities);
+	}
+
+	constexpr auto ability_choices(Species const species) const -> containers::vector<WeightedChoice<Ability>> {
+		return choices(m_columns->abilities, m_abilities, species, &SpeciesKeys::abilities);
 	}
 
 	constexpr auto probability(Species const species) const -> double {
-		auto const per_species = containers::lookup(m_estimate, species);
-		return per_species ? per_species->usage : 0.0;
+		auto const usage = find_usage(species);
+		return usage ? *usage : 0.0;
 	}
 	constexpr auto probability(Species const species, MoveName const move) const -> double {
-		auto const per_species = containers::lookup(m_estimate, species);
-		if (!per_species) {
+		auto const keys = containers::lookup(m_columns->species, species);
+		if (!keys) {
 			return 0.0;
 		}
-		auto per_move = containers::lookup(per_species->moves, move);
-		return per_move ? *per_move : 0.0;
+		auto const value = find_value(m_columns->moves, m_moves, keys->moves, move);
+		return value ? *value : 0.0;
 	}
 
 private:
+	constexpr auto species_keys() const {
+		return containers::transform(m_columns->species, species_key);
+	}
+
+	constexpr auto find_usage(this auto & self, Species const species) -> decltype(std::addressof(containers::front(self.m_usage))) {
+		auto const keys = containers::lookup(self.m_columns->species, species);
+		if (!keys) {
+			return nullptr;
+		}
+		return std::addressof(containers::at(self.m_usage, keys->index));
+	}
+
+	template<typename Key>
+	constexpr auto most_likely(KeyColumn<Key> const & column, containers::vector<double> const & values, Species const species, auto const member) const -> tv::optional<Key> {
+		auto const keys = containers::lookup(m_columns->species, species);
+		if (!keys) {
+			return tv::none;
+		}
+		auto const slice = std::invoke(member, *keys);
+		return get_most_likely<Key>(slice_of(column.keys, slice), slice_of(values, slice));
+	}
+
+	template<typename Key>
+	constexpr auto choices(KeyColumn<Key> const & column, containers::vector<double> const & values, Species const species, auto const member) const -> containers::vector<WeightedChoice<Key>> {
+		auto const keys = containers::lookup(m_columns->species, species);
+		if (!keys) {
+			return {};
+		}
+		auto const slice = std::invoke(member, *keys);
+		return get_weighted_choices<Key>(slice_of(column.keys, slice), slice_of(values, slice));
+	}
+
+	template<typename Key>
+	constexpr auto random(KeyColumn<Key> const & column, containers::vector<double> const & values, std::mt19937 & random_engine, Species const species, auto const member) const -> tv::optional<Key> {
+		auto const keys = containers::lookup(m_columns->species, species);
+		if (!keys) {
+			return tv::none;
+		}
+		auto const slice = std::invoke(member, *keys);
+		return select_random_by_weight<Key>(slice_of(column.keys, slice), slice_of(values, slice), random_engine);
+	}
+
+	// Collects the multiplier for every value first, so that the values are
+	// all scaled in one branch-free pass per column
 	constexpr auto do_update(UsageStatsProbabilities const & probability, UsageStatsProbabilities const & base_probability) & -> void {
-		for (auto & per_species : m_estimate) {
+		auto & moves = m_scratch.moves;
+		auto & items = m_scratch.items;
+		auto & abilities = m_scratch.abilities;
+		moves.reset(containers::size(m_moves));
+		items.reset(containers::size(m_items));
+		abilities.reset(containers::size(m_abilities));
+		// Both maps are sorted by species, like the columns
+		auto species_estimate = containers::begin(probability.map());
+		auto const species_estimate_last = containers::end(probability.map());
+		for (auto const & [per_species, usage] : containers::zip_smallest(m_columns->species, m_usage)) {
 			auto const species = per_species.key;
-			auto const species_estimate = containers::lookup(probability.map(), species);
-			if (!species_estimate) {
-				per_species.mapped.usage = 0.0;
+			while (species_estimate != species_estimate_last and species_estimate->key < species) {
+				++species_estimate;
+			}
+			if (species_estimate == species_estimate_last or species_estimate->key != species) {
+				usage = 0.0;
 				continue;
 			}
+			auto const & estimate = species_estimate->mapped;
 			auto const base_per_species = base_probability(species);
-			update_per_species(
-				per_species.mapped.moves,
-				species_estimate->moves,
-				[=](MoveName const move) { return base_per_species ? base_per_species->moves(move) : Weight(0.0F); }
+			auto const & keys = per_species.mapped;
+			moves.scatter_species(
+				m_columns->moves,
+				keys.moves,
+				estimate.moves.map(),
+				base_per_species ? std::addressof(base_per_species->moves.map()) : nullptr
 			);
-			update_per_species(
-				per_species.mapped.items,
-				species_estimate->items,
-				[=](Item const item) { return base_per_species ? base_per_species->items(item) : Weight(0.0F); }
+			items.scatter_species(
+				m_columns->items,
+				keys.items,
+				estimate.items.map(),
+				base_per_species ? std::addressof(base_per_species->items.map()) : nullptr
 			);
-			update_per_species(
-				per_species.mapped.abilities,
-				species_estimate->abilities,
-				[=](Ability const ability) { return base_per_species ? base_per_species->abilities(ability) : Weight(0.0F); }
+			abilities.scatter_species(
+				m_columns->abilities,
+				keys.abilities,
+				estimate.abilities.map(),
+				base_per_species ? std::addressof(base_per_species->abilities.map()) : nullptr
 			);
-			per_species.mapped.usage =
-				per_species.mapped.usage == 0.0 ?
-				0.0 :
-				containers::sum(containers::transform(per_species.mapped.moves, containers::get_mapped));
+		}
+		moves.apply(m_moves);
+		items.apply(m_items);
+		abilities.apply(m_abilities);
+		// Species that were ruled out above keep a usage of 0
+		for (auto const & [per_species, usage] : containers::zip_smallest(m_columns->species, m_usage)) {
+			if (usage != 0.0) {
+				usage = containers::sum(slice_of(m_moves, per_species.mapped.moves));
+			}
 		}
 	}
 
-	Map m_estimate;
+	KeyColumns const * m_columns;
+	// Each value lines up with the key in the same position of `m_columns`. A
+	// value of 0 means it has been ruled out.
+	containers::vector<double> m_usage;
+	containers::vector<double> m_moves;
+	containers::vector<double> m_items;
+	containers::vector<double> m_abilities;
+	UpdateScratch m_scratch;
 };
 
 } // namespace technicalmachine
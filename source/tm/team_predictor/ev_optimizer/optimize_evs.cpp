@@ -14,18 +14,24 @@ import tm.pokemon.species;
 
 import tm.stat.base_stats;
 import tm.stat.combined_stats;
+import tm.stat.generic_stats;
 import tm.stat.make_stats;
 import tm.stat.stat_style;
 import tm.stat.stats;
 
+import tm.stat.nature;
+
+import tm.type.type;
+
 import tm.generation;
 
+import std_module;
 import tv;
 
 namespace technicalmachine {
 
-export template<Generation generation>
-auto optimize_evs(
+template<Generation generation>
+auto optimize_evs_uncached(
 	CombinedStatsFor<generation> combined,
 	Species const species,
 	Level const level,
@@ -45,4 +51,114 @@ auto optimize_evs(
 	}
 }
 
+template<Generation generation>
+struct OptimizeEVsInputs {
+	CombinedStatsFor<generation> combined;
+	Species species;
+	Level level;
+	tv::optional<HiddenPower<generation>> hidden_power;
+	bool include_attack;
+	bool include_special_attack;
+
+	friend auto operator==(OptimizeEVsInputs const &, OptimizeEVsInputs const &) -> bool = default;
+};
+
+template<typename HP, typename Stat>
+constexpr auto combine_stats(auto const combine, GenericStats<HP, Stat> const stats) -> void {
+	for (auto const stat : {stats.hp, stats.atk, stats.def, stats.spa, stats.spd, stats.spe}) {
+		combine(static_cast<std::size_t>(stat.value()));
+	}
+}
+template<typename HP, typename Stat>
+constexpr auto combine_stats(auto const combine, GenericCombinedStats<HP, Stat> const stats) -> void {
+	for (auto const stat : {stats.hp, stats.atk, stats.def, stats.spe, stats.spc}) {
+		combine(static_cast<std::size_t>(stat.value()));
+	}
+}
+template<typename Stat>
+constexpr auto combine_stats(auto const combine, GenericDVStats<Stat> const stats) -> void {
+	for (auto const stat : {stats.atk, stats.def, stats.spe, stats.spc}) {
+		combine(static_cast<std::size_t>(stat.value()));
+	}
+}
+
+struct OptimizeEVsInputsHash {
+	template<Generation generation>
+	static auto operator()(OptimizeEVsInputs<generation> const & inputs) -> std::size_t {
+		auto result = std::hash<Species>()(inputs.species);
+		auto combine = [&](std::size_t const value) {
+			result ^= value + 0x9E37'79B9'7F4A'7C15U + (result << 6U) + (result >> 2U);
+		};
+		combine(static_cast<std::size_t>(inputs.level()));
+		combine(std::hash<Nature>()(inputs.combined.nature));
+		combine_stats(combine, inputs.combined.dvs_or_ivs);
+		combine_stats(combine, inputs.combined.evs);
+		combine(static_cast<std::size_t>(static_cast<bool>(inputs.hidden_power)));
+		if (inputs.hidden_power) {
+			// The power is almost always determined by the IVs, which are
+			// already part of the hash
+			combine(std::hash<Type>()(inputs.hidden_power->type()));
+		}
+		combine(static_cast<std::size_t>(inputs.include_attack) * 2U + static_cast<std::size_t>(inputs.include_special_attack));
+		return result;
+	}
+};
+
+// The same sets are predicted over and over, so remember every result. Once
+// the cache is full it starts over rather than tracking what is least
+// recently used.
+template<Generation generation>
+struct OptimizeEVsCache {
+	auto get(OptimizeEVsInputs<generation> const & inputs) -> CombinedStatsFor<generation> {
+		{
+			auto const lock = std::shared_lock(m_mutex);
+			auto const it = m_results.find(inputs);
+			if (it != m_results.end()) {
+				return it->second;
+			}
+		}
+		auto const result = optimize_evs_uncached(
+			inputs.combined,
+			inputs.species,
+			inputs.level,
+			inputs.hidden_power,
+			inputs.include_attack,
+			inputs.include_special_attack
+		);
+		auto const lock = std::unique_lock(m_mutex);
+		if (m_results.size() >= max_size) {
+			m_results.clear();
+		}
+		m_results.emplace(inputs, result);
+		return result;
+	}
+
+private:
+	static constexpr auto max_size = std::size_t(100'000);
+	std::shared_mutex m_mutex;
+	std::unordered_map<OptimizeEVsInputs<generation>, CombinedStatsFor<generation>, OptimizeEVsInputsHash> m_results;
+};
+
+// The result depends only on the arguments. Safe to call from multiple threads
+// at once.
+export template<Generation generation>
+auto optimize_evs(
+	CombinedStatsFor<generation> const combined,
+	Species const species,
+	Level const level,
+	tv::optional<HiddenPower<generation>> const hidden_power,
+	bool const include_attack,
+	bool const include_special_attack
+) -> CombinedStatsFor<generation> {
+	static auto cache = OptimizeEVsCache<generation>();
+	return cache.get(OptimizeEVsInputs<generation>(
+		combined,
+		species,
+		level,
+		hidden_power,
+		include_attack,
+		include_special_attack
+	));
+}
+
 } // namespace technicalmachine
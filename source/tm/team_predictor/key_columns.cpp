@@ -0,0 +1,108 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <bounded/assert.hpp>
+
+export module tm.team_predictor.key_columns;
+
+import tm.move.move_name;
+
+import tm.pokemon.species;
+
+import tm.team_predictor.usage_stats_probabilities;
+
+import tm.ability;
+import tm.item;
+import tm.weight;
+
+import bounded;
+import containers;
+import std_module;
+
+namespace technicalmachine {
+using namespace bounded::literal;
+
+export using ColumnOffset = containers::range_size_t<containers::vector<double>>;
+
+// The part of a column that belongs to one species
+export struct Slice {
+	ColumnOffset offset;
+	ColumnOffset size;
+};
+
+export constexpr auto slice_of(auto & range, Slice const slice) {
+	auto const first = containers::begin(range) + slice.offset;
+	return containers::subrange(first, first + slice.size);
+}
+
+// All of the keys of one kind (moves, items, or abilities) for every species,
+// stored in one contiguous array. Each species' keys are sorted.
+export template<typename Key>
+struct KeyColumn {
+	constexpr auto append(auto const & map) & -> Slice {
+		auto const offset = bounded::assume_in_range<ColumnOffset>(containers::size(initial_values));
+		for (auto const & element : map) {
+			BOUNDED_ASSERT(element.mapped > Weight(0.0F));
+			containers::push_back(keys, element.key);
+			containers::push_back(initial_values, static_cast<double>(element.mapped));
+		}
+		return Slice(
+			offset,
+			bounded::assume_in_range<ColumnOffset>(containers::size(initial_values) - offset)
+		);
+	}
+
+	containers::vector<Key> keys;
+	containers::vector<double> initial_values;
+};
+
+export struct SpeciesKeys {
+	// Position of the species within `KeyColumns::species`
+	ColumnOffset index;
+	double initial_usage;
+	Slice moves;
+	Slice items;
+	Slice abilities;
+};
+
+// The layout of an `Estimate`. This depends only on the usage stats, so it is
+// built once when they are loaded, and each `Estimate` stores only the values.
+export struct KeyColumns {
+	explicit KeyColumns(UsageStatsProbabilities const & probabilities):
+		species(containers::transform(probabilities.map(), [&](auto const & value) {
+			auto const & inner = value.mapped;
+			auto const moves_slice = moves.append(inner.moves.map());
+			auto const usage = containers::sum(slice_of(moves.initial_values, moves_slice));
+			BOUNDED_ASSERT(usage > 0.0);
+			return containers::map_value_type{
+				value.key,
+				SpeciesKeys(
+					// Set below, once every species is in place
+					ColumnOffset(0_bi),
+					usage,
+					moves_slice,
+					items.append(inner.items.map()),
+					abilities.append(inner.abilities.map())
+				)
+			};
+		}))
+	{
+		auto index = ColumnOffset(0_bi);
+		for (auto & element : species) {
+			element.mapped.index = index;
+			++index;
+		}
+	}
+
+	// Declared before `species` because constructing `species` fills them
+	KeyColumn<MoveName> moves;
+	KeyColumn<Item> items;
+	KeyColumn<Ability> abilities;
+	containers::flat_map<Species, SpeciesKeys> species;
+};
+
+} // namespace technicalmachine
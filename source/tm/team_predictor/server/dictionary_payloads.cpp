@@ -0,0 +1,76 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.team_predictor.server.dictionary_payloads;
+
+import tm.string_conversions.generation;
+
+import tm.team_predictor.server.make_dictionary;
+
+import tm.team_predictor.all_usage_stats;
+
+import tm.web_server.websocket_server;
+
+import tm.generation;
+import tm.nlohmann_json;
+
+import bounded;
+import containers;
+import std_module;
+
+namespace technicalmachine {
+using namespace bounded::literal;
+
+auto generations_message() -> WebSocketMessage {
+	auto names = nlohmann::json::array();
+	for (auto const generation : containers::enum_range<Generation>()) {
+		names.push_back(std::string_view(to_string(generation)));
+	}
+	return make_websocket_message(containers::string(nlohmann::json({{"generations", names}}).dump()));
+}
+
+auto dictionary_message(Generation const generation, AllUsageStats const & all_usage_stats) -> WebSocketMessage {
+	return make_websocket_message(containers::string(nlohmann::json({
+		{"generation", std::string_view(to_string(generation))},
+		{"dictionary", generation_dictionary(generation, *all_usage_stats[generation])}
+	}).dump()));
+}
+
+// Everything a client needs to fill in its inputs. On connecting, a client is
+// sent just the list of generations. It then asks for the dictionary of each
+// generation it wants to show. Each dictionary is built and serialized the
+// first time it is requested, so starting the server does not load the usage
+// stats of every generation. Safe to call from multiple threads at once.
+export struct DictionaryPayloads {
+	explicit DictionaryPayloads(AllUsageStats const & all_usage_stats):
+		m_all_usage_stats(all_usage_stats),
+		m_generations(generations_message())
+	{
+	}
+
+	auto generations() const -> WebSocketMessage {
+		return m_generations;
+	}
+	// If building the dictionary throws, the next request tries again
+	auto operator[](Generation const generation) const -> WebSocketMessage {
+		auto & slot = m_dictionaries[bounded::integer(generation) - 1_bi];
+		std::call_once(slot.flag, [&] {
+			slot.message = dictionary_message(generation, m_all_usage_stats.get());
+		});
+		return slot.message;
+	}
+
+private:
+	struct Slot {
+		std::once_flag flag;
+		WebSocketMessage message;
+	};
+
+	std::reference_wrapper<AllUsageStats const> m_all_usage_stats;
+	WebSocketMessage m_generations;
+	mutable containers::array<Slot, bounded::number_of<Generation>> m_dictionaries;
+};
+
+} // namespace technicalmachine
@@ -6,52 +6,134 @@
 import tm.web_server.http_server;
 import tm.web_server.websocket_server;
 
-import tm.team_predictor.server.make_dictionary;
+import tm.team_predictor.server.dictionary_payloads;
 import tm.team_predictor.server.parse_predictor_inputs;
 import tm.team_predictor.server.predicted_team_string;
+import tm.team_predictor.server.prediction_cache;
+import tm.team_predictor.server.style;
 
 import tm.team_predictor.all_usage_stats;
 
+import tm.string_conversions.generation;
+
+import tm.generation;
+
 import tm.boost_networking;
 import tm.nlohmann_json;
 
+import bounded;
 import containers;
 import std_module;
 import tv;
 
 using namespace technicalmachine;
+using namespace bounded::literal;
 using namespace containers::string_literals;
 
-auto main() -> int {
+namespace {
+
+using ThreadCount = bounded::integer<1, 1'024>;
+using QueueSize = bounded::integer<1, 1'000'000>;
+
+struct ParsedArgs {
+	ThreadCount io_threads;
+	ThreadCount prediction_threads;
+	QueueSize max_queued_predictions;
+};
+
+auto parse_args(int argc, char const * const * argv) -> ParsedArgs {
+	if (argc == 1) {
+		auto const hardware_threads = bounded::clamp<ThreadCount>(bounded::integer(std::thread::hardware_concurrency()));
+		return ParsedArgs{
+			ThreadCount(1_bi),
+			ThreadCount(hardware_threads),
+			QueueSize(hardware_threads * 16_bi)
+		};
+	}
+	if (argc != 4) {
+		throw std::runtime_error(
+			"Usage is team_predictor_server [io_thread_count prediction_thread_count max_queued_predictions]\n"
+		);
+	}
+	return ParsedArgs{
+		bounded::to_integer<ThreadCount>(containers::string_view(argv[1])),
+		bounded::to_integer<ThreadCount>(containers::string_view(argv[2])),
+		bounded::to_integer<QueueSize>(containers::string_view(argv[3]))
+	};
+}
+
+auto run(boost::asio::io_context & context) -> void {
+	while (true) {
+		try {
+			context.run();
+		} catch (std::exception const & ex) {
+			std::cerr << ex.what() << '\n';
+		}
+	}
+}
+
+} // namespace
+
+auto main(int argc, char ** argv) -> int {
+	auto const args = parse_args(argc, argv);
 	constexpr auto http_port = static_cast<unsigned short>(46923);
 	constexpr auto websocket_port = static_cast<unsigned short>(46924);
 	auto const all_usage_stats = AllUsageStats();
-	auto random_engine = std::mt19937(std::random_device()());
-	auto context = boost::asio::io_context();
+	auto const dictionaries = DictionaryPayloads(all_usage_stats);
+	auto cache = PredictionCache(100'000U);
+	auto context = boost::asio::io_context(static_cast<int>(args.io_threads));
 
+	auto workers = WebSocketWorkers(
+		static_cast<std::size_t>(args.prediction_threads),
+		static_cast<std::size_t>(args.max_queued_predictions),
+		// Tagged so that the client knows to resend a dictionary request
+		containers::string(nlohmann::json({
+			{"busy"_s, true},
+			{"predicted"_s, "The server is busy, try again later"_s}
+		}).dump())
+	);
 	auto http_server = HTTPServer(context, http_port);
 	auto websocket_server = WebSocketServer(
 		context,
 		websocket_port,
-		[&] -> containers::string {
-			return containers::string(make_dictionary(all_usage_stats).dump());
+		[&] -> WebSocketMessage {
+			return dictionaries.generations();
 		},
-		[&](containers::string_view const str) -> containers::string {
-			return containers::string(nlohmann::json({{
-				"predicted"_s,
-				predicted_team_string(
-					parse_predictor_inputs(str),
-					all_usage_stats,
-					random_engine
-				)
-			}}).dump());
-		}
+		[&](containers::string_view const str) -> WebSocketMessage {
+			thread_local auto random_engine = std::mt19937(std::random_device()());
+			auto const json = nlohmann::json::parse(str);
+			if (auto const requested = json.find("dictionary"); requested != json.end()) {
+				return dictionaries[from_string<Generation>(requested->get<std::string_view>())];
+			}
+			auto const inputs = parse_predictor_inputs(json);
+			auto respond = [](containers::string_view const predicted) {
+				return containers::string(nlohmann::json({{"predicted"_s, predicted}}).dump());
+			};
+			auto usage_stats = LoadedUsageStats();
+			try {
+				usage_stats = all_usage_stats[inputs.generation];
+			} catch (std::exception const & ex) {
+				return make_websocket_message(respond(containers::string_view(ex.what())));
+			}
+			auto predict = [&] {
+				return respond(predicted_team_string(inputs, *usage_stats, random_engine));
+			};
+			if (inputs.style != Style::most_likely) {
+				return make_websocket_message(predict());
+			}
+			auto response = make_websocket_message(cache.get(*usage_stats, inputs, predict));
+			if (cache.lookups() % 1'000U == 0U) {
+				auto const metrics = cache.metrics();
+				std::cerr << "Prediction cache: " << metrics.hits << " hits, " << metrics.misses << " misses, " << metrics.size << " entries\n";
+			}
+			return response;
+		},
+		workers,
+		WebSocketCompression::deflate
 	);
-	while (true) {
-		try {
-			context.run();
-		} catch (std::exception const & ex) {
-			std::cerr << ex.what() << '\n';
-		}
-	}
+	auto io_threads = containers::dynamic_array<std::jthread>(containers::generate_n(
+		args.io_threads - 1_bi,
+		[&] { return std::jthread([&] { run(context); }); }
+	));
+	run(context);
 }
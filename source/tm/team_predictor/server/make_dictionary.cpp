@@ -20,7 +20,6 @@ import tm.string_conversions.species;
 
 import tm.team_predictor.server.style;
 
-import tm.team_predictor.all_usage_stats;
 import tm.team_predictor.usage_stats;
 import tm.team_predictor.usage_stats_probabilities;
 
@@ -28,6 +27,7 @@ import tm.generation;
 import tm.item;
 import tm.nlohmann_json;
 
+import bounded;
 import containers;
 import std_module;
 
@@ -72,16 +72,21 @@ auto pokemon_dictionary(Generation const generation, UsageStatsProbabilities::In
 }
 
 auto item_dictionary(UsageStatsProbabilities::Map const & probabilities) -> nlohmann::json {
-	auto used_items = std::unordered_set<Item>();
+	auto used_items = containers::array<bool, bounded::number_of<Item>>();
 	for (auto const & entry : probabilities) {
 		for (auto const value : entry.mapped.items.map()) {
-			used_items.insert(value.key);
+			used_items[bounded::integer(value.key)] = true;
 		}
 	}
-	return json_from_enum_range(used_items);
+	return json_from_enum_range(containers::filter(
+		containers::enum_range<Item>(),
+		[&](Item const item) { return used_items[bounded::integer(item)]; }
+	));
 }
 
-auto generation_dictionary(Generation const generation, UsageStats const & usage_stats) -> nlohmann::json {
+} // namespace
+
+export auto generation_dictionary(Generation const generation, UsageStats const & usage_stats) -> nlohmann::json {
 	auto json = nlohmann::json();
 	auto const & probabilities = usage_stats.assuming().map();
 	json["pokemon"] = json_from_range(containers::transform(
@@ -102,21 +107,4 @@ auto generation_dictionary(Generation const generation, UsageStats const & usage
 	return json;
 }
 
-} // namespace
-
-export auto make_dictionary(AllUsageStats const & all_usage_stats) -> nlohmann::json {
-	return nlohmann::json({{
-		"generations",
-		json_from_range(containers::transform(
-			containers::enum_range<Generation>(),
-			[&](Generation const generation) {
-				return nlohmann::json({{
-					to_string(generation),
-					generation_dictionary(generation, all_usage_stats[generation])
-				}});
-			}
-		))
-	}});
-}
-
 } // namespace technicalmachine
@@ -106,8 +106,7 @@ auto parse_predictor_team(nlohmann::json const & team) -> PredictorTeam {
 	}));
 }
 
-export auto parse_predictor_inputs(std::string_view const str) -> PredictorInputs {
-	auto const json = nlohmann::json::parse(str);
+export auto parse_predictor_inputs(nlohmann::json const & json) -> PredictorInputs {
 	return PredictorInputs(
 		from_string<Generation>(get_str(json, "generation"_s)),
 		from_string<Style>(get_str(json, "style"_s)),
@@ -115,4 +114,8 @@ export auto parse_predictor_inputs(std::string_view const str) -> PredictorInput
 	);
 }
 
+export auto parse_predictor_inputs(std::string_view const str) -> PredictorInputs {
+	return parse_predictor_inputs(nlohmann::json::parse(str));
+}
+
 } // namespace technicalmachine
@@ -17,6 +17,7 @@ import tm.team_predictor.server.style;
 
 import tm.team_predictor.all_usage_stats;
 import tm.team_predictor.team_predictor;
+import tm.team_predictor.usage_stats;
 
 import tm.constant_generation;
 import tm.gender;
@@ -81,20 +82,29 @@ constexpr auto parsed_team_to_seen_team(PredictorTeam const parsed) -> SeenTeam<
 	return team;
 }
 
+// `usage_stats` must be for `generation`, which must be `inputs.generation`
+export template<Generation generation>
+auto predicted_team(
+	PredictorInputs const & inputs,
+	UsageStats const & usage_stats,
+	std::mt19937 & random_engine
+) -> Team<generation> {
+	auto seen_team = parsed_team_to_seen_team<generation>(inputs.team);
+	return inputs.style == Style::random ?
+		random_team(usage_stats, random_engine, std::move(seen_team)) :
+		most_likely_team(usage_stats, std::move(seen_team));
+}
+
+// `usage_stats` must be for `inputs.generation`
 export auto predicted_team_string(
 	PredictorInputs const inputs,
-	AllUsageStats const & all_usage_stats,
+	UsageStats const & usage_stats,
 	std::mt19937 & random_engine
 ) -> containers::string {
 	try {
-		auto const & usage_stats = all_usage_stats[inputs.generation];
 		auto impl = [&]<Generation g>(constant_gen_t<g>) -> containers::string {
-			auto seen_team = parsed_team_to_seen_team<g>(inputs.team);
-			auto const predicted_team = inputs.style == Style::random ?
-				random_team(usage_stats, random_engine, std::move(seen_team)) :
-				most_likely_team(usage_stats, std::move(seen_team));
 			constexpr auto include_active_marker = false;
-			return to_string(predicted_team, include_active_marker);
+			return to_string(predicted_team<g>(inputs, usage_stats, random_engine), include_active_marker);
 		};
 		return constant_generation(inputs.generation, impl);
 	} catch (std::exception const & ex) {
@@ -102,4 +112,16 @@ export auto predicted_team_string(
 	}
 }
 
+export auto predicted_team_string(
+	PredictorInputs const inputs,
+	AllUsageStats const & all_usage_stats,
+	std::mt19937 & random_engine
+) -> containers::string {
+	try {
+		return predicted_team_string(inputs, *all_usage_stats[inputs.generation], random_engine);
+	} catch (std::exception const & ex) {
+		return containers::string(containers::string_view(ex.what()));
+	}
+}
+
 } // namespace technicalmachine
@@ -0,0 +1,153 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.team_predictor.server.prediction_cache;
+
+import tm.stat.evs;
+
+import tm.team_predictor.server.predictor_inputs;
+
+import tm.team_predictor.usage_stats;
+
+import bounded;
+import concurrent;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine {
+using namespace bounded::literal;
+
+// Inputs are not reordered before lookup. Both the predicted sets and the
+// order of the response depend on the order of the Pokemon and their moves.
+struct Key {
+	// Each time usage stats are loaded they get a new id, so entries computed
+	// from earlier usage stats are never returned. Their address is not
+	// enough, because stats loaded after an eviction can reuse it.
+	std::uint64_t usage_stats;
+	PredictorInputs inputs;
+
+	friend auto operator==(Key const &, Key const &) -> bool = default;
+};
+
+constexpr auto hash_combine(std::size_t & seed, auto const value) -> void {
+	seed ^= std::hash<decltype(value)>()(value) + 0x9E37'79B9'7F4A'7C15U + (seed << 6U) + (seed >> 2U);
+}
+
+template<typename T>
+constexpr auto hash_combine(std::size_t & seed, tv::optional<T> const value) -> void {
+	hash_combine(seed, static_cast<bool>(value));
+	if (value) {
+		hash_combine(seed, *value);
+	}
+}
+
+constexpr auto hash_combine(std::size_t & seed, EVs const evs) -> void {
+	for (auto const ev : {evs.hp, evs.atk, evs.def, evs.spa, evs.spd, evs.spe}) {
+		hash_combine(seed, static_cast<int>(ev.value()));
+	}
+}
+
+struct KeyHash {
+	static constexpr auto operator()(Key const & key) -> std::size_t {
+		auto seed = std::hash<std::uint64_t>()(key.usage_stats);
+		hash_combine(seed, key.inputs.generation);
+		hash_combine(seed, key.inputs.style);
+		for (auto const & pokemon : key.inputs.team) {
+			hash_combine(seed, pokemon.species);
+			hash_combine(seed, static_cast<int>(pokemon.level()));
+			hash_combine(seed, pokemon.item);
+			hash_combine(seed, pokemon.ability);
+			hash_combine(seed, pokemon.nature);
+			hash_combine(seed, pokemon.evs);
+			for (auto const move : pokemon.moves) {
+				hash_combine(seed, move);
+			}
+		}
+		return seed;
+	}
+};
+
+export struct PredictionCacheMetrics {
+	std::uint64_t hits;
+	std::uint64_t misses;
+	std::size_t size;
+};
+
+// Caches deterministic predictions. Entries are spread across shards, each of
+// which evicts its least recently used entry once it is full. Safe to call
+// from multiple threads at once.
+export struct PredictionCache {
+	explicit PredictionCache(std::size_t const capacity):
+		m_capacity_per_shard(std::max(capacity / static_cast<std::size_t>(shard_count), std::size_t(1)))
+	{
+	}
+
+	// `compute` is called without any lock held, so two threads that miss on
+	// the same key at the same time will both compute it.
+	auto get(UsageStats const & usage_stats, PredictorInputs const & inputs, auto const compute) -> containers::string {
+		auto key = Key(usage_stats.load_id(), inputs);
+		++m_lookups;
+		auto const hash = KeyHash()(key);
+		auto & shard = m_shards[bounded::integer(hash) % shard_count];
+		{
+			auto const locked = shard.locked();
+			auto & value = locked.value();
+			auto const it = value.index.find(key);
+			if (it != value.index.end()) {
+				value.entries.splice(value.entries.begin(), value.entries, it->second);
+				++m_hits;
+				return it->second->response;
+			}
+		}
+		auto response = containers::string(compute());
+		auto const locked = shard.locked();
+		auto & value = locked.value();
+		if (value.index.contains(key)) {
+			return response;
+		}
+		value.entries.push_front(Entry(key, response));
+		value.index.emplace(std::move(key), value.entries.begin());
+		if (value.entries.size() > m_capacity_per_shard) {
+			value.index.erase(value.entries.back().key);
+			value.entries.pop_back();
+		}
+		return response;
+	}
+
+	auto lookups() const -> std::uint64_t {
+		return m_lookups;
+	}
+
+	auto metrics() const -> PredictionCacheMetrics {
+		auto size = std::size_t(0);
+		for (auto & shard : m_shards) {
+			size += shard.locked().value().entries.size();
+		}
+		auto const hits = m_hits.load();
+		return PredictionCacheMetrics(hits, m_lookups - hits, size);
+	}
+
+private:
+	static constexpr auto shard_count = 16_bi;
+
+	struct Entry {
+		Key key;
+		containers::string response;
+	};
+	// Most recently used first
+	using Entries = std::list<Entry>;
+	struct Shard {
+		Entries entries;
+		std::unordered_map<Key, Entries::iterator, KeyHash> index;
+	};
+
+	std::size_t m_capacity_per_shard;
+	mutable containers::array<concurrent::locked_access<Shard>, shard_count> m_shards;
+	std::atomic<std::uint64_t> m_lookups = 0U;
+	std::atomic<std::uint64_t> m_hits = 0U;
+};
+
+} // namespace technicalmachine
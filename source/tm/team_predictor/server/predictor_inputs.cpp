@@ -33,6 +33,8 @@ export struct PredictorPokemon {
 	tv::optional<Nature> nature;
 	tv::optional<EVs> evs;
 	MoveNames moves;
+
+	friend auto operator==(PredictorPokemon, PredictorPokemon) -> bool = default;
 };
 
 export using PredictorTeam = containers::static_vector<PredictorPokemon, max_pokemon_per_team>;
@@ -41,6 +43,8 @@ export struct PredictorInputs {
 	Generation generation;
 	Style style;
 	PredictorTeam team;
+
+	friend auto operator==(PredictorInputs const &, PredictorInputs const &) -> bool = default;
 };
 
 } // namespace technicalmachine
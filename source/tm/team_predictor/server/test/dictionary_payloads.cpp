@@ -0,0 +1,143 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <doctest/doctest.h>
+
+export module tm.team_predictor.server.test.dictionary_payloads;
+
+import tm.string_conversions.generation;
+
+import tm.team_predictor.server.dictionary_payloads;
+
+import tm.team_predictor.all_usage_stats;
+
+import tm.test.usage_bytes;
+
+import tm.generation;
+import tm.nlohmann_json;
+
+import containers;
+import std_module;
+
+namespace technicalmachine {
+namespace {
+using namespace nlohmann::literals;
+
+auto parse(auto const & message) -> nlohmann::json {
+	return nlohmann::json::parse(std::string_view(*message));
+}
+
+TEST_CASE("DictionaryPayloads") {
+	auto const all_usage_stats = AllUsageStats([](Generation const generation) {
+		return bytes_to_usage_stats(smallest_team_bytes(generation));
+	});
+	auto const payloads = DictionaryPayloads(all_usage_stats);
+	CHECK(parse(payloads.generations()) == R"({
+		"generations": ["1", "2", "3", "4", "5", "6", "7", "8"]
+	})"_json);
+	CHECK(parse(payloads[Generation::two]) == R"({
+		"generation": "2",
+		"dictionary": {
+			"items": ["None"],
+			"pokemon": {
+				"Mew": {
+					"moves": ["Cut"]
+				}
+			}
+		}
+	})"_json);
+	CHECK(payloads[Generation::two] == payloads[Generation::two]);
+}
+
+// What `smallest_team_bytes` gives for each generation
+auto expected_dictionary(Generation const generation) -> nlohmann::json {
+	if (generation == Generation::one) {
+		return R"({
+			"pokemon": {
+				"Mew": {
+					"moves": ["Cut"]
+				}
+			}
+		})"_json;
+	}
+	if (generation == Generation::two) {
+		return R"({
+			"items": ["None"],
+			"pokemon": {
+				"Mew": {
+					"moves": ["Cut"]
+				}
+			}
+		})"_json;
+	}
+	return R"({
+		"items": ["None"],
+		"natures": [
+			"Hardy",
+			"Lonely",
+			"Brave",
+			"Adamant",
+			"Naughty",
+			"Bold",
+			"Docile",
+			"Relaxed",
+			"Impish",
+			"Lax",
+			"Timid",
+			"Hasty",
+			"Serious",
+			"Jolly",
+			"Naive",
+			"Modest",
+			"Mild",
+			"Quiet",
+			"Bashful",
+			"Rash",
+			"Calm",
+			"Gentle",
+			"Sassy",
+			"Careful",
+			"Quirky"
+		],
+		"pokemon": {
+			"Mew": {
+				"abilities": ["Synchronize"],
+				"moves": ["Cut"]
+			}
+		}
+	})"_json;
+}
+
+TEST_CASE("DictionaryPayloads: every generation") {
+	auto const all_usage_stats = AllUsageStats([](Generation const generation) {
+		return bytes_to_usage_stats(smallest_team_bytes(generation));
+	});
+	auto const payloads = DictionaryPayloads(all_usage_stats);
+	for (auto const generation : containers::enum_range<Generation>()) {
+		auto const name = std::string_view(to_string(generation));
+		INFO("Generation " << name);
+		CHECK(parse(payloads[generation]) == nlohmann::json({
+			{"generation", name},
+			{"dictionary", expected_dictionary(generation)}
+		}));
+	}
+}
+
+TEST_CASE("DictionaryPayloads loads usage stats only when a dictionary is requested") {
+	auto const all_usage_stats = AllUsageStats([](Generation const generation) {
+		if (generation != Generation::two) {
+			throw std::runtime_error("Not loaded by this test");
+		}
+		return bytes_to_usage_stats(smallest_team_bytes(generation));
+	});
+	auto const payloads = DictionaryPayloads(all_usage_stats);
+	CHECK(parse(payloads[Generation::two])["generation"] == "2");
+	CHECK_THROWS(payloads[Generation::one]);
+}
+
+} // namespace
+} // namespace technicalmachine
@@ -0,0 +1,107 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <doctest/doctest.h>
+
+export module tm.team_predictor.server.test.prediction_cache;
+
+import tm.move.move_names;
+
+import tm.pokemon.level;
+import tm.pokemon.species;
+
+import tm.team_predictor.server.prediction_cache;
+import tm.team_predictor.server.predictor_inputs;
+import tm.team_predictor.server.style;
+
+import tm.team_predictor.usage_stats;
+
+import tm.test.usage_bytes;
+
+import tm.generation;
+
+import bounded;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine {
+namespace {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+
+auto make_inputs(Level const level) -> PredictorInputs {
+	return PredictorInputs{
+		Generation::one,
+		Style::most_likely,
+		PredictorTeam({
+			PredictorPokemon{Species::Mew, level, tv::none, tv::none, tv::none, tv::none, MoveNames()}
+		})
+	};
+}
+
+TEST_CASE("PredictionCache returns cached responses") {
+	auto const usage_stats = bytes_to_usage_stats(smallest_team_bytes(Generation::one));
+	auto cache = PredictionCache(100U);
+	auto computed = 0;
+	auto compute = [&] {
+		++computed;
+		return containers::string("team"_s);
+	};
+	CHECK(cache.get(usage_stats, make_inputs(Level(100_bi)), compute) == "team"_s);
+	CHECK(cache.get(usage_stats, make_inputs(Level(100_bi)), compute) == "team"_s);
+	CHECK(computed == 1);
+	CHECK(cache.get(usage_stats, make_inputs(Level(50_bi)), compute) == "team"_s);
+	CHECK(computed == 2);
+
+	auto const metrics = cache.metrics();
+	CHECK(metrics.hits == 1U);
+	CHECK(metrics.misses == 2U);
+	CHECK(metrics.size == 2U);
+}
+
+TEST_CASE("PredictionCache does not reuse responses from other usage stats") {
+	auto const original = bytes_to_usage_stats(smallest_team_bytes(Generation::one));
+	auto const reloaded = bytes_to_usage_stats(smallest_team_bytes(Generation::one));
+	auto cache = PredictionCache(100U);
+	auto computed = 0;
+	auto compute = [&] {
+		++computed;
+		return containers::string("team"_s);
+	};
+	cache.get(original, make_inputs(Level(100_bi)), compute);
+	cache.get(reloaded, make_inputs(Level(100_bi)), compute);
+	CHECK(computed == 2);
+}
+
+TEST_CASE("PredictionCache does not reuse responses from usage stats at a reused address") {
+	auto cache = PredictionCache(100U);
+	auto computed = 0;
+	auto compute = [&] {
+		++computed;
+		return containers::string("team"_s);
+	};
+	for (auto const _ : containers::integer_range(2_bi)) {
+		auto const usage_stats = std::make_unique<UsageStats const>(bytes_to_usage_stats(smallest_team_bytes(Generation::one)));
+		cache.get(*usage_stats, make_inputs(Level(100_bi)), compute);
+	}
+	CHECK(computed == 2);
+	CHECK(cache.lookups() == 2U);
+}
+
+TEST_CASE("PredictionCache is bounded") {
+	auto const usage_stats = bytes_to_usage_stats(smallest_team_bytes(Generation::one));
+	constexpr auto capacity = 32U;
+	auto cache = PredictionCache(capacity);
+	for (auto const level : containers::integer_range(1_bi, 101_bi)) {
+		cache.get(usage_stats, make_inputs(Level(level)), [] { return containers::string("team"_s); });
+	}
+	CHECK(cache.metrics().size <= capacity);
+}
+
+} // namespace
+} // namespace technicalmachine
@@ -24,6 +24,13 @@ export struct StatsUser {
 		m_estimate(m_usage_stats)
 	{
 	}
+	// `estimate` must have been created from `usage_stats`
+	constexpr StatsUser(UsageStats const & usage_stats, Estimate estimate, tv::optional<std::mt19937 &> random = tv::none):
+		m_usage_stats(usage_stats),
+		m_random(random),
+		m_estimate(std::move(estimate))
+	{
+	}
 
 	constexpr auto update(Species const species, auto... args) -> void {
 		m_estimate.update(m_usage_stats, species, args...);
@@ -50,6 +57,10 @@ export struct StatsUser {
 			m_estimate.most_likely_ability(species);
 	}
 
+	constexpr auto estimate() && -> Estimate {
+		return std::move(m_estimate);
+	}
+
 private:
 	UsageStats const & m_usage_stats;
 	tv::optional<std::mt19937 &> m_random;
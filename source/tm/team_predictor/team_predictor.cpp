@@ -9,23 +9,73 @@ module;
 
 export module tm.team_predictor.team_predictor;
 
+import tm.move.move_name;
+import tm.move.move_names;
+
 import tm.pokemon.max_pokemon_per_team;
+import tm.pokemon.species;
 
+import tm.team_predictor.estimate;
 import tm.team_predictor.stats_user;
 import tm.team_predictor.usage_stats;
 
+import tm.ability;
 import tm.generation;
+import tm.item;
 import tm.team;
 
+import bounded;
+import containers;
 import std_module;
+import tv;
 
 namespace technicalmachine {
+using namespace bounded::literal;
+
+// Every choice made while predicting a team, in the order it was made
+using PredictionChoice = tv::variant<
+	tv::optional<Species>,
+	tv::optional<MoveName>,
+	tv::optional<Item>,
+	tv::optional<Ability>
+>;
+using PredictionChoices = containers::vector<PredictionChoice>;
 
 template<Generation generation>
 auto predict_team_impl(StatsUser stats_user, SeenTeam<generation> team) -> Team<generation>;
 
+export template<Generation generation>
+struct TeamHypothesis {
+	Team<generation> team;
+	double probability;
+};
+
+export struct HypothesisBudget {
+	// How many partial teams are kept after each choice
+	std::size_t beam_width;
+	// Once this passes, each partial team is finished with only its most
+	// likely choices
+	tv::optional<std::chrono::steady_clock::time_point> deadline = tv::none;
+};
+
+template<Generation generation>
+auto predict_teams_impl(UsageStats const & usage_stats, Estimate estimate, SeenTeam<generation> team, HypothesisBudget budget) -> containers::vector<TeamHypothesis<generation>>;
+
+// Does not apply what is already known about `team` to `stats_user`. Records
+// every choice in `choices`.
+template<Generation generation>
+auto predict_team_recording(StatsUser stats_user, SeenTeam<generation> team, PredictionChoices & choices) -> Team<generation>;
+
+// `team` must have the same revealed information as the team used to record
+// `choices`
+template<Generation generation>
+auto predict_team_replaying(PredictionChoices const & choices, SeenTeam<generation> team) -> Team<generation>;
+
 #define EXTERN_INSTANTIATION(generation) \
-	extern template auto predict_team_impl(StatsUser stats_user, SeenTeam<generation> team) -> Team<generation>
+	extern template auto predict_team_impl(StatsUser stats_user, SeenTeam<generation> team) -> Team<generation>; \
+	extern template auto predict_teams_impl(UsageStats const & usage_stats, Estimate estimate, SeenTeam<generation> team, HypothesisBudget budget) -> containers::vector<TeamHypothesis<generation>>; \
+	extern template auto predict_team_recording(StatsUser stats_user, SeenTeam<generation> team, PredictionChoices & choices) -> Team<generation>; \
+	extern template auto predict_team_replaying(PredictionChoices const & choices, SeenTeam<generation> team) -> Team<generation>
 
 TM_FOR_EACH_GENERATION(EXTERN_INSTANTIATION);
 
@@ -39,4 +89,128 @@ auto random_team(UsageStats const & usage_stats, std::mt19937 & random_engine, S
 	return predict_team_impl(StatsUser(usage_stats, random_engine), team);
 }
 
+// Up to `budget.beam_width` completions of `team`, most likely first. The
+// probabilities are relative to the other completions returned, so they sum
+// to 1. With a beam width of 1, this makes the same choices as
+// `most_likely_team` (other than possibly how ties are broken).
+export template<Generation generation>
+auto most_likely_teams(UsageStats const & usage_stats, SeenTeam<generation> team, HypothesisBudget const budget) -> containers::vector<TeamHypothesis<generation>> {
+	auto stats_user = StatsUser(usage_stats);
+	update_estimate(stats_user, team);
+	return predict_teams_impl(usage_stats, std::move(stats_user).estimate(), std::move(team), budget);
+}
+
+// Everything about a Pokemon that affects the prediction
+struct RevealedPokemon {
+	Species species;
+	Item item;
+	bool item_is_known;
+	bool ability_is_known;
+	MoveNames moves;
+
+	friend auto operator==(RevealedPokemon const &, RevealedPokemon const &) -> bool = default;
+};
+
+struct Revealed {
+	TeamSize size;
+	containers::static_vector<RevealedPokemon, max_pokemon_per_team> pokemon;
+
+	friend auto operator==(Revealed const &, Revealed const &) -> bool = default;
+};
+
+template<Generation generation>
+auto get_revealed(SeenTeam<generation> const & team) -> Revealed {
+	auto result = Revealed(team.size(), {});
+	for (auto const & pokemon : team.all_pokemon()) {
+		constexpr auto embargo = false;
+		constexpr auto magic_room = false;
+		containers::push_back(result.pokemon, RevealedPokemon(
+			pokemon.species(),
+			// TODO: We want to keep track of this even if the item is removed
+			pokemon.item(embargo, magic_room),
+			pokemon.item_is_known(),
+			pokemon.ability_is_known(),
+			MoveNames(containers::transform(pokemon.regular_moves(), [](auto const move) { return move.name(); }))
+		));
+	}
+	return result;
+}
+
+// Predicts the same thing as `most_likely_team`, but is meant to live for an
+// entire battle. The estimate of the foe's team is kept between calls, and
+// only information revealed since the last call is applied to it. If nothing
+// has been revealed since the last call, the previous predictions are reused
+// without consulting the estimate at all.
+export struct IncrementalTeamPredictor {
+	explicit IncrementalTeamPredictor(UsageStats const & usage_stats):
+		m_usage_stats(usage_stats),
+		m_estimate(usage_stats)
+	{
+	}
+
+	template<Generation generation>
+	auto most_likely_team(SeenTeam<generation> team) & -> Team<generation> {
+		auto revealed = get_revealed(team);
+		if (m_choices and revealed == *m_revealed) {
+			return predict_team_replaying(*m_choices, std::move(team));
+		}
+		m_choices = tv::none;
+		apply(std::move(revealed));
+		auto choices = PredictionChoices();
+		auto result = predict_team_recording(StatsUser(m_usage_stats.get(), m_estimate), std::move(team), choices);
+		m_choices.emplace([&] { return std::move(choices); });
+		return result;
+	}
+
+private:
+	auto update(RevealedPokemon const & pokemon, auto const new_moves) & -> void {
+		for (auto const move : new_moves) {
+			m_estimate.update(m_usage_stats.get(), pokemon.species, move);
+		}
+	}
+	auto add(RevealedPokemon const & pokemon) & -> void {
+		m_estimate.update(m_usage_stats.get(), pokemon.species);
+		m_estimate.update(m_usage_stats.get(), pokemon.species, pokemon.item);
+		update(pokemon, pokemon.moves);
+	}
+
+	// Pokemon are only added to the end of a team and moves are only added to
+	// the end of a moveset. Anything else (for instance, an item being
+	// removed) means the estimate has to be built again from the start.
+	static auto is_extension(Revealed const & previous, Revealed const & current) -> bool {
+		if (current.size != previous.size or containers::size(current.pokemon) < containers::size(previous.pokemon)) {
+			return false;
+		}
+		for (auto const index : containers::integer_range(containers::size(previous.pokemon))) {
+			auto const & before = previous.pokemon[index];
+			auto const & after = current.pokemon[index];
+			if (before.species != after.species or before.item != after.item or !containers::starts_with(after.moves, before.moves)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	auto apply(Revealed revealed) & -> void {
+		if (m_revealed and !is_extension(*m_revealed, revealed)) {
+			m_estimate = Estimate(m_usage_stats.get());
+			m_revealed = tv::none;
+		}
+		auto const previous_size = m_revealed ? containers::size(m_revealed->pokemon) : TeamSize(0_bi);
+		for (auto const index : containers::integer_range(previous_size)) {
+			auto const & pokemon = revealed.pokemon[index];
+			update(pokemon, containers::drop_exactly(pokemon.moves, containers::size(m_revealed->pokemon[index].moves)));
+		}
+		for (auto const & pokemon : containers::drop_exactly(revealed.pokemon, previous_size)) {
+			add(pokemon);
+		}
+		m_revealed = std::move(revealed);
+	}
+
+	std::reference_wrapper<UsageStats const> m_usage_stats;
+	Estimate m_estimate;
+	tv::optional<Revealed> m_revealed;
+	tv::optional<PredictionChoices> m_choices;
+};
+
 } // namespace technicalmachine
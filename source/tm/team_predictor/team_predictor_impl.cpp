@@ -11,11 +11,13 @@ module tm.team_predictor.team_predictor;
 
 import tm.move.max_moves_per_pokemon;
 import tm.move.move;
+import tm.move.move_name;
 
 import tm.pokemon.any_pokemon;
 import tm.pokemon.level;
 import tm.pokemon.has_physical_or_special_move;
 import tm.pokemon.max_pokemon_per_team;
+import tm.pokemon.species;
 
 import tm.stat.calculate_ivs_and_evs;
 
@@ -25,19 +27,22 @@ import tm.team_predictor.estimate;
 import tm.team_predictor.stats_user;
 import tm.team_predictor.usage_stats;
 
+import tm.ability;
 import tm.any_team;
 import tm.gender;
 import tm.generation;
+import tm.item;
 import tm.team;
 
 import bounded;
 import containers;
 import std_module;
+import tv;
 
 namespace technicalmachine {
 using namespace bounded::literal;
 
-void predict_pokemon(StatsUser & stats_user, any_seen_team auto & team) {
+void predict_pokemon(auto & stats_user, any_seen_team auto & team) {
 	auto const index = team.all_pokemon().index();
 	while (team.number_of_seen_pokemon() < team.size()) {
 		auto const species = stats_user.species();
@@ -55,7 +60,7 @@ void predict_pokemon(StatsUser & stats_user, any_seen_team auto & team) {
 }
 
 template<any_seen_pokemon PokemonType>
-void predict_moves(StatsUser & stats_user, PokemonType & pokemon) {
+void predict_moves(auto & stats_user, PokemonType & pokemon) {
 	auto const species = pokemon.species();
 	while (containers::size(pokemon.regular_moves()) != max_moves_per_pokemon) {
 		auto const move_name = stats_user.move(species);
@@ -67,7 +72,7 @@ void predict_moves(StatsUser & stats_user, PokemonType & pokemon) {
 	}
 }
 
-void predict_item(StatsUser & stats_user, any_seen_pokemon auto & pokemon) {
+void predict_item(auto & stats_user, any_seen_pokemon auto & pokemon) {
 	if (pokemon.item_is_known()) {
 		return;
 	}
@@ -80,7 +85,7 @@ void predict_item(StatsUser & stats_user, any_seen_pokemon auto & pokemon) {
 	stats_user.update(species, *item);
 }
 
-void predict_ability(StatsUser & stats_user, any_seen_pokemon auto & pokemon) {
+void predict_ability(auto & stats_user, any_seen_pokemon auto & pokemon) {
 	if (pokemon.ability_is_known()) {
 		return;
 	}
@@ -109,24 +114,351 @@ void optimize_pokemon_evs(any_seen_pokemon auto & pokemon) {
 	pokemon.set_ivs_and_evs(optimized);
 }
 
+// Records everything `StatsUser` chooses
+struct RecordingUser {
+	constexpr RecordingUser(StatsUser & stats_user, PredictionChoices & choices):
+		m_stats_user(stats_user),
+		m_choices(choices)
+	{
+	}
+
+	constexpr auto update(Species const species, auto... args) -> void {
+		m_stats_user.update(species, args...);
+	}
+
+	constexpr auto species() const {
+		return record(m_stats_user.species());
+	}
+	constexpr auto move(Species const species) const {
+		return record(m_stats_user.move(species));
+	}
+	constexpr auto item(Species const species) const {
+		return record(m_stats_user.item(species));
+	}
+	constexpr auto ability(Species const species) const {
+		return record(m_stats_user.ability(species));
+	}
+
+private:
+	constexpr auto record(auto const choice) const {
+		containers::push_back(m_choices, PredictionChoice(choice));
+		return choice;
+	}
+
+	StatsUser & m_stats_user;
+	PredictionChoices & m_choices;
+};
+
+// Makes the same choices as a previous `RecordingUser`, in the same order
+struct ReplayingUser {
+	constexpr explicit ReplayingUser(PredictionChoices const & choices):
+		m_it(containers::begin(choices)),
+		m_last(containers::end(choices))
+	{
+	}
+
+	constexpr auto update(Species, auto...) -> void {
+	}
+
+	constexpr auto species() {
+		return next<Species>();
+	}
+	constexpr auto move(Species) {
+		return next<MoveName>();
+	}
+	constexpr auto item(Species) {
+		return next<Item>();
+	}
+	constexpr auto ability(Species) {
+		return next<Ability>();
+	}
+
+private:
+	template<typename T>
+	constexpr auto next() -> tv::optional<T> {
+		if (m_it == m_last) {
+			throw std::runtime_error("Replayed team prediction made more choices than were recorded");
+		}
+		auto const & choice = *m_it;
+		++m_it;
+		if (choice.index() != bounded::type<tv::optional<T>>) {
+			throw std::runtime_error("Replayed team prediction made different choices than were recorded");
+		}
+		return choice[bounded::type<tv::optional<T>>];
+	}
+
+	containers::iterator_t<PredictionChoices const &> m_it;
+	containers::iterator_t<PredictionChoices const &> m_last;
+};
+
+// Everything done to a team once all of its choices have been made
 template<Generation generation>
-auto predict_team_impl(StatsUser stats_user, SeenTeam<generation> team) -> Team<generation> {
-	update_estimate(stats_user, team);
+auto finish_team(SeenTeam<generation> & team) -> Team<generation> {
+	for (auto & pokemon : team.all_pokemon()) {
+		optimize_pokemon_evs(pokemon);
+	}
+	// TODO: This isn't right
+	team.pokemon().set_ability_to_base_ability();
+	return Team<generation>(team);
+}
 
+template<Generation generation>
+auto predict_missing(auto & stats_user, SeenTeam<generation> team) -> Team<generation> {
 	predict_pokemon(stats_user, team);
 	for (auto & pokemon : team.all_pokemon()) {
 		predict_moves(stats_user, pokemon);
 		predict_item(stats_user, pokemon);
 		predict_ability(stats_user, pokemon);
-		optimize_pokemon_evs(pokemon);
 	}
-	// TODO: This isn't right
-	team.pokemon().set_ability_to_base_ability();
-	return Team<generation>(team);
+	return finish_team(team);
+}
+
+template<Generation generation>
+auto predict_team_impl(StatsUser stats_user, SeenTeam<generation> team) -> Team<generation> {
+	update_estimate(stats_user, team);
+	return predict_missing(stats_user, std::move(team));
+}
+
+template<Generation generation>
+auto predict_team_recording(StatsUser stats_user, SeenTeam<generation> team, PredictionChoices & choices) -> Team<generation> {
+	auto user = RecordingUser(stats_user, choices);
+	return predict_missing(user, std::move(team));
+}
+
+template<Generation generation>
+auto predict_team_replaying(PredictionChoices const & choices, SeenTeam<generation> team) -> Team<generation> {
+	auto user = ReplayingUser(choices);
+	return predict_missing(user, std::move(team));
+}
+
+template<Generation generation>
+struct Hypothesis {
+	Estimate estimate;
+	SeenTeam<generation> team;
+	double probability;
+};
+
+template<Generation generation>
+using Beam = containers::vector<Hypothesis<generation>>;
+
+struct PokemonChoices {
+	Species species;
+	// Sorted
+	containers::static_vector<MoveName, max_moves_per_pokemon> moves;
+	tv::optional<Item> item;
+	tv::optional<Ability> ability;
+
+	friend auto operator<=>(PokemonChoices const &, PokemonChoices const &) = default;
+	friend auto operator==(PokemonChoices const &, PokemonChoices const &) -> bool = default;
+};
+
+using TeamChoices = containers::static_vector<PokemonChoices, max_pokemon_per_team>;
+
+// What has been chosen for a team, without the order it was chosen in
+template<Generation generation>
+auto team_choices(SeenTeam<generation> const & team) -> TeamChoices {
+	auto result = TeamChoices(containers::transform(team.all_pokemon(), [](auto const & pokemon) {
+		auto moves = containers::static_vector<MoveName, max_moves_per_pokemon>(containers::transform(
+			pokemon.regular_moves(),
+			[](Move const move) { return move.name(); }
+		));
+		containers::sort(moves);
+		return PokemonChoices(
+			pokemon.species(),
+			moves,
+			pokemon.item_is_known() ? tv::optional<Item>(pokemon.item(false, false)) : tv::none,
+			pokemon.ability_is_known() ? tv::optional<Ability>(pokemon.initial_ability()) : tv::none
+		);
+	}));
+	containers::sort(result, [](PokemonChoices const & lhs, PokemonChoices const & rhs) {
+		return lhs.species < rhs.species;
+	});
+	return result;
+}
+
+template<Generation generation>
+constexpr auto sort_by_probability(Beam<generation> & beam) -> void {
+	containers::sort(beam, [](Hypothesis<generation> const & lhs, Hypothesis<generation> const & rhs) {
+		return lhs.probability > rhs.probability;
+	});
+}
+
+// A hypothesis that `extend` could make, before it is made. `choice` is empty
+// for a parent with nothing left to choose.
+struct Candidate {
+	std::size_t parent;
+	tv::optional<std::size_t> choice;
+	double probability;
+};
+
+// Replaces each hypothesis with one hypothesis per choice, then keeps only the
+// most likely distinct teams. A hypothesis with nothing to choose is kept as
+// it is.
+//
+// Candidates are ranked before any of them is built, so an `Estimate` and a
+// team are copied only for candidates that are kept or that merge into a kept
+// team. Choosing A and then B gives the same team as choosing B and then A;
+// such duplicates are combined into the most likely of them, which takes the
+// probability of all of them. Once the beam is full, the remaining candidates
+// are dropped without being built.
+template<Generation generation>
+auto extend(Beam<generation> beam, HypothesisBudget const budget, auto const get_choices, auto const apply) -> Beam<generation> {
+	auto const past_deadline = budget.deadline and std::chrono::steady_clock::now() >= *budget.deadline;
+	auto const branches = past_deadline ? std::size_t(1) : budget.beam_width;
+	auto const beam_size = static_cast<std::size_t>(containers::size(beam));
+	using Choices = decltype(get_choices(containers::front(std::as_const(beam))));
+	auto const all_choices = containers::vector<Choices>(containers::transform(beam, [&](Hypothesis<generation> const & hypothesis) {
+		return get_choices(hypothesis);
+	}));
+
+	auto candidates = containers::vector<Candidate>();
+	for (auto parent = std::size_t(0); parent != beam_size; ++parent) {
+		auto const & choices = containers::at(all_choices, parent);
+		auto const probability = containers::at(beam, parent).probability;
+		if (containers::is_empty(choices)) {
+			containers::push_back(candidates, Candidate(parent, tv::none, probability));
+			continue;
+		}
+		auto const count = std::min(branches, static_cast<std::size_t>(containers::size(choices)));
+		for (auto index = std::size_t(0); index != count; ++index) {
+			containers::push_back(candidates, Candidate(parent, index, probability * containers::at(choices, index).probability));
+		}
+	}
+	containers::sort(candidates, [](Candidate const & lhs, Candidate const & rhs) {
+		return lhs.probability > rhs.probability;
+	});
+
+	auto result = Beam<generation>();
+	auto indexes = containers::flat_map<TeamChoices, std::size_t>();
+	for (auto const & candidate : candidates) {
+		if (static_cast<std::size_t>(containers::size(result)) == budget.beam_width) {
+			break;
+		}
+		auto & parent = containers::at(beam, candidate.parent);
+		auto next = [&] {
+			if (!candidate.choice) {
+				return std::move(parent);
+			}
+			auto hypothesis = parent;
+			apply(hypothesis, containers::at(containers::at(all_choices, candidate.parent), *candidate.choice).key);
+			hypothesis.probability = candidate.probability;
+			return hypothesis;
+		}();
+		auto const inserted = indexes.lazy_insert(team_choices(next.team), [&] {
+			return static_cast<std::size_t>(containers::size(result));
+		});
+		if (!inserted.inserted) {
+			containers::at(result, inserted.iterator->mapped).probability += next.probability;
+			continue;
+		}
+		containers::push_back(result, std::move(next));
+	}
+	sort_by_probability(result);
+	return result;
+}
+
+// Makes the same choices in the same order as `predict_missing`, but follows
+// several of the most likely choices at each step. Hypotheses that share a
+// prefix of choices share the work of making them.
+template<Generation generation>
+auto predict_teams_impl(UsageStats const & usage_stats, Estimate estimate, SeenTeam<generation> team, HypothesisBudget const budget) -> containers::vector<TeamHypothesis<generation>> {
+	if (budget.beam_width == 0U) {
+		throw std::runtime_error("Must keep at least one team hypothesis");
+	}
+	auto const original_index = team.all_pokemon().index();
+	auto const team_size = team.size();
+	auto beam = Beam<generation>();
+	containers::push_back(beam, Hypothesis<generation>(std::move(estimate), std::move(team), 1.0));
+
+	while (containers::front(beam).team.number_of_seen_pokemon() < team_size) {
+		beam = extend(
+			std::move(beam),
+			budget,
+			[](Hypothesis<generation> const & hypothesis) {
+				auto choices = hypothesis.estimate.species_choices();
+				if (containers::is_empty(choices)) {
+					throw std::runtime_error("Usage stats say there are not enough Pokemon to make a team");
+				}
+				return choices;
+			},
+			[&](Hypothesis<generation> & hypothesis, Species const species) {
+				hypothesis.estimate.update(usage_stats, species);
+				hypothesis.team.add_pokemon({species, Level(100_bi), Gender::genderless});
+			}
+		);
+	}
+	for (auto & hypothesis : beam) {
+		hypothesis.team.all_pokemon().set_index(original_index);
+	}
+
+	for (auto const index : containers::integer_range(team_size)) {
+		auto get_pokemon = [=](auto & hypothesis) -> auto & {
+			return hypothesis.team.all_pokemon()(index);
+		};
+		for ([[maybe_unused]] auto const move_index : containers::integer_range(max_moves_per_pokemon)) {
+			beam = extend(
+				std::move(beam),
+				budget,
+				[&](Hypothesis<generation> const & hypothesis) {
+					auto const & pokemon = get_pokemon(hypothesis);
+					return containers::size(pokemon.regular_moves()) == max_moves_per_pokemon ?
+						containers::vector<WeightedChoice<MoveName>>() :
+						hypothesis.estimate.move_choices(pokemon.species());
+				},
+				[&](Hypothesis<generation> & hypothesis, MoveName const move) {
+					auto & pokemon = get_pokemon(hypothesis);
+					pokemon.add_move(Move(generation, move));
+					hypothesis.estimate.update(usage_stats, pokemon.species(), move);
+				}
+			);
+		}
+		beam = extend(
+			std::move(beam),
+			budget,
+			[&](Hypothesis<generation> const & hypothesis) {
+				auto const & pokemon = get_pokemon(hypothesis);
+				return pokemon.item_is_known() ?
+					containers::vector<WeightedChoice<Item>>() :
+					hypothesis.estimate.item_choices(pokemon.species());
+			},
+			[&](Hypothesis<generation> & hypothesis, Item const item) {
+				auto & pokemon = get_pokemon(hypothesis);
+				pokemon.set_item(item);
+				hypothesis.estimate.update(usage_stats, pokemon.species(), item);
+			}
+		);
+		beam = extend(
+			std::move(beam),
+			budget,
+			[&](Hypothesis<generation> const & hypothesis) {
+				auto const & pokemon = get_pokemon(hypothesis);
+				return pokemon.ability_is_known() ?
+					containers::vector<WeightedChoice<Ability>>() :
+					hypothesis.estimate.ability_choices(pokemon.species());
+			},
+			[&](Hypothesis<generation> & hypothesis, Ability const ability) {
+				auto & pokemon = get_pokemon(hypothesis);
+				pokemon.set_initial_ability(ability);
+				hypothesis.estimate.update(usage_stats, pokemon.species(), ability);
+			}
+		);
+	}
+
+	auto const total = containers::sum(containers::transform(beam, [](Hypothesis<generation> const & hypothesis) {
+		return hypothesis.probability;
+	}));
+	auto result = containers::vector<TeamHypothesis<generation>>();
+	for (auto & hypothesis : beam) {
+		containers::push_back(result, TeamHypothesis<generation>(finish_team(hypothesis.team), hypothesis.probability / total));
+	}
+	return result;
 }
 
 #define INSTANTIATE(generation) \
-	template auto predict_team_impl(StatsUser stats_user, SeenTeam<generation> team) -> Team<generation>
+	template auto predict_team_impl(StatsUser stats_user, SeenTeam<generation> team) -> Team<generation>; \
+	template auto predict_teams_impl(UsageStats const & usage_stats, Estimate estimate, SeenTeam<generation> team, HypothesisBudget budget) -> containers::vector<TeamHypothesis<generation>>; \
+	template auto predict_team_recording(StatsUser stats_user, SeenTeam<generation> team, PredictionChoices & choices) -> Team<generation>; \
+	template auto predict_team_replaying(PredictionChoices const & choices, SeenTeam<generation> team) -> Team<generation>
 
 TM_FOR_EACH_GENERATION(INSTANTIATE);
 
@@ -0,0 +1,73 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <doctest/doctest.h>
+
+export module tm.test.team_predictor.all_usage_stats;
+
+import tm.team_predictor.all_usage_stats;
+import tm.team_predictor.usage_stats;
+
+import tm.test.usage_bytes;
+
+import tm.generation;
+
+import containers;
+import std_module;
+
+namespace technicalmachine {
+namespace {
+
+auto loads = std::atomic<int>(0);
+
+auto counting_stats_for_generation(Generation const generation) -> UsageStats {
+	++loads;
+	return bytes_to_usage_stats(smallest_team_bytes(generation));
+}
+
+TEST_CASE("AllUsageStats loads each generation once on first use") {
+	loads = 0;
+	auto const all_usage_stats = AllUsageStats(counting_stats_for_generation);
+	CHECK(loads == 0);
+	auto const first = all_usage_stats[Generation::one];
+	CHECK(loads == 1);
+	auto const second = all_usage_stats[Generation::one];
+	CHECK(loads == 1);
+	CHECK(first == second);
+}
+
+TEST_CASE("AllUsageStats unloads the least recently used generation") {
+	loads = 0;
+	auto const all_usage_stats = AllUsageStats(counting_stats_for_generation, 2U);
+	[[maybe_unused]] auto const one = all_usage_stats[Generation::one];
+	auto const two = all_usage_stats[Generation::two];
+	// Generation 2 becomes the least recently used
+	[[maybe_unused]] auto const one_again = all_usage_stats[Generation::one];
+	CHECK(loads == 2);
+	[[maybe_unused]] auto const three = all_usage_stats[Generation::three];
+	CHECK(loads == 3);
+	[[maybe_unused]] auto const one_still_loaded = all_usage_stats[Generation::one];
+	CHECK(loads == 3);
+	auto const two_reloaded = all_usage_stats[Generation::two];
+	CHECK(loads == 4);
+	// The caller's reference outlives the unload
+	CHECK(two != two_reloaded);
+	CHECK(containers::size(two->assuming().map()) == containers::size(two_reloaded->assuming().map()));
+}
+
+TEST_CASE("AllUsageStats prefetch") {
+	loads = 0;
+	{
+		auto const all_usage_stats = AllUsageStats(counting_stats_for_generation);
+		all_usage_stats.prefetch(Generation::four);
+		[[maybe_unused]] auto const four = all_usage_stats[Generation::four];
+	}
+	CHECK(loads == 1);
+}
+
+} // namespace
+} // namespace technicalmachine
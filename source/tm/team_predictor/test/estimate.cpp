@@ -42,8 +42,10 @@ TEST_CASE("team_predictor: Estimate") {
 		estimate.update(usage_stats, Species::Mew);
 		CHECK(estimate.probability(Species::Mew) == 0.0);
 		CHECK(estimate.probability(Species::Mew, MoveName::Cut) > 0.0);
+		CHECK(estimate.most_likely_move(Species::Mew) == MoveName::Cut);
 		estimate.update(usage_stats, Species::Mew, MoveName::Cut);
 		CHECK(estimate.probability(Species::Mew, MoveName::Cut) == 0.0);
+		CHECK(!estimate.most_likely_move(Species::Mew));
 	}
 }
 
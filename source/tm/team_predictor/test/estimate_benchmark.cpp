@@ -0,0 +1,176 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures copying an `Estimate` and updating it with what is seen of a team,
+// which is what the team predictor does for every hypothesis it considers.
+// Uses the real generation 4 OU usage stats.
+
+#include <benchmark/benchmark.h>
+
+import tm.move.move_name;
+
+import tm.pokemon.species;
+
+import tm.team_predictor.all_usage_stats;
+import tm.team_predictor.estimate;
+import tm.team_predictor.usage_stats;
+import tm.team_predictor.usage_stats_probabilities;
+
+import tm.ability;
+import tm.generation;
+import tm.item;
+import tm.weight;
+
+import bounded;
+import containers;
+import std_module;
+
+namespace technicalmachine {
+namespace {
+using namespace bounded::literal;
+
+// What `Estimate` did before its values were stored in columns: a map of
+// species to maps of each kind of key, each updated with a lookup per key.
+struct MapEstimate {
+	struct PerSpecies {
+		double usage;
+		containers::flat_map<MoveName, double> moves;
+		containers::flat_map<Item, double> items;
+		containers::flat_map<Ability, double> abilities;
+	};
+
+	explicit MapEstimate(UsageStats const & usage_stats):
+		m_estimate(containers::transform(usage_stats.assuming().map(), [](auto const & value) {
+			auto const transformer = [](auto const element) {
+				return containers::map_value_type{element.key, static_cast<double>(element.mapped)};
+			};
+			auto const & probabilities = value.mapped;
+			return containers::map_value_type{
+				value.key,
+				PerSpecies{
+					containers::sum(containers::transform(probabilities.moves.map(), [](auto const & element) { return static_cast<double>(element.mapped); })),
+					containers::flat_map<MoveName, double>(containers::transform(probabilities.moves.map(), transformer)),
+					containers::flat_map<Item, double>(containers::transform(probabilities.items.map(), transformer)),
+					containers::flat_map<Ability, double>(containers::transform(probabilities.abilities.map(), transformer))
+				}
+			};
+		}))
+	{
+	}
+	auto update(UsageStats const & usage_stats, Species const species) -> void {
+		if (auto const probabilities = usage_stats.assuming(species)) {
+			do_update(*probabilities, usage_stats.assuming());
+		}
+		if (auto const species_data = containers::lookup(m_estimate, species)) {
+			species_data->usage = 0.0;
+		}
+	}
+	auto update(UsageStats const & usage_stats, Species const species, MoveName const move) -> void {
+		if (auto const probabilities = usage_stats.assuming(species, move)) {
+			do_update(*probabilities, *usage_stats.assuming(species));
+		}
+		if (auto const species_data = containers::lookup(m_estimate, species)) {
+			containers::keyed_erase(species_data->moves, move);
+		}
+	}
+
+private:
+	static auto update_per_species(auto & data, auto const & per_species, auto const base_per_species) -> void {
+		for (auto & element : data) {
+			auto const base = base_per_species(element.key);
+			element.mapped *= bounded::max(
+				base == Weight(0.0F) ? 0.0 : static_cast<double>(per_species(element.key) / base),
+				1.0 / 1'000'000.0
+			);
+		}
+	}
+
+	auto do_update(UsageStatsProbabilities const & probability, UsageStatsProbabilities const & base_probability) -> void {
+		for (auto & per_species : m_estimate) {
+			auto const species = per_species.key;
+			auto const species_estimate = containers::lookup(probability.map(), species);
+			if (!species_estimate) {
+				per_species.mapped.usage = 0.0;
+				continue;
+			}
+			auto const base_per_species = base_probability(species);
+			update_per_species(
+				per_species.mapped.moves,
+				species_estimate->moves,
+				[=](MoveName const move) { return base_per_species ? base_per_species->moves(move) : Weight(0.0F); }
+			);
+			update_per_species(
+				per_species.mapped.items,
+				species_estimate->items,
+				[=](Item const item) { return base_per_species ? base_per_species->items(item) : Weight(0.0F); }
+			);
+			update_per_species(
+				per_species.mapped.abilities,
+				species_estimate->abilities,
+				[=](Ability const ability) { return base_per_species ? base_per_species->abilities(ability) : Weight(0.0F); }
+			);
+			per_species.mapped.usage =
+				per_species.mapped.usage == 0.0 ?
+				0.0 :
+				containers::sum(containers::transform(per_species.mapped.moves, containers::get_mapped));
+		}
+	}
+
+	containers::flat_map<Species, PerSpecies> m_estimate;
+};
+
+struct Seen {
+	Species species;
+	MoveName move;
+};
+
+// The most common species, each with its most common move
+auto most_common(UsageStats const & usage_stats) -> containers::vector<Seen> {
+	auto const estimate = Estimate(usage_stats);
+	auto result = containers::vector<Seen>();
+	for (auto const choice : estimate.species_choices()) {
+		if (containers::size(result) == 6_bi) {
+			break;
+		}
+		if (auto const move = estimate.most_likely_move(choice.key)) {
+			containers::push_back(result, Seen(choice.key, *move));
+		}
+	}
+	return result;
+}
+
+template<typename EstimateType>
+auto copy_and_update(benchmark::State & state) -> void {
+	auto const all_usage_stats = AllUsageStats();
+	auto const loaded = [&] -> LoadedUsageStats {
+		try {
+			return all_usage_stats[Generation::four];
+		} catch (std::exception const &) {
+			return nullptr;
+		}
+	}();
+	if (!loaded) {
+		state.SkipWithError("Unable to load usage stats");
+		return;
+	}
+	auto const & usage_stats = *loaded;
+	auto const seen = most_common(usage_stats);
+	auto const initial = EstimateType(usage_stats);
+	for (auto _ : state) {
+		auto estimate = initial;
+		for (auto const value : seen) {
+			estimate.update(usage_stats, value.species);
+			estimate.update(usage_stats, value.species, value.move);
+		}
+		benchmark::DoNotOptimize(estimate);
+	}
+	state.SetItemsProcessed(state.iterations() * 2 * static_cast<std::int64_t>(containers::size(seen)));
+}
+
+BENCHMARK(copy_and_update<Estimate>);
+BENCHMARK(copy_and_update<MapEstimate>);
+
+} // namespace
+} // namespace technicalmachine
@@ -0,0 +1,236 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+import tm.clients.ps.battle_message_handler;
+import tm.clients.ps.event_block;
+import tm.clients.ps.parsed_team;
+
+import tm.clients.party;
+
+import tm.move.move_name;
+
+import tm.pokemon.max_pokemon_per_team;
+import tm.pokemon.species;
+
+import tm.ps_usage_stats.battle_log_to_messages;
+import tm.ps_usage_stats.battle_result;
+import tm.ps_usage_stats.for_each_log;
+import tm.ps_usage_stats.rated_side;
+import tm.ps_usage_stats.thread_count;
+
+import tm.team_predictor.all_usage_stats;
+import tm.team_predictor.team_predictor;
+
+import tm.generation;
+import tm.operators;
+import tm.state;
+import tm.team;
+
+import bounded;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+using namespace ps_usage_stats;
+
+struct ParsedArgs {
+	ThreadCount thread_count;
+	std::filesystem::path input_directory;
+};
+
+auto parse_args(int argc, char const * const * argv) -> ParsedArgs {
+	if (argc != 3) {
+		throw std::runtime_error("Usage is score_predict_team thread_count input_directory");
+	}
+	auto const thread_count = bounded::to_integer<ThreadCount>(argv[1]);
+	auto input_directory = std::filesystem::path(argv[2]);
+	if (!std::filesystem::exists(input_directory)) {
+		throw std::runtime_error(containers::concatenate<std::string>(input_directory.string(), " does not exist"_s));
+	}
+	return ParsedArgs{
+		thread_count,
+		std::move(input_directory)
+	};
+}
+
+struct Count {
+	std::uint64_t correct = 0U;
+	std::uint64_t total = 0U;
+
+	auto add(bool const is_correct) & -> void {
+		correct += is_correct ? 1U : 0U;
+		++total;
+	}
+
+	friend constexpr auto operator+(Count const lhs, Count const rhs) -> Count {
+		return Count(lhs.correct + rhs.correct, lhs.total + rhs.total);
+	}
+};
+
+// Only counts what had not been revealed when the prediction was made
+struct Accuracy {
+	Count species;
+	Count moves;
+	Count items;
+	Count abilities;
+	std::uint64_t predictions = 0U;
+	std::chrono::nanoseconds time = std::chrono::nanoseconds(0);
+
+	friend constexpr auto operator+(Accuracy const & lhs, Accuracy const & rhs) -> Accuracy {
+		return Accuracy(
+			lhs.species + rhs.species,
+			lhs.moves + rhs.moves,
+			lhs.items + rhs.items,
+			lhs.abilities + rhs.abilities,
+			lhs.predictions + rhs.predictions,
+			lhs.time + rhs.time
+		);
+	}
+};
+
+// Indexed by the number of foe Pokemon revealed at the time of the prediction
+struct Results {
+	static constexpr auto size = max_pokemon_per_team + 1_bi;
+	containers::array<Accuracy, size> by_revealed;
+
+	friend auto operator+(Results const & lhs, Results const & rhs) -> Results {
+		auto result = lhs;
+		for (auto const index : containers::integer_range(size)) {
+			result.by_revealed[index] = lhs.by_revealed[index] + rhs.by_revealed[index];
+		}
+		return result;
+	}
+};
+
+auto move_names(auto const & pokemon) {
+	return containers::transform(pokemon.regular_moves(), [](auto const move) { return move.name(); });
+}
+
+template<Generation generation>
+auto score_prediction(
+	SeenTeam<generation> const & seen,
+	Team<generation> const & predicted,
+	ps::ParsedTeam const & actual,
+	Accuracy & accuracy
+) -> void {
+	auto find_seen = [&](Species const species) {
+		return containers::maybe_find_if(seen.all_pokemon(), [=](auto const & pokemon) { return pokemon.species() == species; });
+	};
+	auto find_predicted = [&](Species const species) {
+		return containers::maybe_find_if(predicted.all_pokemon(), [=](auto const & pokemon) { return pokemon.species() == species; });
+	};
+	for (auto const & pokemon : actual) {
+		auto const seen_pokemon = find_seen(pokemon.species);
+		auto const predicted_pokemon = find_predicted(pokemon.species);
+		if (!seen_pokemon) {
+			accuracy.species.add(static_cast<bool>(predicted_pokemon));
+		}
+		if (!predicted_pokemon) {
+			continue;
+		}
+		for (auto const move : pokemon.moves) {
+			if (seen_pokemon and containers::any_equal(move_names(*seen_pokemon), move)) {
+				continue;
+			}
+			accuracy.moves.add(containers::any_equal(move_names(*predicted_pokemon), move));
+		}
+		if constexpr (generation >= Generation::two) {
+			if (!seen_pokemon or !seen_pokemon->item_is_known()) {
+				accuracy.items.add(predicted_pokemon->item(false, false) == pokemon.item);
+			}
+		}
+		if constexpr (generation >= Generation::three) {
+			if (!seen_pokemon or !seen_pokemon->ability_is_known()) {
+				accuracy.abilities.add(predicted_pokemon->initial_ability() == pokemon.ability);
+			}
+		}
+	}
+}
+
+auto score_one_side_of_battle(
+	std::filesystem::path const & input_file,
+	AllUsageStats const & all_usage_stats,
+	RatedSide const & rated_side,
+	BattleLogMessages const & battle_messages,
+	ps::ParsedTeam const & foe_team
+) -> Results {
+	auto battle = ps::BattleMessageHandler(rated_side.side.party, rated_side.side.team, battle_messages.init);
+	auto results = Results();
+	try {
+		for (auto const & message : battle_messages.messages) {
+			tv::visit(battle.state(), [&]<Generation generation>(VisibleState<generation> const & state) {
+				auto const revealed = containers::size(state.foe.all_pokemon());
+				if (revealed == 0_bi) {
+					return;
+				}
+				auto const usage_stats = all_usage_stats[generation];
+				auto const start = std::chrono::steady_clock::now();
+				auto const predicted = most_likely_team(*usage_stats, state.foe);
+				auto & accuracy = results.by_revealed[revealed];
+				accuracy.time += std::chrono::steady_clock::now() - start;
+				++accuracy.predictions;
+				score_prediction(state.foe, predicted, foe_team, accuracy);
+			});
+			battle.handle_message(message);
+		}
+	} catch (std::exception const & ex) {
+		auto const party_str = rated_side.side.party == Party(0_bi) ? "p1"_s : "p2"_s;
+		std::cerr << "Unable to process " << input_file.string() << ", side " << party_str << ": " << ex.what() << ", skipping the rest of the battle\n";
+	}
+	return results;
+}
+
+auto percent(Count const count) -> double {
+	return count.total == 0U ? 0.0 : 100.0 * static_cast<double>(count.correct) / static_cast<double>(count.total);
+}
+
+auto print(std::ostream & stream, containers::string_view const label, Accuracy const & accuracy) -> void {
+	auto const seconds = std::chrono::duration<double>(accuracy.time).count();
+	stream
+		<< label
+		<< ": " << accuracy.predictions << " predictions"
+		<< ", species " << percent(accuracy.species) << "%"
+		<< ", moves " << percent(accuracy.moves) << "%"
+		<< ", items " << percent(accuracy.items) << "%"
+		<< ", abilities " << percent(accuracy.abilities) << "%"
+		<< ", " << (seconds == 0.0 ? 0.0 : static_cast<double>(accuracy.predictions) / seconds) << " predictions per second per thread\n";
+}
+
+} // namespace technicalmachine
+
+auto main(int argc, char ** argv) -> int {
+	using namespace technicalmachine;
+	auto const args = parse_args(argc, argv);
+	auto const all_usage_stats = AllUsageStats();
+	auto const start = std::chrono::steady_clock::now();
+	auto const results = for_each_log(
+		args.thread_count,
+		args.input_directory,
+		[&](
+			std::filesystem::path const & input_file,
+			RatedSide const & side,
+			BattleLogMessages const & battle_messages,
+			BattleResult::Side const & foe
+		) {
+			return score_one_side_of_battle(input_file, all_usage_stats, side, battle_messages, foe.team);
+		}
+	);
+	auto const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	auto total = Accuracy();
+	for (auto const index : containers::integer_range(Results::size)) {
+		auto const & accuracy = results.by_revealed[index];
+		if (accuracy.predictions == 0U) {
+			continue;
+		}
+		print(std::cout, containers::concatenate<containers::string>(containers::to_string(index), " revealed"_s), accuracy);
+		total = total + accuracy;
+	}
+	print(std::cout, "Total"_s, total);
+	std::cout << "Wall time: " << seconds << " seconds\n";
+	return 0;
+}
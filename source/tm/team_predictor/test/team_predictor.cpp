@@ -0,0 +1,123 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <doctest/doctest.h>
+
+export module tm.test.team_predictor.team_predictor;
+
+import tm.move.move;
+import tm.move.move_name;
+
+import tm.pokemon.species;
+
+import tm.string_conversions.team;
+
+import tm.team_predictor.team_predictor;
+import tm.team_predictor.usage_stats;
+
+import tm.test.make_seen_team;
+import tm.test.usage_bytes;
+
+import tm.ability;
+import tm.generation;
+import tm.item;
+import tm.team;
+
+import bounded;
+import containers;
+import std_module;
+
+namespace technicalmachine {
+namespace {
+using namespace bounded::literal;
+
+constexpr auto generation = Generation::one;
+
+auto check_same_prediction(IncrementalTeamPredictor & predictor, UsageStats const & usage_stats, SeenTeam<generation> const & team) -> void {
+	constexpr auto include_active_marker = false;
+	auto const expected = to_string(most_likely_team(usage_stats, team), include_active_marker);
+	CHECK(to_string(predictor.most_likely_team(team), include_active_marker) == expected);
+	// The second prediction reuses the first
+	CHECK(to_string(predictor.most_likely_team(team), include_active_marker) == expected);
+}
+
+TEST_CASE("IncrementalTeamPredictor predicts the same team as most_likely_team") {
+	auto const usage_stats = bytes_to_usage_stats(smallest_team_bytes(generation));
+	auto predictor = IncrementalTeamPredictor(usage_stats);
+
+	check_same_prediction(predictor, usage_stats, SeenTeam<generation>(1_bi));
+
+	auto team = make_seen_team<generation>({.team_size = 1_bi, .species = Species::Mew});
+	check_same_prediction(predictor, usage_stats, team);
+
+	team.pokemon().add_move(Move(generation, MoveName::Cut));
+	check_same_prediction(predictor, usage_stats, team);
+
+	// Not an extension of what was previously revealed
+	check_same_prediction(predictor, usage_stats, SeenTeam<generation>(1_bi));
+}
+
+struct PokemonDescription {
+	Species species;
+	containers::static_vector<MoveName, 4_bi> moves;
+	Item item;
+	Ability ability;
+
+	friend auto operator==(PokemonDescription const &, PokemonDescription const &) -> bool = default;
+};
+
+// Two teams with the same description differ only in the order of their
+// Pokemon or of their moves
+template<Generation g>
+auto describe(Team<g> const & team) -> containers::vector<PokemonDescription> {
+	auto result = containers::vector<PokemonDescription>(containers::transform(team.all_pokemon(), [](auto const & pokemon) {
+		auto moves = containers::static_vector<MoveName, 4_bi>(containers::transform(
+			pokemon.regular_moves(),
+			[](Move const move) { return move.name(); }
+		));
+		containers::sort(moves);
+		return PokemonDescription(pokemon.species(), moves, pokemon.item(false, false), pokemon.initial_ability());
+	}));
+	containers::sort(result, [](PokemonDescription const & lhs, PokemonDescription const & rhs) {
+		return lhs.species < rhs.species;
+	});
+	return result;
+}
+
+TEST_CASE("most_likely_teams") {
+	constexpr auto include_active_marker = false;
+	constexpr auto beam_generation = Generation::three;
+	auto const usage_stats = bytes_to_usage_stats(several_species_bytes(beam_generation));
+	auto const team = SeenTeam<beam_generation>(2_bi);
+
+	auto const greedy = most_likely_teams(usage_stats, team, HypothesisBudget(1U));
+	CHECK(containers::size(greedy) == 1_bi);
+	CHECK(containers::front(greedy).probability == 1.0);
+	CHECK(to_string(containers::front(greedy).team, include_active_marker) == to_string(most_likely_team(usage_stats, team), include_active_marker));
+
+	auto const several = most_likely_teams(usage_stats, team, HypothesisBudget(8U));
+	CHECK(containers::size(several) > 1_bi);
+	CHECK(containers::size(several) <= 8_bi);
+	auto total = 0.0;
+	auto previous = 1.0;
+	auto descriptions = containers::vector<containers::vector<PokemonDescription>>();
+	for (auto const & hypothesis : several) {
+		CHECK(hypothesis.probability <= previous);
+		previous = hypothesis.probability;
+		total += hypothesis.probability;
+		auto description = describe(hypothesis.team);
+		CHECK(!containers::any_equal(descriptions, description));
+		containers::push_back(descriptions, std::move(description));
+	}
+	CHECK(total == doctest::Approx(1.0));
+
+	auto const expired = most_likely_teams(usage_stats, team, HypothesisBudget(8U, std::chrono::steady_clock::time_point()));
+	CHECK(containers::size(expired) < containers::size(several));
+}
+
+} // namespace
+} // namespace technicalmachine
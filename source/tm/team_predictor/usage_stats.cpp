@@ -15,6 +15,7 @@ import tm.pokemon.species;
 
 import tm.ps_usage_stats.header;
 
+import tm.team_predictor.key_columns;
 import tm.team_predictor.usage_stats_probabilities;
 
 import tm.ability;
@@ -25,20 +26,23 @@ import tm.weight;
 
 import bounded;
 import containers;
+import tv;
 import std_module;
 
 namespace technicalmachine {
 namespace {
 using namespace bounded::literal;
 
-auto check_header(std::istream & stream) -> void {
+auto read_header(std::istream & stream) -> UsageStatsVersion {
 	auto str = read_bytes(stream, containers::size(usage_stats_magic_string));
 	if (str != usage_stats_magic_string) {
 		throw std::runtime_error("Invalid magic string");
 	}
-	if (read<UsageStatsVersion>(stream) != 0_bi) {
+	auto const version = read<UsageStatsVersion>(stream);
+	if (version > latest_usage_stats_version) {
 		throw std::runtime_error("Invalid version");
 	}
+	return version;
 }
 
 struct SpeedDistribution {
@@ -108,41 +112,169 @@ constexpr auto checked_insert(Container & container, typename Container::key_typ
 	return containers::get_mapped(*result.iterator);
 }
 
-struct ReadMoveData {
-	[[no_unique_address]] Weight<double> weight;
-	[[no_unique_address]] SpeedDistribution speed_distribution;
-	[[no_unique_address]] UsageStatsProbabilities::Map teammates;
+auto read_own_species(std::istream & stream, Generation const generation, Weight<double> const species_weight) -> UsageStatsProbabilities::Inner {
+	return UsageStatsProbabilities::Inner{
+		read_inner_probabilities<MoveName>(stream, species_weight),
+		read_items(stream, generation, species_weight),
+		read_abilities(stream, generation, species_weight)
+	};
+}
+
+// The data for one move of a species, after the move and its weight
+auto read_move_probabilities(std::istream & stream, Generation const generation, Species const species, Weight<double> const species_weight) -> UsageStatsProbabilities {
+	[[maybe_unused]] auto speed_distribution = read_speed_distribution(stream);
+	auto teammates = read_probabilities_map(stream);
+	checked_insert(
+		teammates,
+		species,
+		[&] { return read_own_species(stream, generation, species_weight); }
+	);
+	return UsageStatsProbabilities(std::move(teammates));
+}
+
+// The data for a species or a move is parsed on first access. Version 0 files
+// must be parsed up front, so they are constructed already parsed.
+struct LazyProbabilities {
+	explicit LazyProbabilities(UsageStatsOffset const offset):
+		m_offset(offset)
+	{
+	}
+	explicit LazyProbabilities(UsageStatsProbabilities value):
+		m_value(std::move(value))
+	{
+		std::call_once(m_flag, [] {});
+	}
+
+	auto get(auto const parse) const -> UsageStatsProbabilities const & {
+		std::call_once(m_flag, [&] {
+			m_value.emplace([&] { return parse(m_offset); });
+		});
+		return *m_value;
+	}
+
+private:
+	UsageStatsOffset m_offset = 0_bi;
+	mutable std::once_flag m_flag;
+	mutable tv::optional<UsageStatsProbabilities> m_value;
+};
+
+struct TableEntry {
+	Weight<double> weight;
+	UsageStatsOffset offset;
 };
 
-auto move_reader(std::istream & stream, Generation const generation, Species const species, Weight<double> const species_weight) {
-	return map_reader<MoveName>(stream, [=, &stream] {
+template<typename Key>
+auto table_reader(std::istream & stream) {
+	return map_reader<Key>(stream, [&] {
 		auto const weight = read_weight(stream);
-		auto speed_distribution = read_speed_distribution(stream);
-		auto teammates = read_probabilities_map(stream);
-		checked_insert(
-			teammates,
-			species,
-			[&] {
-				return UsageStatsProbabilities::Inner{
-					read_inner_probabilities<MoveName>(stream, species_weight),
-					read_items(stream, generation, species_weight),
-					read_abilities(stream, generation, species_weight)
-				};
-			}
-		);
-		return ReadMoveData{
-			weight,
-			std::move(speed_distribution),
-			std::move(teammates)
-		};
+		auto const offset = read<UsageStatsOffset>(stream);
+		return TableEntry(weight, offset);
 	});
 }
 
+// Reads everything after the current position with a single `read`
+auto read_remaining_bytes(std::istream & stream) -> containers::vector<std::byte> {
+	auto const start = stream.tellg();
+	stream.seekg(0, std::ios_base::end);
+	auto const end = stream.tellg();
+	stream.seekg(start);
+	auto result = containers::vector<std::byte>(containers::repeat_default_n<std::byte>(
+		bounded::check_in_range<containers::array_size_type<std::byte>>(static_cast<std::uintmax_t>(end - start))
+	));
+	auto const size = static_cast<std::streamsize>(containers::size(result));
+	stream.read(reinterpret_cast<char *>(containers::data(result)), size);
+	if (stream.gcount() != size) {
+		throw std::runtime_error("Unable to read stats file");
+	}
+	return result;
+}
+
+auto stream_at(containers::vector<std::byte> const & bytes, UsageStatsOffset const offset) -> std::ispanstream {
+	auto const size = static_cast<std::size_t>(containers::size(bytes));
+	auto const start = static_cast<std::size_t>(offset);
+	if (start > size) {
+		throw std::runtime_error("Invalid offset in stats file");
+	}
+	auto stream = std::ispanstream(std::span<char const>(reinterpret_cast<char const *>(containers::data(bytes)) + start, size - start));
+	stream.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+	return stream;
+}
+
 } // namespace
 
 export struct UsageStats {
 	static auto make(std::istream && stream) -> UsageStats {
-		check_header(stream);
+		auto const version = read_header(stream);
+		switch (version.value()) {
+			case 0: return make_v0(stream);
+			case 1: return make_v1(stream);
+			default: std::unreachable();
+		}
+	}
+
+	auto assuming() const -> UsageStatsProbabilities const & {
+		return m_probabilities;
+	}
+	auto columns() const -> KeyColumns const & {
+		return m_columns;
+	}
+	// Different for every `UsageStats` created by this process, even one that
+	// reuses the address of one that was destroyed
+	auto load_id() const -> std::uint64_t {
+		return m_load_id;
+	}
+	auto assuming(Species const species) const -> UsageStatsProbabilities const * {
+		auto const per_species = containers::lookup(m_data, species);
+		if (!per_species) {
+			return nullptr;
+		}
+		return std::addressof(per_species->probabilities->get([&](UsageStatsOffset const offset) {
+			auto species_stream = stream_at(m_bytes, offset);
+			auto teammates = read_probabilities_map(species_stream);
+			checked_insert(
+				teammates,
+				species,
+				bounded::value_to_function(per_species->own_species)
+			);
+			return UsageStatsProbabilities(std::move(teammates));
+		}));
+	}
+	auto assuming(Species const species, MoveName const move) const -> UsageStatsProbabilities const * {
+		auto const per_species = containers::lookup(m_data, species);
+		if (!per_species) {
+			return nullptr;
+		}
+		auto const per_move = containers::lookup(per_species->used_moves, move);
+		if (!per_move) {
+			return nullptr;
+		}
+		return std::addressof((*per_move)->get([&](UsageStatsOffset const offset) {
+			auto move_stream = stream_at(m_bytes, offset);
+			return read_move_probabilities(move_stream, m_generation, species, per_species->weight);
+		}));
+	}
+
+private:
+	using UsedMoves = containers::flat_map<MoveName, std::unique_ptr<LazyProbabilities>>;
+	struct PerSpecies {
+		Weight<double> weight;
+		UsageStatsProbabilities::Inner own_species;
+		UsedMoves used_moves;
+		std::unique_ptr<LazyProbabilities> probabilities;
+	};
+	using Data = containers::flat_map<Species, PerSpecies>;
+
+	explicit UsageStats(Generation const generation, containers::vector<std::byte> bytes, Data data, UsageStatsProbabilities probabilities):
+		m_generation(generation),
+		m_bytes(std::move(bytes)),
+		m_data(std::move(data)),
+		m_probabilities(std::move(probabilities)),
+		m_columns(m_probabilities),
+		m_load_id(++loads)
+	{
+	}
+
+	static auto make_v0(std::istream & stream) -> UsageStats {
 		// TODO: Confirm this is the expected generation?
 		auto const generation = read<Generation>(stream);
 		auto data = Data();
@@ -152,78 +284,119 @@ export struct UsageStats {
 			auto const species_weight = read_weight(stream);
 			[[maybe_unused]] auto speed_distribution = read_speed_distribution(stream);
 			auto per_species_probabilities = read_probabilities_map(stream);
-			auto & for_this_species = checked_insert(
-				per_species_probabilities,
+			auto & probabilities_assuming_species = checked_insert(
+				probabilities,
 				species,
 				bounded::construct<UsageStatsProbabilities::Inner>
 			);
+			auto own_species = UsageStatsProbabilities::Inner();
+			auto used_moves = UsedMoves();
+			for (auto const move : read_map<MoveName>(stream)) {
+				auto const weight = read_weight(stream);
+				checked_insert(
+					own_species.moves,
+					move,
+					bounded::value_to_function(Weight<float>(weight))
+				);
+				checked_insert(
+					probabilities_assuming_species.moves,
+					move,
+					bounded::value_to_function(Weight<float>(species_weight * weight))
+				);
+				checked_insert(
+					used_moves,
+					move,
+					[&] {
+						return std::make_unique<LazyProbabilities>(
+							read_move_probabilities(stream, generation, species, species_weight)
+						);
+					}
+				);
+			}
+			own_species.items = read_items(stream, generation, species_weight);
+			probabilities_assuming_species.items = own_species.items;
+			own_species.abilities = read_abilities(stream, generation, species_weight);
+			probabilities_assuming_species.abilities = own_species.abilities;
+			checked_insert(per_species_probabilities, species, bounded::value_to_function(own_species));
+			checked_insert(data, species, [&] {
+				return PerSpecies{
+					species_weight,
+					std::move(own_species),
+					std::move(used_moves),
+					std::make_unique<LazyProbabilities>(UsageStatsProbabilities(std::move(per_species_probabilities)))
+				};
+			});
+		}
+		return UsageStats(generation, {}, std::move(data), UsageStatsProbabilities(std::move(probabilities)));
+	}
+
+	// Reads only the tables and the summary of each species. Everything else
+	// is parsed on first access.
+	static auto make_v1(std::istream & stream) -> UsageStats {
+		auto bytes = read_remaining_bytes(stream);
+		auto body = stream_at(bytes, 0_bi);
+		// TODO: Confirm this is the expected generation?
+		auto const generation = read<Generation>(body);
+		auto data = Data();
+		auto probabilities = UsageStatsProbabilities::Map();
+		for (auto const species_entry : table_reader<Species>(body)) {
+			auto const species = species_entry.key;
+			auto const species_weight = species_entry.mapped.weight;
+			auto const species_offset = species_entry.mapped.offset;
+			auto species_stream = stream_at(bytes, species_offset);
+			auto own_species = UsageStatsProbabilities::Inner();
 			auto & probabilities_assuming_species = checked_insert(
 				probabilities,
 				species,
 				bounded::construct<UsageStatsProbabilities::Inner>
 			);
-			auto used_moves = UsedMoves();
-			for (auto move : move_reader(stream, generation, species, species_weight)) {
+			for (auto const move : map_reader<MoveName>(species_stream, [&] { return read_weight(species_stream); })) {
 				checked_insert(
-					for_this_species.moves,
+					own_species.moves,
 					move.key,
-					bounded::value_to_function(Weight<float>(move.mapped.weight))
+					bounded::value_to_function(Weight<float>(move.mapped))
 				);
 				checked_insert(
 					probabilities_assuming_species.moves,
 					move.key,
-					bounded::value_to_function(Weight<float>(species_weight * move.mapped.weight))
+					bounded::value_to_function(Weight<float>(species_weight * move.mapped))
 				);
+			}
+			own_species.items = read_items(species_stream, generation, species_weight);
+			probabilities_assuming_species.items = own_species.items;
+			own_species.abilities = read_abilities(species_stream, generation, species_weight);
+			probabilities_assuming_species.abilities = own_species.abilities;
+
+			auto used_moves = UsedMoves();
+			for (auto const move_entry : table_reader<MoveName>(species_stream)) {
 				checked_insert(
 					used_moves,
-					move.key,
-					[&] { return UsageStatsProbabilities(std::move(move.mapped.teammates)); }
+					move_entry.key,
+					[&] { return std::make_unique<LazyProbabilities>(species_offset + move_entry.mapped.offset); }
 				);
 			}
-			for_this_species.items = read_items(stream, generation, species_weight);
-			probabilities_assuming_species.items = for_this_species.items;
-			for_this_species.abilities = read_abilities(stream, generation, species_weight);
-			probabilities_assuming_species.abilities = for_this_species.abilities;
+			// The speed distribution and teammates follow the move table
+			auto const details_offset = species_offset + bounded::check_in_range<UsageStatsOffset>(bounded::integer(species_stream.tellg()));
 			checked_insert(data, species, [&] {
 				return PerSpecies{
+					species_weight,
+					std::move(own_species),
 					std::move(used_moves),
-					UsageStatsProbabilities(std::move(per_species_probabilities))
+					std::make_unique<LazyProbabilities>(details_offset)
 				};
 			});
 		}
-		return UsageStats(std::move(data), UsageStatsProbabilities(std::move(probabilities)));
-	}
-
-	auto assuming() const -> UsageStatsProbabilities const & {
-		return m_probabilities;
-	}
-	auto assuming(Species const species) const -> UsageStatsProbabilities const * {
-		auto const per_species = containers::lookup(m_data, species);
-		return per_species ? std::addressof(per_species->probabilities) : nullptr;
-	}
-	auto assuming(Species const species, MoveName const moves) const -> UsageStatsProbabilities const * {
-		auto const per_species = containers::lookup(m_data, species);
-		return per_species ?
-			containers::lookup(per_species->used_moves, moves) :
-			nullptr;
-	}
-
-private:
-	using UsedMoves = containers::flat_map<MoveName, UsageStatsProbabilities>;
-	struct PerSpecies {
-		UsedMoves used_moves;
-		UsageStatsProbabilities probabilities;
-	};
-	using Data = containers::flat_map<Species, PerSpecies>;
-
-	explicit UsageStats(Data data, UsageStatsProbabilities probabilities):
-		m_data(std::move(data)),
-		m_probabilities(std::move(probabilities))
-	{
+		return UsageStats(generation, std::move(bytes), std::move(data), UsageStatsProbabilities(std::move(probabilities)));
 	}
 
+	Generation m_generation;
+	containers::vector<std::byte> m_bytes;
 	Data m_data;
 	UsageStatsProbabilities m_probabilities;
+	KeyColumns m_columns;
+	std::uint64_t m_load_id;
+
+	static inline auto loads = std::atomic<std::uint64_t>(0U);
 };
 
 } // namespace technicalmachine
@@ -37,6 +37,7 @@ import tm.team_predictor.ev_optimizer.speed;
 import tm.generation;
 
 import bounded;
+import containers;
 import tv;
 import std_module;
 
@@ -93,6 +94,40 @@ TEST_CASE("EV Optimizer: Optimize EVs below level 100") {
 	[[maybe_unused]] auto const optimized = optimize_evs(ivs_and_evs, species, level, hidden_power, include_attack, include_special_attack);
 }
 
+TEST_CASE("EV Optimizer: Repeated optimization from multiple threads") {
+	constexpr auto generation = Generation::four;
+	constexpr auto species = Species::Masquerain;
+	constexpr auto level = Level(83_bi);
+	constexpr auto hidden_power = tv::optional<HiddenPower<generation>>();
+	constexpr auto include_attack = false;
+	constexpr auto include_special_attack = true;
+	constexpr auto ivs_and_evs = CombinedStatsFor<generation>{
+		Nature::Modest,
+		max_dvs_or_ivs<special_input_style_for(generation)>,
+		EVs(
+			EV(192_bi),
+			EV(0_bi),
+			EV(8_bi),
+			EV(120_bi),
+			EV(60_bi),
+			EV(128_bi)
+		)
+	};
+	auto const expected = optimize_evs(ivs_and_evs, species, level, hidden_power, include_attack, include_special_attack);
+	auto results = containers::array<tv::optional<CombinedStatsFor<generation>>, 4_bi>();
+	{
+		auto threads = containers::array<std::jthread, 4_bi>();
+		for (auto const index : containers::integer_range(containers::size(threads))) {
+			threads[index] = std::jthread([&, index] {
+				results[index] = optimize_evs(ivs_and_evs, species, level, hidden_power, include_attack, include_special_attack);
+			});
+		}
+	}
+	for (auto const & result : results) {
+		CHECK(result == expected);
+	}
+}
+
 TEST_CASE("EV Optimizer: Optimize generation 2 EVs") {
 	constexpr auto generation = Generation::two;
 	constexpr auto species = Species::Mew;
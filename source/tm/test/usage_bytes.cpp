@@ -113,6 +113,103 @@ export constexpr auto smallest_team_bytes(Generation const generation) {
 	));
 }
 
+struct TestSpecies {
+	Species species;
+	double weight;
+	containers::static_vector<MoveName, 5_bi> moves;
+	containers::static_vector<Ability, 2_bi> abilities;
+};
+
+// Sorted by species, with each species' moves and abilities sorted
+constexpr auto several_species = containers::array{
+	TestSpecies(Species::Alakazam, 3.0, {MoveName::Body_Slam, MoveName::Psychic, MoveName::Recover}, {Ability::Synchronize, Ability::Inner_Focus}),
+	TestSpecies(Species::Starmie, 4.0, {MoveName::Surf, MoveName::Thunderbolt, MoveName::Psychic, MoveName::Recover}, {Ability::Natural_Cure, Ability::Illuminate}),
+	TestSpecies(Species::Tauros, 5.0, {MoveName::Body_Slam, MoveName::Surf, MoveName::Thunderbolt, MoveName::Earthquake}, {Ability::Intimidate}),
+	TestSpecies(Species::Snorlax, 2.0, {MoveName::Body_Slam, MoveName::Surf, MoveName::Thunderbolt, MoveName::Earthquake, MoveName::Psychic}, {Ability::Immunity, Ability::Thick_Fat})
+};
+
+// Earlier moves and abilities are more likely, so there is one most likely
+// choice
+constexpr auto relative_weight(auto const index) -> double {
+	return 1.0 / static_cast<double>(index + 2_bi);
+}
+
+auto append_speed_distribution(containers::vector<std::byte> & result) -> void {
+	containers::append(result, count_bytes(1));
+	containers::append(result, speed_bytes(7));
+	containers::append(result, weight_bytes(1.0));
+}
+
+auto append_moves(containers::vector<std::byte> & result, TestSpecies const & test_species, auto const include) -> void {
+	auto const count = containers::count_if(test_species.moves, include);
+	containers::append(result, count_bytes(static_cast<std::uint16_t>(count)));
+	for (auto const index : containers::integer_range(containers::size(test_species.moves))) {
+		auto const move = test_species.moves[index];
+		if (include(move)) {
+			containers::append(result, move_bytes(move));
+			containers::append(result, weight_bytes(relative_weight(index)));
+		}
+	}
+}
+
+auto append_teammates(containers::vector<std::byte> & result, Species const species) -> void {
+	containers::append(result, count_bytes(static_cast<std::uint16_t>(containers::size(several_species) - 1_bi)));
+	for (auto const & teammate : several_species) {
+		if (teammate.species == species) {
+			continue;
+		}
+		containers::append(result, species_bytes(teammate.species));
+		containers::append(result, weight_bytes(teammate.weight));
+		append_moves(result, teammate, [](MoveName) { return true; });
+	}
+}
+
+auto append_items_and_abilities(containers::vector<std::byte> & result, Generation const generation, TestSpecies const & test_species) -> void {
+	if (generation >= Generation::two) {
+		containers::append(result, count_bytes(2));
+		containers::append(result, item_bytes(Item::None));
+		containers::append(result, weight_bytes(0.25));
+		containers::append(result, item_bytes(Item::Leftovers));
+		containers::append(result, weight_bytes(0.75));
+	}
+	if (generation >= Generation::three) {
+		containers::append(result, count_bytes(static_cast<std::uint16_t>(containers::size(test_species.abilities))));
+		for (auto const index : containers::integer_range(containers::size(test_species.abilities))) {
+			containers::append(result, ability_bytes(test_species.abilities[index]));
+			containers::append(result, weight_bytes(relative_weight(index)));
+		}
+	}
+}
+
+// Several species, each with several moves, items, and abilities, that all
+// appear on teams with each other. Unlike `smallest_team_bytes`, this gives
+// the team predictor real choices to make.
+export auto several_species_bytes(Generation const generation) -> containers::vector<std::byte> {
+	auto result = containers::vector<std::byte>();
+	containers::append(result, usage_stats_magic_string);
+	containers::append(result, version_bytes(0));
+	containers::append(result, generation_bytes(generation));
+	containers::append(result, count_bytes(static_cast<std::uint16_t>(containers::size(several_species))));
+	for (auto const & test_species : several_species) {
+		containers::append(result, species_bytes(test_species.species));
+		containers::append(result, weight_bytes(test_species.weight));
+		append_speed_distribution(result);
+		append_teammates(result, test_species.species);
+		containers::append(result, count_bytes(static_cast<std::uint16_t>(containers::size(test_species.moves))));
+		for (auto const index : containers::integer_range(containers::size(test_species.moves))) {
+			auto const move = test_species.moves[index];
+			containers::append(result, move_bytes(move));
+			containers::append(result, weight_bytes(relative_weight(index)));
+			append_speed_distribution(result);
+			append_teammates(result, test_species.species);
+			append_moves(result, test_species, [=](MoveName const other) { return other != move; });
+			append_items_and_abilities(result, generation, test_species);
+		}
+		append_items_and_abilities(result, generation, test_species);
+	}
+	return result;
+}
+
 export auto bytes_to_usage_stats(containers::span<std::byte const> const bytes) -> UsageStats {
 	return UsageStats::make(std::stringstream(std::string(
 		reinterpret_cast<char const *>(containers::data(bytes)),
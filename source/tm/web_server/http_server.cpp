@@ -5,85 +5,104 @@
 
 export module tm.web_server.http_server;
 
-import tm.web_server.extension_to_content_type;
-import tm.web_server.normalize_requested_file;
+import tm.web_server.static_file_cache;
 import tm.web_server.web_server;
 
 import tm.boost_networking;
-import tm.bytes_in_file;
 import tm.get_directory;
 
-import containers;
 import std_module;
-import tv;
 
 namespace technicalmachine {
 namespace {
-using namespace containers::string_literals;
 
 auto get_client_directory() -> std::filesystem::path {
 	return std::filesystem::path(get_environment_variable("TM_CLIENT_DIRECTORY"));
 }
 
+using Response = http::response<http::span_body<char const>>;
+
+struct PreparedResponse {
+	Response response;
+	// Owns the memory that the body of `response` refers to
+	std::shared_ptr<void const> body_owner;
+};
+
 auto make_response(
-	std::filesystem::path const & root,
+	StaticFileCache const & cache,
 	http::request<http::empty_body> const & request
-) -> http::response<http::string_body> {
+) -> PreparedResponse {
 	auto make = [&](
 		http::status const status,
 		std::string_view const body,
-		std::string_view const content_type
+		std::shared_ptr<void const> body_owner
 	) {
-		auto response = http::response<http::string_body>(status, request.version());
+		auto response = Response(status, request.version());
 		response.keep_alive(request.keep_alive());
-		response.result(http::status::ok);
 		response.set(http::field::server, "Beast");
-		response.set(http::field::content_type, content_type);
-		response.body() = std::string(body);
-		response.prepare_payload();
-		return response;
+		response.body() = {body.data(), body.size()};
+		return PreparedResponse(std::move(response), std::move(body_owner));
 	};
 	try {
 		if (request.method() != http::verb::get) {
 			throw std::runtime_error("Unknown HTTP-method");
 		}
 
-		auto const path = normalize_requested_file(
-			root,
-			std::filesystem::path(request.target())
-		);
-		auto const content_type = extension_to_content_type(path.extension());
-
-		auto const bytes = bytes_in_file(path);
-
-		auto const body = containers::string_view(
-			reinterpret_cast<char const *>(containers::data(bytes)),
-			containers::size(bytes)
-		);
-		return make(http::status::ok, body, content_type);
+		auto const resource = cache.get(std::filesystem::path(request.target()));
+		auto const & file = resource->select(request[http::field::accept_encoding]);
+		auto const not_modified = etag_matches(request[http::field::if_none_match], file.etag);
+		auto result = not_modified ?
+			make(http::status::not_modified, {}, nullptr) :
+			make(http::status::ok, file.body, resource);
+		auto & response = result.response;
+		response.set(http::field::etag, file.etag);
+		response.set(http::field::vary, "Accept-Encoding");
+		if (!not_modified) {
+			response.set(http::field::content_type, std::string_view(resource->content_type));
+			if (file.encoding != ContentEncoding::identity) {
+				response.set(http::field::content_encoding, to_string(file.encoding));
+			}
+		}
+		response.prepare_payload();
+		return result;
 	} catch (std::exception const & ex) {
-		return make(http::status::bad_request, ex.what(), "text/html"_s);
+		auto const message = std::make_shared<std::string const>(ex.what());
+		auto result = make(http::status::bad_request, *message, message);
+		result.response.set(http::field::content_type, "text/html");
+		result.response.prepare_payload();
+		return result;
 	}
 }
 
 struct HTTPConnection {
 	explicit HTTPConnection(
 		tcp::socket socket,
-		[[clang::lifetimebound]] std::filesystem::path const & root
+		[[clang::lifetimebound]] StaticFileCache const & cache
 	):
 		m_socket(std::move(socket)),
-		m_root(root)
+		m_cache(cache)
 	{
 		do_read();
 	}
 
 	HTTPConnection(HTTPConnection &&) = delete;
 
+	// Safe to call from any thread
 	auto is_open() const -> bool {
-		return m_socket.is_open();
+		return m_open;
+	}
+
+	// The strand that all of this connection's handlers run on
+	auto get_executor() -> tcp::socket::executor_type {
+		return m_socket.get_executor();
 	}
 
 private:
+	auto close() -> void {
+		m_socket.close();
+		m_open = false;
+	}
+
 	auto do_read() -> void {
 		m_request = {};
 		http::async_read(
@@ -95,11 +114,11 @@ private:
 					if (ec != http::error::end_of_stream) {
 						std::cerr << "read error: " << ec.message() << "\n";
 					}
-					m_socket.close();
+					close();
 					return;
 				}
 				m_buffer.clear();
-				m_response = make_response(m_root, m_request);
+				m_response = make_response(m_cache.get(), m_request);
 				send_response();
 			}
 		);
@@ -108,17 +127,17 @@ private:
 	auto send_response() -> void {
 		http::async_write(
 			m_socket,
-			m_response,
+			m_response.response,
 			[&](boost::beast::error_code const ec, std::size_t) {
 				if (ec) {
 					std::cerr << "write error: " << ec.message() << "\n";
-					m_socket.close();
+					close();
 					return;
 				}
-				if (m_response.keep_alive()) {
+				if (m_response.response.keep_alive()) {
 					do_read();
 				} else {
-					m_socket.close();
+					close();
 				}
 			}
 		);
@@ -127,16 +146,17 @@ private:
 	tcp::socket m_socket;
 	boost::beast::flat_buffer m_buffer;
 	http::request<http::empty_body> m_request;
-	http::response<http::string_body> m_response;
-	std::reference_wrapper<std::filesystem::path const> m_root;
+	PreparedResponse m_response;
+	std::reference_wrapper<StaticFileCache const> m_cache;
+	std::atomic<bool> m_open = true;
 };
 
 struct MakeConnection {
 	auto operator()(tcp::socket socket) const {
-		return std::make_unique<HTTPConnection>(std::move(socket), m_root);
+		return std::make_unique<HTTPConnection>(std::move(socket), m_cache);
 	}
 private:
-	std::filesystem::path m_root = get_client_directory();
+	StaticFileCache m_cache = StaticFileCache(get_client_directory());
 };
 
 } // namespace
@@ -0,0 +1,227 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module tm.web_server.static_file_cache;
+
+import tm.web_server.extension_to_content_type;
+import tm.web_server.normalize_requested_file;
+
+import tm.open_file;
+
+import bounded;
+import containers;
+import std_module;
+import tv;
+
+namespace technicalmachine {
+using namespace bounded::literal;
+using namespace containers::string_literals;
+
+export enum class ContentEncoding {
+	identity,
+	gzip,
+	br
+};
+
+export constexpr auto to_string(ContentEncoding const encoding) -> std::string_view {
+	switch (encoding) {
+		case ContentEncoding::identity: return "identity";
+		case ContentEncoding::gzip: return "gzip";
+		case ContentEncoding::br: return "br";
+	}
+}
+
+// Precompressed versions of `f.js` are read from `f.js.gz` and `f.js.br`
+constexpr auto file_extension(ContentEncoding const encoding) -> std::string_view {
+	switch (encoding) {
+		case ContentEncoding::identity: return "";
+		case ContentEncoding::gzip: return ".gz";
+		case ContentEncoding::br: return ".br";
+	}
+}
+
+// In order of preference
+constexpr auto all_encodings = containers::array({
+	ContentEncoding::br,
+	ContentEncoding::gzip,
+	ContentEncoding::identity
+});
+
+constexpr auto trim(std::string_view str) -> std::string_view {
+	while (!str.empty() and (str.front() == ' ' or str.front() == '\t')) {
+		str.remove_prefix(1);
+	}
+	while (!str.empty() and (str.back() == ' ' or str.back() == '\t')) {
+		str.remove_suffix(1);
+	}
+	return str;
+}
+
+// Calls `function` with each trimmed element of a comma separated header
+// until it returns true
+constexpr auto any_header_element(std::string_view header, auto const function) -> bool {
+	while (true) {
+		auto const comma = header.find(',');
+		if (function(trim(header.substr(0, comma)))) {
+			return true;
+		}
+		if (comma == std::string_view::npos) {
+			return false;
+		}
+		header.remove_prefix(comma + 1);
+	}
+}
+
+// Ignores every parameter except an explicit `q=0`
+export constexpr auto accepts_encoding(std::string_view const accept_encoding, ContentEncoding const encoding) -> bool {
+	if (encoding == ContentEncoding::identity) {
+		return true;
+	}
+	return any_header_element(accept_encoding, [=](std::string_view const element) {
+		auto const semicolon = element.find(';');
+		auto const name = trim(element.substr(0, semicolon));
+		if (name != to_string(encoding) and name != "*") {
+			return false;
+		}
+		if (semicolon == std::string_view::npos) {
+			return true;
+		}
+		auto const parameter = trim(element.substr(semicolon + 1));
+		if (!parameter.starts_with("q=")) {
+			return true;
+		}
+		auto const quality = parameter.substr(2);
+		return quality.find_first_not_of("0.") != std::string_view::npos;
+	});
+}
+
+export constexpr auto etag_matches(std::string_view const if_none_match, std::string_view const etag) -> bool {
+	return any_header_element(if_none_match, [=](std::string_view const element) {
+		return element == "*" or element == etag or (element.starts_with("W/") and element.substr(2) == etag);
+	});
+}
+
+auto make_etag(std::string_view const body) -> std::string {
+	auto hex = containers::array<char, 16_bi>();
+	auto const result = std::to_chars(
+		containers::data(hex),
+		containers::data(hex) + containers::size(hex),
+		std::hash<std::string_view>()(body),
+		16
+	);
+	return containers::concatenate<std::string>("\""_s, std::string_view(containers::data(hex), result.ptr), "\""_s);
+}
+
+auto read_file(std::filesystem::path const & path) -> std::string {
+	auto file = open_binary_file_for_reading(path);
+	auto result = std::string(std::filesystem::file_size(path), '\0');
+	file.read(result.data(), static_cast<std::streamsize>(result.size()));
+	if (!file) {
+		throw std::runtime_error(containers::concatenate<std::string>("Unable to read "_s, path.string()));
+	}
+	return result;
+}
+
+export struct CachedFile {
+	ContentEncoding encoding;
+	std::string body;
+	std::string etag;
+};
+
+struct FileVersion {
+	ContentEncoding encoding;
+	std::filesystem::file_time_type last_write_time;
+
+	friend auto operator==(FileVersion const &, FileVersion const &) -> bool = default;
+};
+using FileVersions = containers::static_vector<FileVersion, containers::size(all_encodings)>;
+
+// Looks at the modification time of the file and all of its precompressed
+// versions. Those that do not exist are left out.
+auto current_versions(std::filesystem::path const & path) -> FileVersions {
+	auto result = FileVersions();
+	for (auto const encoding : all_encodings) {
+		auto ec = std::error_code();
+		auto const last_write_time = std::filesystem::last_write_time(path.string() + std::string(file_extension(encoding)), ec);
+		if (!ec) {
+			containers::push_back(result, FileVersion(encoding, last_write_time));
+		}
+	}
+	if (containers::is_empty(result) or containers::back(result).encoding != ContentEncoding::identity) {
+		throw std::runtime_error(containers::concatenate<std::string>("File not found: "_s, path.string()));
+	}
+	return result;
+}
+
+// A requested file and all of its precompressed versions, in order of
+// preference
+export struct CachedResource {
+	CachedResource(std::filesystem::path const & path, FileVersions versions_):
+		content_type(extension_to_content_type(path.extension())),
+		files(containers::transform(versions_, [&](FileVersion const version) {
+			auto body = read_file(path.string() + std::string(file_extension(version.encoding)));
+			auto etag = make_etag(body);
+			return CachedFile(version.encoding, std::move(body), std::move(etag));
+		})),
+		versions(std::move(versions_))
+	{
+	}
+
+	// Identity is always accepted, so this always finds a file
+	auto select(std::string_view const accept_encoding) const -> CachedFile const & {
+		return *containers::find_if(files, [=](CachedFile const & file) {
+			return accepts_encoding(accept_encoding, file.encoding);
+		});
+	}
+
+	containers::string_view content_type;
+	containers::static_vector<CachedFile, containers::size(all_encodings)> files;
+	FileVersions versions;
+};
+
+// Files are read the first time they are requested and kept in memory. Every
+// request checks the modification times of the files, and a file that has
+// changed is read again. Anyone holding the old version keeps it alive. Safe to
+// call from multiple threads at once.
+export struct StaticFileCache {
+	explicit StaticFileCache(std::filesystem::path root):
+		m_state(std::make_unique<State>(std::move(root)))
+	{
+	}
+
+	// Throws if the file does not exist or is outside of the root
+	auto get(std::filesystem::path const & target) const -> std::shared_ptr<CachedResource const> {
+		auto path = normalize_requested_file(m_state->root, target);
+		auto versions = current_versions(path);
+		{
+			auto const lock = std::scoped_lock(m_state->mutex);
+			auto const it = m_state->resources.find(path);
+			if (it != m_state->resources.end() and it->second->versions == versions) {
+				return it->second;
+			}
+		}
+		// If a file changes while it is being read, it has a newer
+		// modification time than `versions` and will be read again
+		auto resource = std::make_shared<CachedResource const>(path, std::move(versions));
+		auto const lock = std::scoped_lock(m_state->mutex);
+		m_state->resources.insert_or_assign(std::move(path), resource);
+		return resource;
+	}
+
+private:
+	struct State {
+		explicit State(std::filesystem::path root_):
+			root(std::move(root_))
+		{
+		}
+
+		std::filesystem::path root;
+		std::mutex mutex;
+		std::map<std::filesystem::path, std::shared_ptr<CachedResource const>> resources;
+	};
+	std::unique_ptr<State> m_state;
+};
+
+} // namespace technicalmachine
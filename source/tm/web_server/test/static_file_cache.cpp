@@ -0,0 +1,89 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <doctest/doctest.h>
+
+export module tm.test.web_server.static_file_cache;
+
+import tm.web_server.static_file_cache;
+import std_module;
+
+namespace technicalmachine {
+namespace {
+
+TEST_CASE("accepts_encoding") {
+	CHECK(accepts_encoding("", ContentEncoding::identity));
+	CHECK(!accepts_encoding("", ContentEncoding::gzip));
+	CHECK(accepts_encoding("gzip", ContentEncoding::gzip));
+	CHECK(accepts_encoding("deflate, gzip;q=1.0, br", ContentEncoding::gzip));
+	CHECK(accepts_encoding("deflate, gzip;q=1.0, br", ContentEncoding::br));
+	CHECK(!accepts_encoding("gzip;q=0", ContentEncoding::gzip));
+	CHECK(!accepts_encoding("gzip; q=0.000", ContentEncoding::gzip));
+	CHECK(accepts_encoding("*", ContentEncoding::br));
+	CHECK(!accepts_encoding("brotli", ContentEncoding::br));
+}
+
+TEST_CASE("etag_matches") {
+	CHECK(etag_matches("\"abc\"", "\"abc\""));
+	CHECK(etag_matches("\"x\", \"abc\"", "\"abc\""));
+	CHECK(etag_matches("W/\"abc\"", "\"abc\""));
+	CHECK(etag_matches("*", "\"abc\""));
+	CHECK(!etag_matches("", "\"abc\""));
+	CHECK(!etag_matches("\"abcd\"", "\"abc\""));
+}
+
+struct TemporaryDirectory {
+	TemporaryDirectory():
+		path(std::filesystem::temp_directory_path() / "tm_static_file_cache_test")
+	{
+		std::filesystem::remove_all(path);
+		std::filesystem::create_directories(path);
+	}
+	~TemporaryDirectory() {
+		std::filesystem::remove_all(path);
+	}
+	std::filesystem::path path;
+};
+
+auto write_file(std::filesystem::path const & path, std::string_view const contents) -> void {
+	auto file = std::ofstream(path, std::ios_base::binary);
+	file << contents;
+}
+
+TEST_CASE("StaticFileCache") {
+	auto const directory = TemporaryDirectory();
+	write_file(directory.path / "index.html", "<html></html>");
+	auto const cache = StaticFileCache(directory.path);
+
+	auto const original = cache.get("/");
+	CHECK(std::string_view(original->content_type) == "text/html");
+	CHECK(original->select("gzip").encoding == ContentEncoding::identity);
+	CHECK(original->select("gzip").body == "<html></html>");
+	CHECK(cache.get("/index.html") == original);
+
+	write_file(directory.path / "index.html.gz", "compressed");
+	auto const compressed = cache.get("/");
+	CHECK(compressed != original);
+	CHECK(compressed->select("gzip, br").encoding == ContentEncoding::gzip);
+	CHECK(compressed->select("gzip, br").body == "compressed");
+	CHECK(compressed->select("br").encoding == ContentEncoding::identity);
+
+	auto const path = directory.path / "index.html";
+	write_file(path, "<html>new</html>");
+	std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(1));
+	auto const updated = cache.get("/");
+	CHECK(updated->select("").body == "<html>new</html>");
+	CHECK(updated->select("").etag != original->select("").etag);
+	// Responses already being sent are unaffected
+	CHECK(original->select("").body == "<html></html>");
+
+	CHECK_THROWS(cache.get("/missing.html"));
+	CHECK_THROWS(cache.get("/../index.html"));
+}
+
+} // namespace
+} // namespace technicalmachine
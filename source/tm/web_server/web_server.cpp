@@ -27,7 +27,10 @@ auto make_acceptor(
 }
 
 template<typename T>
-concept connection = requires(T const & c) { c->is_open(); };
+concept connection = requires(T const & c) {
+	c->is_open();
+	c->get_executor();
+};
 
 template<typename Function>
 concept connection_factory = connection<std::invoke_result_t<Function, tcp::socket &&>>;
@@ -46,14 +49,30 @@ struct WebServer {
 	}
 private:
 	using ConnectionPtr = std::invoke_result_t<MakeConnection, tcp::socket &&>;
+
+	// A connection can be marked closed while its last handler is still
+	// running on another thread, so it is destroyed on its own strand, after
+	// that handler returns
+	auto prune_closed_connections() -> void {
+		for (auto & connection : m_connections) {
+			if (!connection->is_open()) {
+				auto const executor = connection->get_executor();
+				boost::asio::post(executor, [closed = std::move(connection)] {});
+			}
+		}
+		containers::erase_if(m_connections, [](ConnectionPtr const & c) {
+			return c == nullptr;
+		});
+	}
+
+	// Each connection gets its own strand, so its handlers never run
+	// concurrently even when the io_context is run on several threads
 	auto accept_connection() -> void {
-		m_acceptor.async_accept([&](
+		m_acceptor.async_accept(boost::asio::make_strand(m_acceptor.get_executor()), [&](
 			boost::beast::error_code const ec,
 			tcp::socket socket
 		) -> void {
-			containers::erase_if(m_connections, [](ConnectionPtr const & c) {
-				return !c->is_open();
-			});
+			prune_closed_connections();
 			if (ec) {
 				std::cerr << "accept error: " << ec.message() << "\n";
 			} else {
@@ -12,62 +12,147 @@ import tm.boost_networking;
 import bounded;
 import containers;
 import std_module;
+import tv;
 
 namespace technicalmachine {
 
+// Messages are immutable once built, so the same message (for instance, one
+// built at startup) can be sent to any number of connections without a copy.
+export using WebSocketMessage = std::shared_ptr<containers::string const>;
+
+export auto make_websocket_message(containers::string message) -> WebSocketMessage {
+	return std::make_shared<containers::string const>(std::move(message));
+}
+
 export using OnWebsocketConnect = containers::trivial_inplace_function<
-	auto() const -> containers::string,
+	auto() const -> WebSocketMessage,
 	sizeof(void *)
 >;
 export using OnWebsocketMessage = containers::trivial_inplace_function<
-	auto(containers::string_view) const -> containers::string,
+	auto(containers::string_view) const -> WebSocketMessage,
 	sizeof(void *) * 2
 >;
 
+// Messages are handled on their own pool of threads, so a slow message only
+// holds up the connection that sent it. Once `max_queued` messages are waiting
+// or running, any further message immediately gets `busy_response` instead.
+export struct WebSocketWorkers {
+	WebSocketWorkers(
+		std::size_t const thread_count,
+		std::size_t const max_queued,
+		containers::string busy_response
+	):
+		m_pool(thread_count),
+		m_max_queued(max_queued),
+		m_busy_response(make_websocket_message(std::move(busy_response)))
+	{
+	}
+
+	WebSocketWorkers(WebSocketWorkers &&) = delete;
+
+	~WebSocketWorkers() {
+		m_pool.join();
+	}
+
+	// `function` runs on the worker pool. `respond` is then called with the
+	// result (or with tv::none if `function` threw) through `executor`.
+	auto submit(auto const & executor, auto function, auto respond) & -> void {
+		if (m_queued.fetch_add(1U) >= m_max_queued) {
+			--m_queued;
+			boost::asio::post(executor, [this, respond = std::move(respond)] mutable {
+				respond(tv::optional<WebSocketMessage>(m_busy_response));
+			});
+			return;
+		}
+		boost::asio::post(m_pool, [=, this, function = std::move(function), respond = std::move(respond)] mutable {
+			auto response = tv::optional<WebSocketMessage>();
+			try {
+				response = function();
+			} catch (std::exception const & ex) {
+				std::cerr << "Websocket message error: " << ex.what() << '\n';
+			}
+			--m_queued;
+			boost::asio::post(executor, [response = std::move(response), respond = std::move(respond)] mutable {
+				respond(std::move(response));
+			});
+		});
+	}
+
+private:
+	boost::asio::thread_pool m_pool;
+	std::atomic<std::size_t> m_queued = 0U;
+	std::size_t m_max_queued;
+	WebSocketMessage m_busy_response;
+};
+
+export enum class WebSocketCompression {
+	none,
+	// permessage-deflate, for clients that support it
+	deflate
+};
+
 namespace {
 
 struct Connection {
 	explicit Connection(
 		tcp::socket socket,
 		[[clang::lifetimebound]] OnWebsocketConnect const & on_connect,
-		[[clang::lifetimebound]] OnWebsocketMessage const & on_message
+		[[clang::lifetimebound]] OnWebsocketMessage const & on_message,
+		[[clang::lifetimebound]] WebSocketWorkers & workers,
+		WebSocketCompression const compression
 	):
 		m_socket(std::move(socket)),
 		m_on_connect(on_connect),
-		m_on_message(on_message)
+		m_on_message(on_message),
+		m_workers(workers)
 	{
+		if (compression == WebSocketCompression::deflate) {
+			websocket_enable_compression(m_socket);
+		}
 		accept_handshake();
 	}
 
 	Connection(Connection &&) = delete;
 
+	// Safe to call from any thread. Stays true while a message is being
+	// handled on the worker pool.
 	auto is_open() const -> bool {
-		return m_socket.is_open();
+		return m_open;
+	}
+
+	// The strand that all of this connection's handlers run on
+	auto get_executor() -> tcp::socket::executor_type {
+		return m_socket.get_executor();
 	}
 
 private:
+	auto close() -> void {
+		websocket_close(m_socket);
+		m_open = false;
+	}
 	auto accept_handshake() -> void {
 		m_socket.async_accept([&](boost::beast::error_code const ec) {
 			if (ec) {
 				std::cerr << "Websocket accept error: " << ec.message() << '\n';
+				m_open = false;
 				return;
 			}
 			write(m_on_connect.get()());
 		});
 	}
-	auto write(containers::string_view const str) -> void {
-		auto buffer = m_buffer.prepare(static_cast<std::size_t>(str.size()));
-		containers::copy(str, static_cast<char *>(buffer.data()));
+	auto write(WebSocketMessage message) -> void {
+		// Kept alive until the write completes
+		m_outgoing = std::move(message);
 		websocket_async_write(
 			m_socket,
-			buffer,
+			boost::asio::buffer(m_outgoing->data(), static_cast<std::size_t>(m_outgoing->size())),
 			[&](boost::beast::error_code const ec, std::size_t) {
+				m_outgoing.reset();
 				if (ec) {
 					std::cerr << "Websocket write error: " << ec.message() << '\n';
-					websocket_close(m_socket);
+					close();
 					return;
 				}
-				m_buffer.clear();
 				read();
 			}
 		);
@@ -79,58 +164,84 @@ private:
 			[&](boost::beast::error_code const ec, std::size_t) {
 				if (ec) {
 					std::cerr << "Websocket read error: " << ec.message() << '\n';
-					websocket_close(m_socket);
+					close();
 					return;
 				}
-				auto const response = m_on_message.get()(containers::string_view(
+				auto message = containers::string(containers::string_view(
 					static_cast<char const *>(m_buffer.data().data()),
 					bounded::assume_in_range<containers::array_size_type<char>>(m_buffer.data().size())
 				));
 				m_buffer.clear();
-				write(response);
+				m_workers.get().submit(
+					m_socket.get_executor(),
+					[this, message = std::move(message)] {
+						return m_on_message.get()(message);
+					},
+					[this](tv::optional<WebSocketMessage> response) {
+						if (!response) {
+							close();
+							return;
+						}
+						write(std::move(*response));
+					}
+				);
 			}
 		);
 	}
 	InsecureWebsocket m_socket;
 	boost::beast::flat_buffer m_buffer;
+	WebSocketMessage m_outgoing;
 	std::reference_wrapper<OnWebsocketConnect const> m_on_connect;
 	std::reference_wrapper<OnWebsocketMessage const> m_on_message;
+	std::reference_wrapper<WebSocketWorkers> m_workers;
+	std::atomic<bool> m_open = true;
 };
 
 struct MakeConnection {
 	MakeConnection(
 		OnWebsocketConnect on_connect,
-		OnWebsocketMessage on_message
+		OnWebsocketMessage on_message,
+		WebSocketWorkers & workers,
+		WebSocketCompression const compression
 	):
 		m_on_connect(std::move(on_connect)),
-		m_on_message(std::move(on_message))
+		m_on_message(std::move(on_message)),
+		m_workers(workers),
+		m_compression(compression)
 	{
 	}
 	auto operator()(tcp::socket socket) const {
 		return std::make_unique<Connection>(
 			std::move(socket),
 			m_on_connect,
-			m_on_message
+			m_on_message,
+			m_workers.get(),
+			m_compression
 		);
 	}
 private:
 	OnWebsocketConnect m_on_connect;
 	OnWebsocketMessage m_on_message;
+	std::reference_wrapper<WebSocketWorkers> m_workers;
+	WebSocketCompression m_compression;
 };
 
 } // namespace
 
+// `on_message` is called concurrently from the threads of `workers`
 export struct WebSocketServer {
 	WebSocketServer(
 		[[clang::lifetimebound]] boost::asio::io_context & context,
 		unsigned short const port,
 		OnWebsocketConnect on_connect,
-		OnWebsocketMessage on_message
+		OnWebsocketMessage on_message,
+		[[clang::lifetimebound]] WebSocketWorkers & workers,
+		WebSocketCompression const compression = WebSocketCompression::none
 	):
 		m_server(
 			context,
 			port,
-			MakeConnection(std::move(on_connect), std::move(on_message))
+			MakeConnection(std::move(on_connect), std::move(on_message), workers, compression)
 		)
 	{
 	}